@@ -0,0 +1,120 @@
+/**
+ *  @note Scaling benchmark of the static arenas ( @see{TASK_CAPACITY} ): fill
+ *  the queue up to the capacity via register_task_ex and drain it (the same
+ *  as get_callback does, but for the clock moved forward), print ops/sec and
+ *  bytes per task of the arenas. One capacity per build, e.g.
+ *
+ *  Usage
+ *  for CAPACITY in 1000 65536 1000000; do
+ *    BENCH_FLAGS="-DTASK_CAPACITY=$CAPACITY" \
+ *      ./build_benchmarks_gcc.sh capacity && ./benchmarks/capacity_bench
+ *  done
+ *
+ *  @note Add -DTASK_COMPACT_TASKS=1 to compare the compact 16-byte record (
+ *  @see{TASK_COMPACT_TASKS} ) with the full one, "record" column.
+ *
+ *  @note The sorted array backend ( @see{TASK_QUEUE_BACKEND} ) re-sorts the
+ *  whole array per operation, keep its capacity small.
+ *
+ */
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+enum Bench_capacity_variables {
+  BENCH_MAX_DELAY = 60'000, /**< max delay (ms) of the registered tasks */
+};
+
+static unsigned int bench_seed = 42;
+
+/**
+ *  @brief Utility function (encapsulated) to get pseudo random delay (ms) in
+ *  range [1; BENCH_MAX_DELAY] (linear congruential generator)
+ *
+ */
+static TASK_DELAY get_bench_delay(void) {
+  bench_seed = bench_seed * 1'103'515'245U + 12'345U;
+
+  return 1 + (bench_seed >> 16) % BENCH_MAX_DELAY;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get current timestamp (ns)
+ *
+ */
+static long long get_bench_timestamp_ns(void) {
+  struct timespec ts = {};
+  timespec_get(&ts, TIME_UTC);
+
+  return (long long)ts.tv_sec * RATIO_SEC_NANOSEC + ts.tv_nsec;
+}
+
+static void noop_callback(unsigned short arg) {
+  (void)arg;
+}
+
+int main(void) {
+#if TASK_QUEUE_BACKEND == TASK_QUEUE_BACKEND_SORTED_ARRAY
+  printf("backend: sorted array (qsort)\n");
+#elif TASK_QUEUE_BACKEND == TASK_QUEUE_BACKEND_TIMING_WHEEL
+  printf("backend: hierarchical timing wheel\n");
+#elif TASK_QUEUE_BACKEND == TASK_QUEUE_BACKEND_PACKED_DEADLINES
+  printf("backend: packed deadlines (SoA)\n");
+#else
+  printf("backend: binary min-heap\n");
+#endif
+#if TASK_COMPACT_TASKS
+  printf("task record: compact (callback registry)\n");
+#else
+  printf("task record: full\n");
+#endif
+
+  // one clock reading for the whole filling, so only the queue is measured
+  TASK_TICKS now_ticks = begin_clock_tick().handle_clock_result.TICKS;
+
+  long long started_ns = get_bench_timestamp_ns();
+  for (long long i = 0; i < MAX_TASK_QUANTITY; i += 1) {
+    if (register_task_ex(noop_callback, 0, get_bench_delay()).type !=
+        SUCCESS) {
+      fprintf(stderr, "Error(%s() function at %d): registered %lld tasks\n",
+              __func__, __LINE__, i);
+      return 1;
+    }
+  }
+  long long register_ns = get_bench_timestamp_ns() - started_ns;
+  end_clock_tick();
+
+  // all the tasks are expired BENCH_MAX_DELAY + 1 ms later
+  started_ns = get_bench_timestamp_ns();
+  task_queue_advance(&default_scheduler, now_ticks +
+                     (BENCH_MAX_DELAY + 1LL) * RATIO_NANOSEC_MSEC);
+  long long drained_count = 0;
+  Task *ptr_task = NULL;
+  while ((ptr_task = task_queue_peek(&default_scheduler)) != NULL) {
+    free_id(&default_scheduler, ptr_task->id);
+    task_queue_pop(&default_scheduler);
+    drained_count += 1;
+  }
+  long long drain_ns = get_bench_timestamp_ns() - started_ns;
+
+  if (drained_count != MAX_TASK_QUANTITY || default_scheduler.task_count != 0) {
+    fprintf(stderr, "Error(%s() function at %d): %lld tasks drained\n",
+            __func__, __LINE__, drained_count);
+    return 1;
+  }
+
+  size_t arenas_size = sizeof(Task) * MAX_TASK_QUANTITY + sizeof(ID_STORAGE) +
+                       sizeof(PERIODIC_TASKS_STATE) +
+                       sizeof(TASK_SLACKS_STATE) + task_queue_get_arena_size();
+
+  printf("%10s %8s %16s %16s %16s\n", "capacity", "record", "register ops/s",
+         "drain ops/s", "bytes/task");
+  printf("%10d %8zu %16.0f %16.0f %16.1f\n", MAX_TASK_QUANTITY, sizeof(Task),
+         MAX_TASK_QUANTITY * (double)RATIO_SEC_NANOSEC / register_ns,
+         MAX_TASK_QUANTITY * (double)RATIO_SEC_NANOSEC / drain_ns,
+         (double)arenas_size / MAX_TASK_QUANTITY);
+
+  return 0;
+}
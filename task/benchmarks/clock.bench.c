@@ -0,0 +1,105 @@
+/**
+ *  @note Benchmark of the time base: cost (ns) per readiness check of the
+ *  get_callback, i.e. the legacy timespec_get(TIME_UTC) + round() path vs
+ *  the monotonic integer ticks ( @see{get_now_ticks} ) and the cached tick
+ *  ( @see{begin_clock_tick} ).
+ *
+ *  Usage
+ *  ./build_benchmarks_gcc.sh clock && ./benchmarks/clock_bench
+ *
+ */
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+enum Bench_clock_variables {
+  BENCH_ITERATIONS = 1'000'000, /**< calls per measurement */
+  BENCH_PENDING_DELAY = 60'000, /**< delay (ms) => the task stays pending */
+};
+
+static volatile long long bench_sink = 0;
+
+/**
+ *  @brief Utility function (encapsulated) to get current timestamp (ns)
+ *
+ */
+static long long get_bench_timestamp_ns(void) {
+  struct timespec ts = {};
+  timespec_get(&ts, TIME_UTC);
+
+  return (long long)ts.tv_sec * RATIO_SEC_NANOSEC + ts.tv_nsec;
+}
+
+/**
+ *  @brief Utility function (encapsulated): the readiness check of the
+ *  handle_get_callback before the monotonic time base (wall-clock reading and
+ *  float round() for both the current and the task's timestamps)
+ *
+ */
+static bool is_legacy_task_ready(struct timespec task_created_timespec,
+                                 unsigned short delay) {
+  struct timespec current_ts = {};
+  timespec_get(&current_ts, TIME_UTC);
+
+  time_t current_timestamp_ms =
+      (time_t)(round(current_ts.tv_sec * RATIO_SEC_MS +
+                     current_ts.tv_nsec / RATIO_NANOSEC_MSEC));
+  time_t task_timestamp_ms =
+      (time_t)(round(task_created_timespec.tv_sec * RATIO_SEC_MS +
+                     task_created_timespec.tv_nsec / RATIO_NANOSEC_MSEC));
+  unsigned short diff_timestamps_ms =
+      (unsigned short)(current_timestamp_ms - task_timestamp_ms);
+
+  return diff_timestamps_ms > delay;
+}
+
+static void noop_callback(unsigned short arg) {
+  (void)arg;
+}
+
+int main(void) {
+  struct timespec created_ts = {};
+  timespec_get(&created_ts, TIME_UTC);
+
+  long long started_ns = get_bench_timestamp_ns();
+  for (int i = 0; i < BENCH_ITERATIONS; i += 1) {
+    bench_sink += is_legacy_task_ready(created_ts, BENCH_PENDING_DELAY);
+  }
+  long long legacy_ns = get_bench_timestamp_ns() - started_ns;
+
+  started_ns = get_bench_timestamp_ns();
+  for (int i = 0; i < BENCH_ITERATIONS; i += 1) {
+    bench_sink += get_now_ticks().handle_clock_result.TICKS;
+  }
+  long long now_ticks_ns = get_bench_timestamp_ns() - started_ns;
+
+  // one pending task => every get_callback() goes through the whole
+  // readiness check and returns GET_CALLBACK_PENDING
+  register_task(noop_callback, 0, BENCH_PENDING_DELAY);
+
+  started_ns = get_bench_timestamp_ns();
+  for (int i = 0; i < BENCH_ITERATIONS; i += 1) {
+    bench_sink += get_callback().get_callback_result.CODES_RESULT;
+  }
+  long long get_callback_ns = get_bench_timestamp_ns() - started_ns;
+
+  started_ns = get_bench_timestamp_ns();
+  begin_clock_tick();
+  for (int i = 0; i < BENCH_ITERATIONS; i += 1) {
+    bench_sink += get_callback().get_callback_result.CODES_RESULT;
+  }
+  end_clock_tick();
+  long long cached_get_callback_ns = get_bench_timestamp_ns() - started_ns;
+
+  printf("%-44s %10s\n", "operation", "ns/op");
+  printf("%-44s %10.1f\n", "legacy check (timespec_get + round)",
+         (double)legacy_ns / BENCH_ITERATIONS);
+  printf("%-44s %10.1f\n", "get_now_ticks (monotonic, integer)",
+         (double)now_ticks_ns / BENCH_ITERATIONS);
+  printf("%-44s %10.1f\n", "get_callback (pending)",
+         (double)get_callback_ns / BENCH_ITERATIONS);
+  printf("%-44s %10.1f\n", "get_callback (pending, cached tick)",
+         (double)cached_get_callback_ns / BENCH_ITERATIONS);
+
+  return 0;
+}
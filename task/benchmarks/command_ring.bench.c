@@ -0,0 +1,232 @@
+/**
+ *  @note Cross-thread submission benchmark: 1 to 8 producer threads register
+ *  the zero-delay tasks on the dispatcher thread (the main one) that owns the
+ *  queue and runs them. The lock-free command ring (submit_register_task +
+ *  apply_task_commands per tick) vs the mutex around register_task_ex (the
+ *  only safe way without the ring). Print the throughput (M commands/s) and
+ *  the latency (us) of the sampled commands: till the dispatcher applies the
+ *  command (ring) / till the register_task_ex returns (mutex), e.g.
+ *
+ *  @note The dispatcher applies the whole ring per tick, so the queue must
+ *  hold TASK_COMMAND_RING_CAPACITY tasks at least (checked at the start), the
+ *  failed command (e.g. the full queue) aborts the benchmark.
+ *
+ *  Usage
+ *  BENCH_FLAGS="-DTASK_CAPACITY=65536" ./build_benchmarks_gcc.sh \
+ *    command_ring && ./benchmarks/command_ring_bench
+ *
+ */
+
+// nanosleep(), sched_yield() declarations for the strict -std=c23 builds
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+enum Bench_command_ring_variables {
+  BENCH_MAX_PRODUCERS = 8,            /**< max producer threads quantity */
+  BENCH_COMMANDS_PER_THREAD = 100'000, /**< commands per producer */
+  BENCH_SAMPLE_EVERY = 256,           /**< latency sample per commands */
+};
+
+typedef enum { RING_SUBMIT, MUTEX_REGISTER, BENCH_MODES_QUANTITY } BENCH_MODE;
+
+static pthread_mutex_t queue_mutex = PTHREAD_MUTEX_INITIALIZER;
+static BENCH_MODE bench_mode = RING_SUBMIT;
+static atomic_ullong bench_calls_count = 0;
+static atomic_llong latency_sum_ns = 0;
+static atomic_llong latency_max_ns = 0;
+static atomic_llong latency_samples_count = 0;
+static atomic_llong retries_count = 0; /**< full ring / full queue */
+static atomic_bool is_bench_aborted = false; /**< a command failed */
+
+static void counting_callback(unsigned short arg) {
+  (void)arg;
+  atomic_fetch_add_explicit(&bench_calls_count, 1, memory_order_relaxed);
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get current timestamp (ns)
+ *
+ */
+static long long get_bench_timestamp_ns(void) {
+  struct timespec ts = {};
+  timespec_get(&ts, TIME_UTC);
+
+  return (long long)ts.tv_sec * RATIO_SEC_NANOSEC + ts.tv_nsec;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to account the latency sample
+ *
+ */
+static void add_latency_sample(long long latency_ns) {
+  atomic_fetch_add(&latency_sum_ns, latency_ns);
+  atomic_fetch_add(&latency_samples_count, 1);
+
+  long long max_ns = atomic_load(&latency_max_ns);
+
+  while ((latency_ns > max_ns) &&
+         !atomic_compare_exchange_weak(&latency_max_ns, &max_ns, latency_ns)) {
+  }
+}
+
+/**
+ *  @brief The producer's thread: submit (register) the zero-delay tasks,
+ *  every BENCH_SAMPLE_EVERY one is timed
+ *
+ */
+static void *run_producer(void *arg) {
+  (void)arg;
+  _Atomic TASK_HANDLE sampled_id = TASK_COMMAND_HANDLE_PENDING;
+
+  for (int i = 0;
+       (i < BENCH_COMMANDS_PER_THREAD) && !atomic_load(&is_bench_aborted);
+       i += 1) {
+    bool is_sampled = i % BENCH_SAMPLE_EVERY == 0;
+    long long started_ns = is_sampled ? get_bench_timestamp_ns() : 0;
+
+    if (bench_mode == RING_SUBMIT) {
+      while (submit_register_task(counting_callback, 0, 0,
+                                  is_sampled ? &sampled_id : NULL) ==
+                 HANDLE_COMMAND_RING_IS_FULL &&
+             !atomic_load(&is_bench_aborted)) {
+        atomic_fetch_add_explicit(&retries_count, 1, memory_order_relaxed);
+        sched_yield();
+      }
+
+      while (is_sampled &&
+             (atomic_load(&sampled_id) == TASK_COMMAND_HANDLE_PENDING) &&
+             !atomic_load(&is_bench_aborted)) {
+        sched_yield();
+      }
+    } else {
+      while (true) {
+        pthread_mutex_lock(&queue_mutex);
+        PROMISE_TASK_ID log_id = register_task_ex(counting_callback, 0, 0);
+        pthread_mutex_unlock(&queue_mutex);
+
+        if (log_id.type == SUCCESS) {
+          break;
+        }
+
+        atomic_fetch_add_explicit(&retries_count, 1, memory_order_relaxed);
+        sched_yield();
+      }
+    }
+
+    if (is_sampled) {
+      add_latency_sample(get_bench_timestamp_ns() - started_ns);
+    }
+  }
+
+  return NULL;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to serve the producers till all
+ *  their tasks are called (the dispatcher's loop). The failed command is
+ *  never called, so the producers are aborted instead of waiting for it
+ *
+ *  @return {bool} - false => a command failed (the benchmark is aborted)
+ *
+ */
+static bool run_dispatcher(unsigned long long expected_calls_count) {
+  while (atomic_load(&bench_calls_count) < expected_calls_count) {
+    if (bench_mode == RING_SUBMIT) {
+      wait_next_deadline(HANDLE_WAIT_FOREVER);
+
+      if (apply_task_commands(0).FAILED_COUNT != 0) {
+        atomic_store(&is_bench_aborted, true);
+        return false;
+      }
+
+      run_ready_tasks((RUN_BUDGET){});
+    } else {
+      pthread_mutex_lock(&queue_mutex);
+      size_t ran_count = run_ready_tasks((RUN_BUDGET){})
+                             .run_ready_tasks_result.REPORT.RAN_COUNT;
+      pthread_mutex_unlock(&queue_mutex);
+
+      if (ran_count == 0) {
+        sched_yield();
+      }
+    }
+  }
+
+  return true;
+}
+
+int main(void) {
+  // the whole ring is applied per tick
+  if (MAX_TASK_QUANTITY < TASK_COMMAND_RING_CAPACITY) {
+    fprintf(stderr,
+            "Error(%s() function at %d): TASK_CAPACITY %d is less than the "
+            "command ring (%d), compile with -DTASK_CAPACITY=65536\n",
+            __func__, __LINE__, MAX_TASK_QUANTITY, TASK_COMMAND_RING_CAPACITY);
+    return 1;
+  }
+
+  printf("%10s %8s %14s %14s %14s %10s\n", "mode", "threads", "M commands/s",
+         "mean lat. us", "max lat. us", "retries");
+
+  pthread_t threads[BENCH_MAX_PRODUCERS];
+
+  for (int mode = RING_SUBMIT; mode < BENCH_MODES_QUANTITY; mode += 1) {
+    for (int threads_count = 1; threads_count <= BENCH_MAX_PRODUCERS;
+         threads_count *= 2) {
+      const unsigned long long EXPECTED_CALLS_COUNT =
+          1ULL * threads_count * BENCH_COMMANDS_PER_THREAD;
+
+      bench_mode = mode;
+      atomic_store(&bench_calls_count, 0);
+      atomic_store(&latency_sum_ns, 0);
+      atomic_store(&latency_max_ns, 0);
+      atomic_store(&latency_samples_count, 0);
+      atomic_store(&retries_count, 0);
+
+      long long started_ns = get_bench_timestamp_ns();
+
+      for (int i = 0; i < threads_count; i += 1) {
+        pthread_create(&threads[i], NULL, run_producer, NULL);
+      }
+
+      bool is_served = run_dispatcher(EXPECTED_CALLS_COUNT);
+
+      for (int i = 0; i < threads_count; i += 1) {
+        pthread_join(threads[i], NULL);
+      }
+
+      if (!is_served) {
+        fprintf(stderr, "Error(%s() function at %d): a command failed\n",
+                __func__, __LINE__);
+        return 1;
+      }
+
+      long long elapsed_ns = get_bench_timestamp_ns() - started_ns;
+
+      if ((atomic_load(&bench_calls_count) != EXPECTED_CALLS_COUNT) ||
+          (default_scheduler.task_count != 0)) {
+        fprintf(stderr, "Error(%s() function at %d): %llu callbacks called\n",
+                __func__, __LINE__, atomic_load(&bench_calls_count));
+        return 1;
+      }
+
+      printf("%10s %8d %14.2f %14.2f %14.2f %10lld\n",
+             mode == RING_SUBMIT ? "ring" : "mutex", threads_count,
+             (double)EXPECTED_CALLS_COUNT * RATIO_SEC_MS / elapsed_ns,
+             (double)atomic_load(&latency_sum_ns) /
+                 atomic_load(&latency_samples_count) / RATIO_SEC_MS,
+             (double)atomic_load(&latency_max_ns) / RATIO_SEC_MS,
+             atomic_load(&retries_count));
+    }
+  }
+
+  return 0;
+}
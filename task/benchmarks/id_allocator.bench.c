@@ -0,0 +1,144 @@
+/**
+ *  @note Benchmark of the id storage ( @see{TASK_ID_ALLOCATOR} ): cost (ns)
+ *  per get_id of the filling (the first call links the whole free list) and
+ *  per free_id + get_id pair of the churn (BENCH_CHURN_BATCH random ids of
+ *  the filled ones are freed and got back) for 50, 64k and 1M ids, bytes per
+ *  id of the storage.
+ *
+ *  @note Sizes greater than @link{MAX_TASK_QUANTITY} are skipped, build with
+ *  e.g. BENCH_FLAGS='-DTASK_CAPACITY=1000000' to run them.
+ *
+ *  Usage
+ *  BENCH_FLAGS='-DTASK_CAPACITY=1000000' \
+ *    ./build_benchmarks_gcc.sh id_allocator && ./benchmarks/id_allocator_bench
+ *  BENCH_FLAGS='-DTASK_CAPACITY=1000000
+ *    -DTASK_ID_ALLOCATOR=TASK_ID_ALLOCATOR_BITMAP' \
+ *    ./build_benchmarks_gcc.sh id_allocator && ./benchmarks/id_allocator_bench
+ *  BENCH_FLAGS='-DTASK_CAPACITY=1000000
+ *    -DTASK_ID_ALLOCATOR=TASK_ID_ALLOCATOR_ATOMIC_BITMAP' \
+ *    ./build_benchmarks_gcc.sh id_allocator && ./benchmarks/id_allocator_bench
+ *
+ */
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+enum Bench_id_allocator_variables {
+  BENCH_CHURN_ROUNDS = 20'000, /**< churn batches per size */
+  BENCH_CHURN_BATCH = 64,      /**< ids freed and got back per batch */
+};
+
+static const long long BENCH_SIZES[] = {50, 65'536, 1'000'000};
+
+static Scheduler bench_scheduler = SCHEDULER_INITIALIZER;
+static TASK_COUNTER bench_ids[MAX_TASK_QUANTITY] = {0};
+static unsigned int bench_seed = 42;
+
+/**
+ *  @brief Utility function (encapsulated) to get pseudo random index in range
+ *  [0; size) (linear congruential generator)
+ *
+ */
+static long long get_bench_index(long long size) {
+  bench_seed = bench_seed * 1'103'515'245U + 12'345U;
+
+  return (long long)(((unsigned long long)bench_seed << 16 ^
+                      bench_seed >> 16) %
+                     (unsigned long long)size);
+}
+
+/**
+ *  @brief Utility function (encapsulated) to shuffle the first @link{size}
+ *  ids of the @link{bench_ids} (Fisher-Yates)
+ *
+ */
+static void shuffle_bench_ids(long long size) {
+  for (long long i = size - 1; i > 0; i -= 1) {
+    long long j = get_bench_index(i + 1);
+    TASK_COUNTER temp = bench_ids[i];
+    bench_ids[i] = bench_ids[j];
+    bench_ids[j] = temp;
+  }
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get current timestamp (ns)
+ *
+ */
+static long long get_bench_timestamp_ns(void) {
+  struct timespec ts = {};
+  timespec_get(&ts, TIME_UTC);
+
+  return (long long)ts.tv_sec * RATIO_SEC_NANOSEC + ts.tv_nsec;
+}
+
+int main(void) {
+#if TASK_ID_ALLOCATOR == TASK_ID_ALLOCATOR_BITMAP
+  printf("id allocator: hierarchical bitmap\n");
+#elif TASK_ID_ALLOCATOR == TASK_ID_ALLOCATOR_ATOMIC_BITMAP
+  printf("id allocator: atomic hierarchical bitmap\n");
+#else
+  printf("id allocator: free list\n");
+#endif
+  printf("%10s %14s %14s %12s\n", "ids", "fill ns/id", "churn ns/id",
+         "bytes/id");
+
+  for (size_t s = 0; s < sizeof(BENCH_SIZES) / sizeof(BENCH_SIZES[0]); s += 1) {
+    long long size = BENCH_SIZES[s];
+
+    if (size > MAX_TASK_QUANTITY) {
+      printf("%10lld %14s (TASK_CAPACITY = %d)\n", size, "skipped",
+             MAX_TASK_QUANTITY);
+      continue;
+    }
+
+    // the fresh (zeroed) storage per size
+    memset(&bench_scheduler.ids, 0, sizeof(bench_scheduler.ids));
+
+    long long started_ns = get_bench_timestamp_ns();
+    for (long long i = 0; i < size; i += 1) {
+      bench_ids[i] = get_id(&bench_scheduler).handle_id_result.ID_VALUE;
+    }
+    long long fill_ns = get_bench_timestamp_ns() - started_ns;
+
+    // free the random ids of the filled ones (the distinct slots of the
+    // shuffled ids) and get them back
+    shuffle_bench_ids(size);
+
+    long long churn_ns = 0;
+    long long batch_size = size < BENCH_CHURN_BATCH ? size : BENCH_CHURN_BATCH;
+
+    for (int round = 0; round < BENCH_CHURN_ROUNDS; round += 1) {
+      long long offset = get_bench_index(size - batch_size + 1);
+
+      started_ns = get_bench_timestamp_ns();
+      for (long long b = offset; b < offset + batch_size; b += 1) {
+        free_id(&bench_scheduler, bench_ids[b]);
+      }
+      for (long long b = offset; b < offset + batch_size; b += 1) {
+        bench_ids[b] = get_id(&bench_scheduler).handle_id_result.ID_VALUE;
+      }
+      churn_ns += get_bench_timestamp_ns() - started_ns;
+    }
+
+    // the ids are got back => the next id is the first one after the filled
+    // ones (none for the full storage)
+    PROMISE_ID_VALUE log_next_id = get_id(&bench_scheduler);
+
+    if ((size == MAX_TASK_QUANTITY)
+            ? (log_next_id.type != ERROR_CODE)
+            : (log_next_id.handle_id_result.ID_VALUE != size)) {
+      fprintf(stderr, "Error(%s() function at %d): the ids are lost\n",
+              __func__, __LINE__);
+      return 1;
+    }
+
+    printf("%10lld %14.2f %14.2f %12.2f\n", size, (double)fill_ns / size,
+           (double)churn_ns / ((double)batch_size * BENCH_CHURN_ROUNDS),
+           (double)sizeof(ID_STORAGE) / MAX_TASK_QUANTITY);
+  }
+
+  return 0;
+}
@@ -0,0 +1,248 @@
+/**
+ *  @note Overload benchmark of the full queue policies and the admission
+ *  control ( @see{set_overload_policy_in} ) on the simulated clock (the
+ *  opened clock tick): the tasks with the pseudo random delays in range
+ *  [0; BENCH_MAX_DELAY] ms arrive at the pseudo random moments,
+ *  BENCH_LOAD_PERCENT % of what the loop serves (every callback takes
+ *  BENCH_SERVICE_US us of the simulated time), BENCH_SIMULATED_TIME ms. Per
+ *  policy prints the accepted / refused / evicted tasks, the lateness (the
+ *  serving moment minus created + delay) percentiles of the served ones and
+ *  the cost (ns) of the register call (the refused ones too):
+ *  - reject: the full queue refuses the new task (the default)
+ *  - evict: the task with the latest deadline is shed for the earlier one
+ *  - block: the registering serves the expired tasks till a slot frees
+ *    (inside the opened tick nothing is waited for), the producer's next
+ *    task arrives after that (backpressure)
+ *  - admission: reject + no new tasks the late loop would serve more than
+ *    BENCH_MAX_LATENESS ms after their deadlines
+ *
+ *  Usage
+ *  BENCH_FLAGS='-DTASK_CAPACITY=1000' ./build_benchmarks_gcc.sh overload &&
+ *  ./benchmarks/overload_bench
+ *
+ */
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+enum Bench_overload_variables {
+  BENCH_SERVICE_US = 100,            /**< simulated time (us) per callback */
+  BENCH_LOAD_PERCENT = 130,          /**< offered load, % of the served one */
+  BENCH_MAX_DELAY = 10,              /**< max delay (ms) of the tasks */
+  BENCH_MAX_LATENESS = 20,           /**< admission limit (ms) */
+  BENCH_SIMULATED_TIME = 2'000,      /**< simulated time (ms) per policy */
+  BENCH_LATENESS_BUCKETS = 100'000,  /**< lateness histogram (0.1 ms) */
+  BENCH_SEQUENCE_MASK = 0xFFFF,      /**< ring of the requested deadlines */
+  BENCH_START_TICKS = 1'000'000'000, /**< simulated start timestamp (ns) */
+  BENCH_NANOSEC_USEC = 1'000,        /**< for converting us => ns */
+  BENCH_LATENESS_UNIT = 100'000,     /**< ns per histogram bucket */
+};
+
+static const char *BENCH_POLICY_NAMES[] = {"reject", "evict", "block",
+                                           "admission"};
+static const OVERLOAD_POLICY BENCH_POLICIES[] = {
+    {.full_queue_policy = TASK_FULL_QUEUE_REJECT},
+    {.full_queue_policy = TASK_FULL_QUEUE_EVICT_FURTHEST},
+    {.full_queue_policy = TASK_FULL_QUEUE_BLOCK,
+     .block_timeout_ms = HANDLE_WAIT_FOREVER},
+    {.full_queue_policy = TASK_FULL_QUEUE_REJECT,
+     .max_lateness_ms = BENCH_MAX_LATENESS},
+};
+
+typedef struct s_Bench_overload_result {
+  long long accepted_count; /**< registered tasks */
+  long long served_count;   /**< served tasks */
+  long long register_ns;    /**< time (ns) of the register calls */
+} BENCH_OVERLOAD_RESULT;
+
+static Scheduler bench_scheduler = SCHEDULER_INITIALIZER;
+static unsigned long long bench_seed = 42;
+static BENCH_OVERLOAD_RESULT bench_result = {};
+static TASK_TICKS bench_requested_ticks[BENCH_SEQUENCE_MASK + 1] = {};
+static long long bench_lateness_histogram[BENCH_LATENESS_BUCKETS + 1] = {};
+
+/**
+ *  @brief Utility function (encapsulated) to get pseudo random number in
+ *  range [0; limit] (64-bit linear congruential generator)
+ *
+ */
+static long long get_bench_random(long long limit) {
+  bench_seed = bench_seed * 6'364'136'223'846'793'005ULL + 1ULL;
+
+  return (long long)((bench_seed >> 33) % (unsigned long long)(limit + 1));
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get current timestamp (ns)
+ *
+ */
+static long long get_bench_timestamp_ns(void) {
+  struct timespec ts = {};
+  timespec_get(&ts, TIME_UTC);
+
+  return (long long)ts.tv_sec * RATIO_SEC_NANOSEC + ts.tv_nsec;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get the simulated clock
+ *
+ */
+static TASK_TICKS get_bench_now(void) {
+  return bench_scheduler.clock.cached_now_ticks;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to move the simulated clock of the
+ *  @link{bench_scheduler} to @link{now_ticks}
+ *
+ */
+static void set_bench_now(TASK_TICKS now_ticks) {
+  bench_scheduler.clock =
+      (CLOCK_TICK){.cached_now_ticks = now_ticks, .is_tick_opened = true};
+}
+
+/**
+ *  @brief Bench callback: saves the lateness of the task @link{arg} (its'
+ *  ring slot) to the histogram and spends BENCH_SERVICE_US us of the
+ *  simulated time
+ *
+ */
+static void serving_callback(unsigned short arg) {
+  long long bucket = (get_bench_now() - bench_requested_ticks[arg]) /
+                     BENCH_LATENESS_UNIT;
+
+  bench_lateness_histogram[bucket < BENCH_LATENESS_BUCKETS
+                               ? bucket
+                               : BENCH_LATENESS_BUCKETS] += 1;
+  bench_result.served_count += 1;
+
+  set_bench_now(get_bench_now() +
+                (TASK_TICKS)BENCH_SERVICE_US * BENCH_NANOSEC_USEC);
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get the lateness (ms) of the
+ *  @link{percent} percentile from the histogram
+ *
+ */
+static double get_bench_lateness_percentile(double percent) {
+  long long rank = (long long)((bench_result.served_count - 1) * percent /
+                               100.0);
+  long long seen_count = 0;
+
+  for (long long i = 0; i <= BENCH_LATENESS_BUCKETS; i += 1) {
+    seen_count += bench_lateness_histogram[i];
+
+    if (seen_count > rank) {
+      return (double)i * BENCH_LATENESS_UNIT / RATIO_NANOSEC_MSEC;
+    }
+  }
+
+  return (double)BENCH_LATENESS_BUCKETS * BENCH_LATENESS_UNIT /
+         RATIO_NANOSEC_MSEC;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to register the task arrived now
+ *
+ */
+static void register_bench_task(void) {
+  TASK_DELAY delay = get_bench_random(BENCH_MAX_DELAY);
+  const TASK_TICKS ARRIVAL_TICKS = get_bench_now();
+  unsigned short arg =
+      (unsigned short)(bench_result.accepted_count & BENCH_SEQUENCE_MASK);
+
+  // the blocking registration may serve the tasks, so the deadline is saved
+  // before (the slot is reused only after BENCH_SEQUENCE_MASK + 1 tasks)
+  bench_requested_ticks[arg] = ARRIVAL_TICKS + delay * RATIO_NANOSEC_MSEC;
+
+  long long started_ns = get_bench_timestamp_ns();
+  PROMISE_TASK_ID log_id =
+      register_task_in(&bench_scheduler, serving_callback, arg, delay);
+  bench_result.register_ns += get_bench_timestamp_ns() - started_ns;
+
+  if (log_id.type == SUCCESS) {
+    bench_result.accepted_count += 1;
+  }
+}
+
+/**
+ *  @brief Utility function (encapsulated) to run the loop with the overload
+ *  policy @link{policy}: register the arrived tasks, serve one ready task
+ *  (the callback moves the clock) or jump to the next arrival / deadline
+ *
+ */
+static void run_bench_loop(OVERLOAD_POLICY policy) {
+  const TASK_TICKS FINISH_TICKS =
+      BENCH_START_TICKS + (TASK_TICKS)BENCH_SIMULATED_TIME * RATIO_NANOSEC_MSEC;
+  const long long MEAN_TICKS = (long long)BENCH_SERVICE_US *
+                               BENCH_NANOSEC_USEC * 100 / BENCH_LOAD_PERCENT;
+
+  init_scheduler(&bench_scheduler);
+  set_overload_policy_in(&bench_scheduler, policy);
+  memset(&bench_result, 0, sizeof(bench_result));
+  memset(bench_lateness_histogram, 0, sizeof(bench_lateness_histogram));
+  set_bench_now(BENCH_START_TICKS);
+
+  TASK_TICKS next_arrival_ticks =
+      BENCH_START_TICKS + get_bench_random(2 * MEAN_TICKS);
+
+  while (get_bench_now() < FINISH_TICKS) {
+    while ((next_arrival_ticks <= get_bench_now()) &&
+           (get_bench_now() < FINISH_TICKS)) {
+      const TASK_TICKS REGISTERED_TICKS = get_bench_now();
+      register_bench_task();
+
+      // the blocking registration moves the clock (it serves the tasks), i.e.
+      // the producer is slowed down: its' next task arrives after it
+      if (get_bench_now() > REGISTERED_TICKS) {
+        next_arrival_ticks = get_bench_now();
+      }
+
+      next_arrival_ticks += get_bench_random(2 * MEAN_TICKS);
+    }
+
+    PROMISE_RUN_READY_TASKS log_run =
+        run_ready_tasks_in(&bench_scheduler, (RUN_BUDGET){.max_tasks = 1});
+    RUN_READY_TASKS_REPORT report = log_run.run_ready_tasks_result.REPORT;
+
+    // nothing is ready => jump to the next arrival / deadline
+    if (report.RAN_COUNT == 0) {
+      set_bench_now(report.NEXT_DEADLINE_TICKS < next_arrival_ticks
+                        ? report.NEXT_DEADLINE_TICKS
+                        : next_arrival_ticks);
+    }
+  }
+}
+
+int main(void) {
+  const size_t POLICIES_QUANTITY =
+      sizeof(BENCH_POLICIES) / sizeof(BENCH_POLICIES[0]);
+
+  printf("capacity %d, load %d %%, %d us per task, delays [0; %d] ms, "
+         "admission %d ms, %d ms\n",
+         MAX_TASK_QUANTITY, BENCH_LOAD_PERCENT, BENCH_SERVICE_US,
+         BENCH_MAX_DELAY, BENCH_MAX_LATENESS, BENCH_SIMULATED_TIME);
+  printf("%10s %9s %9s %9s %9s %9s %9s %12s\n", "policy", "accepted",
+         "refused", "evicted", "p50 ms", "p99 ms", "max ms", "ns/register");
+
+  for (size_t i = 0; i < POLICIES_QUANTITY; i += 1) {
+    run_bench_loop(BENCH_POLICIES[i]);
+
+    const unsigned long long REFUSED_COUNT =
+        bench_scheduler.overload.rejected_count;
+
+    printf("%10s %9lld %9llu %9llu %9.1f %9.1f %9.1f %12.1f\n",
+           BENCH_POLICY_NAMES[i], bench_result.accepted_count, REFUSED_COUNT,
+           bench_scheduler.overload.evicted_count,
+           get_bench_lateness_percentile(50),
+           get_bench_lateness_percentile(99),
+           get_bench_lateness_percentile(100),
+           (double)bench_result.register_ns /
+               (bench_result.accepted_count + REFUSED_COUNT));
+  }
+
+  return 0;
+}
@@ -0,0 +1,264 @@
+/**
+ *  @note Benchmark of the packed deadlines layout (structure of arrays, @see{
+ *  TASK_QUEUE_BACKEND_PACKED_DEADLINES} ) vs the array of @type{Task} (array
+ *  of structures) for 50, 512 and 4096 tasks:
+ *  - expiry scan - ns per task to get the bitmaps of the expired deadlines
+ *    (half of them are expired) via Task.deadline_ticks of the AoS vs
+ *    @link{get_expired_deadlines_mask} of the packed deadlines
+ *  - earliest scan - ns per task to get the index of the least deadline
+ *  - queue drain - ns per task of the run_ready_tasks draining the expired
+ *    half of the queue of the compiled backend (sizes greater than
+ *    @link{MAX_TASK_QUANTITY} are skipped)
+ *
+ *  Usage
+ *  BENCH_FLAGS='-DTASK_CAPACITY=4096' \
+ *    ./build_benchmarks_gcc.sh packed_deadlines && \
+ *    ./benchmarks/packed_deadlines_bench
+ *  BENCH_FLAGS='-DTASK_CAPACITY=4096 -march=native
+ *    -DTASK_QUEUE_BACKEND=TASK_QUEUE_BACKEND_PACKED_DEADLINES' \
+ *    ./build_benchmarks_gcc.sh packed_deadlines && \
+ *    ./benchmarks/packed_deadlines_bench
+ *
+ */
+
+// nanosleep() declaration for the strict -std=c23 builds
+#define _POSIX_C_SOURCE 200809L
+
+#include <limits.h>
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+enum Bench_packed_deadlines_variables {
+  BENCH_MAX_SIZE = 4'096,     /**< max quantity of the scanned deadlines */
+  BENCH_SCAN_ROUNDS = 20'000, /**< scans per size */
+  BENCH_DRAIN_ROUNDS = 50,    /**< queue drains per size */
+  BENCH_DELAY = 1,            /**< delay (ms) of the expired half */
+  BENCH_FAR_DELAY = 60'000,   /**< delay (ms) of the pending half */
+};
+
+static const long long BENCH_SIZES[] = {50, 512, 4'096};
+
+static Task aos_tasks[BENCH_MAX_SIZE] = {0};
+static _Alignas(64) TASK_TICKS packed_deadlines[BENCH_MAX_SIZE] = {0};
+static TASK_HANDLE bench_ids[MAX_TASK_QUANTITY] = {0};
+static unsigned int bench_seed = 42;
+static volatile unsigned long long bench_sink = 0;
+
+/**
+ *  @brief Utility function (encapsulated) to get pseudo random deadline (ns)
+ *  in range [0; 2 * 10 ** 9) (linear congruential generator)
+ *
+ */
+static TASK_TICKS get_bench_deadline(void) {
+  bench_seed = bench_seed * 1'103'515'245U + 12'345U;
+
+  return (TASK_TICKS)(bench_seed >> 1) % (2 * RATIO_SEC_NANOSEC);
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get current timestamp (ns)
+ *
+ */
+static long long get_bench_timestamp_ns(void) {
+  struct timespec ts = {};
+  timespec_get(&ts, TIME_UTC);
+
+  return (long long)ts.tv_sec * RATIO_SEC_NANOSEC + ts.tv_nsec;
+}
+
+static void noop_callback(unsigned short arg) {
+  (void)arg;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get the bitmaps of the expired
+ *  deadlines of the AoS (the same as @link{get_expired_deadlines_mask} does
+ *  for the packed ones)
+ *
+ */
+static unsigned long long scan_aos_expired(long long size,
+                                           TASK_TICKS current_ticks) {
+  unsigned long long expired_count = 0;
+
+  for (long long block = 0; block < size; block += 64) {
+    uint64_t expired_mask = 0;
+
+    for (long long i = block; (i < size) && (i < block + 64); i += 1) {
+      expired_mask |= (uint64_t)(aos_tasks[i].deadline_ticks <= current_ticks)
+                      << (i - block);
+    }
+
+    expired_count += (unsigned long long)__builtin_popcountll(expired_mask);
+  }
+
+  return expired_count;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get the bitmaps of the expired
+ *  packed deadlines
+ *
+ */
+static unsigned long long scan_packed_expired(long long size,
+                                              TASK_TICKS current_ticks) {
+  unsigned long long expired_count = 0;
+
+  for (long long block = 0; block < size; block += 64) {
+    size_t quantity = size - block < 64 ? (size_t)(size - block) : 64;
+
+    expired_count += (unsigned long long)__builtin_popcountll(
+        get_expired_deadlines_mask(&packed_deadlines[block], quantity,
+                                   current_ticks));
+  }
+
+  return expired_count;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get the index of the least
+ *  deadline of the AoS
+ *
+ */
+static long long scan_aos_earliest(long long size) {
+  long long earliest_index = 0;
+
+  for (long long i = 1; i < size; i += 1) {
+    if (aos_tasks[i].deadline_ticks <
+        aos_tasks[earliest_index].deadline_ticks) {
+      earliest_index = i;
+    }
+  }
+
+  return earliest_index;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to time the queue drain: register
+ *  @link{size} tasks (the half expires in BENCH_DELAY ms), wait and drain the
+ *  expired half via run_ready_tasks, remove the rest
+ *
+ *  @return {long long} - time (ns) of the drains or -1 on error
+ *
+ */
+static long long time_queue_drain(long long size) {
+  long long drain_ns = 0;
+
+  for (int round = 0; round < BENCH_DRAIN_ROUNDS; round += 1) {
+    begin_clock_tick();
+    for (long long i = 0; i < size; i += 1) {
+      bench_ids[i] = register_task_ex(noop_callback, 0,
+                                      i % 2 == 0 ? BENCH_DELAY
+                                                 : BENCH_FAR_DELAY)
+                         .register_task_result.TASK_ID;
+    }
+    end_clock_tick();
+
+    nanosleep(
+        &(struct timespec){.tv_nsec = 2 * BENCH_DELAY * RATIO_NANOSEC_MSEC},
+        NULL);
+
+    long long started_ns = get_bench_timestamp_ns();
+    size_t ran_count = run_ready_tasks((RUN_BUDGET){})
+                           .run_ready_tasks_result.REPORT.RAN_COUNT;
+    drain_ns += get_bench_timestamp_ns() - started_ns;
+
+    if (ran_count != (size_t)(size + 1) / 2) {
+      fprintf(stderr, "Error(%s() function at %d): %zu tasks drained\n",
+              __func__, __LINE__, ran_count);
+      return -1;
+    }
+
+    for (long long i = 1; i < size; i += 2) {
+      remove_task(bench_ids[i]);
+    }
+  }
+
+  return drain_ns;
+}
+
+int main(void) {
+#if TASK_QUEUE_BACKEND == TASK_QUEUE_BACKEND_SORTED_ARRAY
+  printf("backend: sorted array (qsort)\n");
+#elif TASK_QUEUE_BACKEND == TASK_QUEUE_BACKEND_TIMING_WHEEL
+  printf("backend: hierarchical timing wheel\n");
+#elif TASK_QUEUE_BACKEND == TASK_QUEUE_BACKEND_PACKED_DEADLINES
+  printf("backend: packed deadlines (SoA)\n");
+#else
+  printf("backend: binary min-heap\n");
+#endif
+#if defined(__AVX2__)
+  printf("expiry scan: AVX2\n");
+#elif defined(__SSE4_2__)
+  printf("expiry scan: SSE4.2\n");
+#else
+  printf("expiry scan: scalar\n");
+#endif
+  printf("%8s %12s %12s %12s %12s %16s\n", "tasks", "AoS exp ns", "SoA exp ns",
+         "AoS min ns", "SoA min ns", "drain ns/task");
+
+  for (long long i = 0; i < BENCH_MAX_SIZE; i += 1) {
+    aos_tasks[i].deadline_ticks = get_bench_deadline();
+    packed_deadlines[i] = aos_tasks[i].deadline_ticks;
+  }
+
+  // the half of the deadlines is expired
+  const TASK_TICKS CURRENT_TICKS = RATIO_SEC_NANOSEC;
+
+  for (size_t s = 0; s < sizeof(BENCH_SIZES) / sizeof(BENCH_SIZES[0]); s += 1) {
+    long long size = BENCH_SIZES[s];
+    const double SCANNED = (double)size * BENCH_SCAN_ROUNDS;
+
+    long long started_ns = get_bench_timestamp_ns();
+    for (int round = 0; round < BENCH_SCAN_ROUNDS; round += 1) {
+      bench_sink += scan_aos_expired(size, CURRENT_TICKS + round);
+    }
+    long long aos_expired_ns = get_bench_timestamp_ns() - started_ns;
+
+    started_ns = get_bench_timestamp_ns();
+    for (int round = 0; round < BENCH_SCAN_ROUNDS; round += 1) {
+      bench_sink += scan_packed_expired(size, CURRENT_TICKS + round);
+    }
+    long long packed_expired_ns = get_bench_timestamp_ns() - started_ns;
+
+    started_ns = get_bench_timestamp_ns();
+    for (int round = 0; round < BENCH_SCAN_ROUNDS; round += 1) {
+      aos_tasks[round % size].deadline_ticks -= 1;
+      bench_sink += (unsigned long long)scan_aos_earliest(size);
+    }
+    long long aos_earliest_ns = get_bench_timestamp_ns() - started_ns;
+
+    started_ns = get_bench_timestamp_ns();
+    for (int round = 0; round < BENCH_SCAN_ROUNDS; round += 1) {
+      packed_deadlines[round % size] -= 1;
+      bench_sink += get_earliest_deadline_index(packed_deadlines, (size_t)size);
+    }
+    long long packed_earliest_ns = get_bench_timestamp_ns() - started_ns;
+
+    printf("%8lld %12.2f %12.2f %12.2f %12.2f", size,
+           (double)aos_expired_ns / SCANNED,
+           (double)packed_expired_ns / SCANNED,
+           (double)aos_earliest_ns / SCANNED,
+           (double)packed_earliest_ns / SCANNED);
+
+    if (size > MAX_TASK_QUANTITY) {
+      printf(" %16s (TASK_CAPACITY = %d)\n", "skipped", MAX_TASK_QUANTITY);
+      continue;
+    }
+
+    long long drain_ns = time_queue_drain(size);
+
+    if ((drain_ns < 0) || (default_scheduler.task_count != 0)) {
+      fprintf(stderr, "Error(%s() function at %d): %lld tasks left\n",
+              __func__, __LINE__, (long long)default_scheduler.task_count);
+      return 1;
+    }
+
+    printf(" %16.1f\n",
+           (double)drain_ns / ((double)(size + 1) / 2 * BENCH_DRAIN_ROUNDS));
+  }
+
+  return 0;
+}
@@ -0,0 +1,217 @@
+/**
+ *  @note Drift benchmark of the periodic tasks ( @see{register_periodic_task}
+ *  ) vs the self re-registering one-shot task (the callback registers the
+ *  next one with the same delay, e.g. @link{show_task_info} workload) vs the
+ *  self requeuing one ( @see{requeue_current_task_in} ). The
+ *  clock is simulated (the opened clock tick, @see{begin_clock_tick_in}):
+ *  BENCH_PERIODS periods of BENCH_PERIOD ms, every one is served with the
+ *  pseudo random lateness in range [0; BENCH_MAX_LATENESS_NS). Prints the
+ *  drift (the deadline of the last period minus the ideal one), the max
+ *  deadline drift and the cost (ns) per period of the scheduler calls, then
+ *  the calls of the overdue task (the loop stalled for BENCH_STALL_PERIODS)
+ *  per catch-up policy. The rest of the queue (MAX_TASK_QUANTITY - 2 tasks)
+ *  is filled with the background tasks beyond the end of the loop, so the
+ *  queue moves of the task cost as in the loaded scheduler.
+ *
+ *  Usage
+ *  ./build_benchmarks_gcc.sh periodic && ./benchmarks/periodic_bench
+ *  or with the loaded queue, e.g. -DTASK_CAPACITY=100000
+ *
+ */
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+enum Bench_periodic_variables {
+  BENCH_PERIODS = 1'000'000,         /**< served periods per loop */
+  BENCH_PERIOD = 1,                  /**< period (ms) */
+  BENCH_MAX_LATENESS_NS = 200'000,   /**< max lateness (ns) of the serving */
+  BENCH_STALL_PERIODS = 5,           /**< missed periods of the stall */
+  BENCH_START_TICKS = 1'000'000'000, /**< simulated start timestamp (ns) */
+  BENCH_BACKGROUND_DELAY = 2'000'000, /**< min delay (ms) of the background */
+};
+
+typedef enum {
+  PERIODIC_TASK,
+  REREGISTERED_TASK,
+  REQUEUED_TASK
+} BENCH_TASK_KIND;
+
+static Scheduler bench_scheduler = SCHEDULER_INITIALIZER;
+static unsigned int bench_seed = 42;
+static long long bench_calls_count = 0;
+static TASK_HANDLE bench_handle = 0;
+
+/**
+ *  @brief Utility function (encapsulated) to get pseudo random lateness (ns)
+ *  in range [0; BENCH_MAX_LATENESS_NS) (linear congruential generator)
+ *
+ */
+static TASK_TICKS get_bench_lateness(void) {
+  bench_seed = bench_seed * 1'103'515'245U + 12'345U;
+
+  return (TASK_TICKS)(bench_seed >> 8) % BENCH_MAX_LATENESS_NS;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get current timestamp (ns)
+ *
+ */
+static long long get_bench_timestamp_ns(void) {
+  struct timespec ts = {};
+  timespec_get(&ts, TIME_UTC);
+
+  return (long long)ts.tv_sec * RATIO_SEC_NANOSEC + ts.tv_nsec;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to move the simulated clock of the
+ *  @link{bench_scheduler} to @link{now_ticks}
+ *
+ */
+static void set_bench_now(TASK_TICKS now_ticks) {
+  bench_scheduler.clock =
+      (CLOCK_TICK){.cached_now_ticks = now_ticks, .is_tick_opened = true};
+}
+
+static void periodic_callback(unsigned short arg) {
+  (void)arg;
+  bench_calls_count += 1;
+}
+
+static void requeuing_callback(unsigned short arg) {
+  (void)arg;
+  bench_calls_count += 1;
+  requeue_current_task_in(&bench_scheduler, BENCH_PERIOD);
+}
+
+static void reregistering_callback(unsigned short arg) {
+  bench_calls_count += 1;
+  bench_handle = register_task_in(&bench_scheduler, reregistering_callback,
+                                  arg, BENCH_PERIOD)
+                     .register_task_result.TASK_ID;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to serve BENCH_PERIODS periods of
+ *  the task of the @link{kind} and print its' drift and cost
+ *
+ *  @return {int} - 0 => done, 1 => error
+ *
+ */
+static int run_bench_periods(BENCH_TASK_KIND kind) {
+  set_bench_now(BENCH_START_TICKS);
+  bench_calls_count = 0;
+
+  PROMISE_TASK_ID log_id =
+      kind == PERIODIC_TASK
+          ? register_periodic_task_in(&bench_scheduler, periodic_callback, 0,
+                                      BENCH_PERIOD, BENCH_PERIOD,
+                                      TASK_CATCH_UP_SKIP)
+          : register_task_in(&bench_scheduler,
+                             kind == REQUEUED_TASK ? requeuing_callback
+                                                   : reregistering_callback,
+                             0, BENCH_PERIOD);
+
+  if (log_id.type == ERROR_CODE) {
+    fprintf(stderr, "Error(%s() function at %d): %d\n", __func__, __LINE__,
+            log_id.register_task_result.CODES_RESULT);
+    return 1;
+  }
+
+  bench_handle = log_id.register_task_result.TASK_ID;
+
+  long long drift_max_ns = 0;
+  long long scheduler_ns = 0;
+  TASK_TICKS deadline_ticks = 0;
+
+  for (long long n = 1; n <= BENCH_PERIODS; n += 1) {
+    deadline_ticks = task_queue_get_next_deadline(&bench_scheduler);
+
+    long long drift_ns =
+        deadline_ticks - (BENCH_START_TICKS + n * BENCH_PERIOD *
+                                                  RATIO_NANOSEC_MSEC);
+    drift_max_ns = drift_ns > drift_max_ns ? drift_ns : drift_max_ns;
+
+    set_bench_now(deadline_ticks + get_bench_lateness());
+
+    long long started_ns = get_bench_timestamp_ns();
+    run_ready_tasks_in(&bench_scheduler, (RUN_BUDGET){});
+    scheduler_ns += get_bench_timestamp_ns() - started_ns;
+  }
+
+  if (bench_calls_count != BENCH_PERIODS) {
+    fprintf(stderr, "Error(%s() function at %d): %lld calls\n", __func__,
+            __LINE__, bench_calls_count);
+    return 1;
+  }
+
+  printf("%-14s %16lld %16lld %16.1f\n",
+         kind == PERIODIC_TASK       ? "periodic"
+         : kind == REQUEUED_TASK     ? "requeued"
+                                     : "re-registered",
+         deadline_ticks - (BENCH_START_TICKS + (long long)BENCH_PERIODS *
+                                                   BENCH_PERIOD *
+                                                   RATIO_NANOSEC_MSEC),
+         drift_max_ns, (double)scheduler_ns / BENCH_PERIODS);
+
+  // the periodic and requeued tasks are never freed, the re-registered one
+  // is pending
+  remove_task_in(&bench_scheduler, bench_handle);
+
+  return 0;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get the calls of the periodic
+ *  task of the @link{catch_up_policy} served once after the stall of
+ *  BENCH_STALL_PERIODS + 0.5 periods
+ *
+ */
+static long long get_bench_stall_calls(
+    enum Task_catch_up_policies catch_up_policy) {
+  set_bench_now(BENCH_START_TICKS);
+  bench_calls_count = 0;
+
+  TASK_HANDLE handle =
+      register_periodic_task_in(&bench_scheduler, periodic_callback, 0,
+                                BENCH_PERIOD, BENCH_PERIOD, catch_up_policy)
+          .register_task_result.TASK_ID;
+
+  set_bench_now(BENCH_START_TICKS +
+                (BENCH_STALL_PERIODS * 2 + 1) * BENCH_PERIOD *
+                    RATIO_NANOSEC_MSEC / 2);
+  run_ready_tasks_in(&bench_scheduler, (RUN_BUDGET){});
+  remove_task_in(&bench_scheduler, handle);
+
+  return bench_calls_count;
+}
+
+int main(void) {
+  set_bench_now(BENCH_START_TICKS);
+
+  for (long long n = 0; n < MAX_TASK_QUANTITY - 2; n += 1) {
+    register_task_in(&bench_scheduler, periodic_callback, 0,
+                     BENCH_BACKGROUND_DELAY + get_bench_lateness());
+  }
+
+  printf("%d periods of %d ms, lateness [0; %d) ns, %d background tasks\n",
+         BENCH_PERIODS, BENCH_PERIOD, BENCH_MAX_LATENESS_NS,
+         (int)bench_scheduler.task_count);
+  printf("%-14s %16s %16s %16s\n", "task", "drift ns", "max drift ns",
+         "ns/period");
+
+  if ((run_bench_periods(PERIODIC_TASK) != 0) ||
+      (run_bench_periods(REREGISTERED_TASK) != 0) ||
+      (run_bench_periods(REQUEUED_TASK) != 0)) {
+    return 1;
+  }
+
+  printf("stall of %d.5 periods => calls: skip %lld, burst %lld\n",
+         BENCH_STALL_PERIODS, get_bench_stall_calls(TASK_CATCH_UP_SKIP),
+         get_bench_stall_calls(TASK_CATCH_UP_BURST));
+
+  return 0;
+}
@@ -0,0 +1,304 @@
+/**
+ *  @note Overload benchmark of the priority classes (
+ *  @see{run_priority_ready_tasks_in} ) on the simulated clock (the opened
+ *  clock ticks): BENCH_CLASSES classes get the one-shot tasks with the pseudo
+ *  random delays in range [0; BENCH_MAX_DELAY] ms at the pseudo random
+ *  moments: BENCH_BURST_PERCENT % of what the loop serves (every callback
+ *  takes BENCH_SERVICE_US us of the simulated time) for the first
+ *  BENCH_BURST_TIME ms of every BENCH_CYCLE_TIME ms (the overload burst),
+ *  BENCH_CALM_PERCENT % the rest of the cycle, BENCH_SIMULATED_TIME ms. Per
+ *  dispatch mode and class prints the served / rejected (the class' queue is
+ *  full) / left tasks and the lateness (the serving moment minus created +
+ *  delay) percentiles:
+ *  - one queue: all the classes in one deadline queue (earliest deadline
+ *    first whatever the class)
+ *  - strict: the highest class first ( @see{PriorityScheduler}, aging_ms 0)
+ *  - aging: the same with BENCH_AGING ms aging (the late task is promoted
+ *    one class per BENCH_AGING ms)
+ *
+ *  Usage
+ *  BENCH_FLAGS='-DTASK_CAPACITY=10000' ./build_benchmarks_gcc.sh
+ *  priority_classes && ./benchmarks/priority_classes_bench
+ *
+ */
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+#if TASK_PRIORITY_CLASSES < 3
+#error "the benchmark needs 3 priority classes at least"
+#endif
+
+enum Bench_priority_classes_variables {
+  BENCH_CLASSES = 3,                 /**< used priority classes */
+  BENCH_SERVICE_US = 100,            /**< simulated time (us) per callback */
+  BENCH_BURST_PERCENT = 150,         /**< load of the burst, % of the served */
+  BENCH_CALM_PERCENT = 50,           /**< load of the rest of the cycle, % */
+  BENCH_BURST_TIME = 200,            /**< burst (ms) per cycle */
+  BENCH_CYCLE_TIME = 500,            /**< cycle (ms) of the load */
+  BENCH_MAX_DELAY = 10,              /**< max delay (ms) of the tasks */
+  BENCH_AGING = 50,                  /**< aging (ms) of the "aging" mode */
+  BENCH_SIMULATED_TIME = 2'000,      /**< simulated time (ms) per mode */
+  BENCH_LATENESS_BUCKETS = 100'000,  /**< lateness histogram (0.1 ms) */
+  BENCH_SEQUENCE_MASK = 0x3FFF,      /**< ring of the requested deadlines */
+  BENCH_START_TICKS = 1'000'000'000, /**< simulated start timestamp (ns) */
+  BENCH_NANOSEC_USEC = 1'000,        /**< for converting us => ns */
+  BENCH_LATENESS_UNIT = 100'000,     /**< ns per histogram bucket */
+};
+
+/**
+ *  @brief share (%) of the offered load per class, class 0 is the highest
+ *
+ */
+static const int BENCH_CLASS_SHARES[BENCH_CLASSES] = {20, 30, 50};
+
+enum Bench_priority_modes {
+  BENCH_MODE_ONE_QUEUE = 0, /**< all the classes in one deadline queue */
+  BENCH_MODE_STRICT = 1,    /**< strict priorities */
+  BENCH_MODE_AGING = 2,     /**< priorities with the aging */
+};
+
+static const char *BENCH_MODE_NAMES[] = {"one queue", "strict", "aging"};
+
+typedef struct s_Bench_class_result {
+  long long served_count;   /**< served tasks */
+  long long rejected_count; /**< registering failed (the queue is full) */
+  long long sequence;       /**< registered tasks i.e. the next ring slot */
+} BENCH_CLASS_RESULT;
+
+static PriorityScheduler bench_scheduler;
+static unsigned long long bench_seed = 42;
+static TASK_TICKS bench_now_ticks = BENCH_START_TICKS;
+static BENCH_CLASS_RESULT bench_results[BENCH_CLASSES] = {};
+static TASK_TICKS bench_requested_ticks[BENCH_CLASSES]
+                                       [BENCH_SEQUENCE_MASK + 1] = {};
+static long long bench_lateness_histogram[BENCH_CLASSES]
+                                         [BENCH_LATENESS_BUCKETS + 1] = {};
+
+/**
+ *  @brief Utility function (encapsulated) to get pseudo random number in
+ *  range [0; limit] (64-bit linear congruential generator)
+ *
+ */
+static long long get_bench_random(long long limit) {
+  bench_seed = bench_seed * 6'364'136'223'846'793'005ULL + 1ULL;
+
+  return (long long)((bench_seed >> 33) % (unsigned long long)(limit + 1));
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get current timestamp (ns)
+ *
+ */
+static long long get_bench_timestamp_ns(void) {
+  struct timespec ts = {};
+  timespec_get(&ts, TIME_UTC);
+
+  return (long long)ts.tv_sec * RATIO_SEC_NANOSEC + ts.tv_nsec;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to move the simulated clock of all
+ *  the classes to @link{now_ticks}
+ *
+ */
+static void set_bench_now(TASK_TICKS now_ticks) {
+  bench_now_ticks = now_ticks;
+
+  for (int i = 0; i < TASK_PRIORITY_CLASSES; i += 1) {
+    bench_scheduler.classes[i].clock =
+        (CLOCK_TICK){.cached_now_ticks = now_ticks, .is_tick_opened = true};
+  }
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get pseudo random interval (ns)
+ *  till the next task of the class @link{class_index} arrived at
+ *  @link{arrival_ticks}: uniform in range [0; 2 * mean], the mean is set by
+ *  the offered load of the moment of the cycle and the class' share of it
+ *
+ */
+static TASK_TICKS get_bench_interval_ticks(int class_index,
+                                           TASK_TICKS arrival_ticks) {
+  const bool IS_BURST =
+      (arrival_ticks - BENCH_START_TICKS) %
+          ((TASK_TICKS)BENCH_CYCLE_TIME * RATIO_NANOSEC_MSEC) <
+      (TASK_TICKS)BENCH_BURST_TIME * RATIO_NANOSEC_MSEC;
+  const long long MEAN_TICKS =
+      (long long)BENCH_SERVICE_US * BENCH_NANOSEC_USEC * 100 * 100 /
+      ((IS_BURST ? BENCH_BURST_PERCENT : BENCH_CALM_PERCENT) *
+       BENCH_CLASS_SHARES[class_index]);
+
+  return get_bench_random(2 * MEAN_TICKS);
+}
+
+/**
+ *  @brief Bench callback: saves the lateness of the task @link{arg} (the
+ *  class in the high bits, the ring slot in the low ones) to the class'
+ *  histogram and spends BENCH_SERVICE_US us of the simulated time
+ *
+ */
+static void serving_callback(unsigned short arg) {
+  int class_index = arg >> 14;
+  long long lateness_ticks =
+      bench_now_ticks -
+      bench_requested_ticks[class_index][arg & BENCH_SEQUENCE_MASK];
+  long long bucket = lateness_ticks / BENCH_LATENESS_UNIT;
+
+  bench_lateness_histogram[class_index][bucket < BENCH_LATENESS_BUCKETS
+                                            ? bucket
+                                            : BENCH_LATENESS_BUCKETS] += 1;
+  bench_results[class_index].served_count += 1;
+
+  set_bench_now(bench_now_ticks +
+                (TASK_TICKS)BENCH_SERVICE_US * BENCH_NANOSEC_USEC);
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get the lateness (ms) of the
+ *  @link{percent} percentile from the class' histogram
+ *
+ */
+static double get_bench_lateness_percentile(int class_index, double percent) {
+  long long served_count = bench_results[class_index].served_count;
+  long long rank = (long long)((served_count - 1) * percent / 100.0);
+  long long seen_count = 0;
+
+  for (long long i = 0; i <= BENCH_LATENESS_BUCKETS; i += 1) {
+    seen_count += bench_lateness_histogram[class_index][i];
+
+    if (seen_count > rank) {
+      return (double)i * BENCH_LATENESS_UNIT / RATIO_NANOSEC_MSEC;
+    }
+  }
+
+  return (double)BENCH_LATENESS_BUCKETS * BENCH_LATENESS_UNIT /
+         RATIO_NANOSEC_MSEC;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to register the task of the class
+ *  @link{class_index} at the current simulated moment (to the class 0 queue
+ *  for the one queue mode)
+ *
+ */
+static void register_bench_task(int class_index,
+                                enum Bench_priority_modes mode) {
+  BENCH_CLASS_RESULT *ptr_result = &bench_results[class_index];
+  TASK_DELAY delay = get_bench_random(BENCH_MAX_DELAY);
+  unsigned short arg = (unsigned short)((class_index << 14) |
+                                        (ptr_result->sequence &
+                                         BENCH_SEQUENCE_MASK));
+
+  PROMISE_TASK_ID log_id = register_priority_task_in(
+      &bench_scheduler, mode == BENCH_MODE_ONE_QUEUE ? 0 : class_index,
+      serving_callback, arg, delay);
+
+  if (log_id.type == ERROR_CODE) {
+    ptr_result->rejected_count += 1;
+    return;
+  }
+
+  bench_requested_ticks[class_index][ptr_result->sequence &
+                                     BENCH_SEQUENCE_MASK] =
+      bench_now_ticks + delay * RATIO_NANOSEC_MSEC;
+  ptr_result->sequence += 1;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to run the loop of the mode
+ *  @link{mode}: register the arrived tasks, serve one ready task (the
+ *  callback moves the clock) or jump to the next arrival / deadline
+ *
+ *  @return {long long} - time (ns) of the scheduler calls
+ *
+ */
+static long long run_bench_loop(enum Bench_priority_modes mode) {
+  const TASK_TICKS FINISH_TICKS =
+      BENCH_START_TICKS + (TASK_TICKS)BENCH_SIMULATED_TIME * RATIO_NANOSEC_MSEC;
+  TASK_TICKS next_arrival_ticks[BENCH_CLASSES] = {};
+  long long scheduler_ns = 0;
+
+  init_priority_scheduler(&bench_scheduler,
+                          mode == BENCH_MODE_AGING ? BENCH_AGING : 0);
+  memset(bench_results, 0, sizeof(bench_results));
+  memset(bench_lateness_histogram, 0, sizeof(bench_lateness_histogram));
+  set_bench_now(BENCH_START_TICKS);
+
+  for (int i = 0; i < BENCH_CLASSES; i += 1) {
+    next_arrival_ticks[i] =
+        BENCH_START_TICKS + get_bench_interval_ticks(i, BENCH_START_TICKS);
+  }
+
+  while (bench_now_ticks < FINISH_TICKS) {
+    const TASK_TICKS NOW_TICKS = bench_now_ticks;
+    TASK_TICKS next_ticks = FINISH_TICKS;
+
+    for (int i = 0; i < BENCH_CLASSES; i += 1) {
+      while (next_arrival_ticks[i] <= NOW_TICKS) {
+        set_bench_now(next_arrival_ticks[i]);
+        register_bench_task(i, mode);
+        next_arrival_ticks[i] +=
+            get_bench_interval_ticks(i, next_arrival_ticks[i]);
+      }
+
+      if (next_arrival_ticks[i] < next_ticks) {
+        next_ticks = next_arrival_ticks[i];
+      }
+    }
+
+    set_bench_now(NOW_TICKS);
+
+    long long started_ns = get_bench_timestamp_ns();
+    PROMISE_RUN_READY_TASKS log_run = run_priority_ready_tasks_in(
+        &bench_scheduler, (RUN_BUDGET){.max_tasks = 1});
+    scheduler_ns += get_bench_timestamp_ns() - started_ns;
+
+    RUN_READY_TASKS_REPORT report = log_run.run_ready_tasks_result.REPORT;
+
+    // nothing is ready => jump to the next arrival / deadline
+    if (report.RAN_COUNT == 0) {
+      set_bench_now(report.NEXT_DEADLINE_TICKS < next_ticks
+                        ? report.NEXT_DEADLINE_TICKS
+                        : next_ticks);
+    }
+  }
+
+  return scheduler_ns;
+}
+
+int main(void) {
+  printf("%d classes (shares %d/%d/%d %%), load %d %% for %d ms of %d ms "
+         "else %d %%, %d us per task, delays [0; %d] ms, aging %d ms, %d ms\n",
+         BENCH_CLASSES, BENCH_CLASS_SHARES[0], BENCH_CLASS_SHARES[1],
+         BENCH_CLASS_SHARES[2], BENCH_BURST_PERCENT, BENCH_BURST_TIME,
+         BENCH_CYCLE_TIME, BENCH_CALM_PERCENT, BENCH_SERVICE_US,
+         BENCH_MAX_DELAY, BENCH_AGING, BENCH_SIMULATED_TIME);
+  printf("%10s %6s %8s %9s %8s %10s %10s %10s %8s\n", "mode", "class",
+         "served", "rejected", "left", "p50 ms", "p99 ms", "max ms",
+         "ns/task");
+
+  for (int mode = 0; mode < 3; mode += 1) {
+    long long scheduler_ns = run_bench_loop(mode);
+    long long served_count = 0;
+
+    for (int i = 0; i < BENCH_CLASSES; i += 1) {
+      served_count += bench_results[i].served_count;
+    }
+
+    for (int i = 0; i < BENCH_CLASSES; i += 1) {
+      printf("%10s %6d %8lld %9lld %8lld %10.1f %10.1f %10.1f %8.1f\n",
+             BENCH_MODE_NAMES[mode], i, bench_results[i].served_count,
+             bench_results[i].rejected_count,
+             bench_results[i].sequence - bench_results[i].served_count,
+             get_bench_lateness_percentile(i, 50),
+             get_bench_lateness_percentile(i, 99),
+             get_bench_lateness_percentile(i, 100),
+             (double)scheduler_ns / served_count);
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,154 @@
+/**
+ *  @note Burst drain benchmark: register the queue full of tasks expiring at
+ *  the same moment, wait till they're expired and drain them via the loop of
+ *  get_callback (one controller call, clock reading and Task copy per task)
+ *  vs get_ready_tasks (one call per BENCH_BATCH_SIZE tasks) vs
+ *  run_ready_tasks (the callbacks are called in place, no copy), print ns
+ *  per task. One capacity per build, e.g.
+ *
+ *  Usage
+ *  BENCH_FLAGS="-DTASK_CAPACITY=10000" ./build_benchmarks_gcc.sh ready_tasks \
+ *    && ./benchmarks/ready_tasks_bench
+ *
+ */
+
+// nanosleep() declaration for the strict -std=c23 builds
+#define _POSIX_C_SOURCE 200809L
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+enum Bench_ready_tasks_variables {
+  BENCH_DELAY = 1,        /**< delay (ms) of the burst */
+  BENCH_ROUNDS = 20,      /**< bursts per drain variant */
+  BENCH_BATCH_SIZE = 256, /**< buffer of the get_ready_tasks */
+};
+
+typedef enum {
+  GET_CALLBACK_LOOP,
+  GET_READY_TASKS_LOOP,
+  RUN_READY_TASKS_CALL,
+  BENCH_DRAINS_QUANTITY
+} BENCH_DRAIN;
+
+static unsigned long long bench_calls_count = 0;
+
+static void counting_callback(unsigned short arg) {
+  bench_calls_count += arg;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get current timestamp (ns)
+ *
+ */
+static long long get_bench_timestamp_ns(void) {
+  struct timespec ts = {};
+  timespec_get(&ts, TIME_UTC);
+
+  return (long long)ts.tv_sec * RATIO_SEC_NANOSEC + ts.tv_nsec;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to register the burst (the same
+ *  deadline for all the tasks) and sleep till it's expired
+ *
+ */
+static void register_burst(void) {
+  begin_clock_tick();
+  for (long long i = 0; i < MAX_TASK_QUANTITY; i += 1) {
+    register_task_ex(counting_callback, 1, BENCH_DELAY);
+  }
+  end_clock_tick();
+
+  nanosleep(
+      &(struct timespec){.tv_nsec = 2 * BENCH_DELAY * RATIO_NANOSEC_MSEC},
+      NULL);
+}
+
+/**
+ *  @brief Utility function (encapsulated) to drain the burst via the given
+ *  variant and call the callbacks
+ *
+ *  @return {long long} - time (ns) of the drain
+ *
+ */
+static long long drain_burst(BENCH_DRAIN drain) {
+  static Task ready_tasks[BENCH_BATCH_SIZE];
+
+  long long started_ns = get_bench_timestamp_ns();
+
+  if (drain == GET_CALLBACK_LOOP) {
+    PROMISE_TASK log_task = get_callback();
+
+    while (log_task.type == SUCCESS) {
+      get_task_callback(&log_task.get_callback_result.TASK)(
+          log_task.get_callback_result.TASK.func_arg);
+      log_task = get_callback();
+    }
+  } else if (drain == GET_READY_TASKS_LOOP) {
+    size_t ready_count = 0;
+
+    do {
+      ready_count = get_ready_tasks(ready_tasks, BENCH_BATCH_SIZE)
+                        .get_ready_tasks_result.READY_COUNT;
+
+      for (size_t i = 0; i < ready_count; i += 1) {
+        get_task_callback(&ready_tasks[i])(ready_tasks[i].func_arg);
+      }
+    } while (ready_count == BENCH_BATCH_SIZE);
+  } else {
+    run_ready_tasks((RUN_BUDGET){});
+  }
+
+  return get_bench_timestamp_ns() - started_ns;
+}
+
+int main(void) {
+#if TASK_QUEUE_BACKEND == TASK_QUEUE_BACKEND_SORTED_ARRAY
+  printf("backend: sorted array (qsort)\n");
+#elif TASK_QUEUE_BACKEND == TASK_QUEUE_BACKEND_TIMING_WHEEL
+  printf("backend: hierarchical timing wheel\n");
+#elif TASK_QUEUE_BACKEND == TASK_QUEUE_BACKEND_PACKED_DEADLINES
+  printf("backend: packed deadlines (SoA)\n");
+#else
+  printf("backend: binary min-heap\n");
+#endif
+
+  printf("%10s %24s %24s %24s\n", "burst", "get_callback ns/task",
+         "get_ready_tasks ns/task", "run_ready_tasks ns/task");
+
+  long long drain_ns[BENCH_DRAINS_QUANTITY] = {};
+
+  for (int round = 0; round < BENCH_ROUNDS; round += 1) {
+    for (int drain = GET_CALLBACK_LOOP; drain < BENCH_DRAINS_QUANTITY;
+         drain += 1) {
+      register_burst();
+      drain_ns[drain] += drain_burst(drain);
+
+      if (default_scheduler.task_count != 0) {
+        fprintf(stderr, "Error(%s() function at %d): %lld tasks left\n",
+                __func__, __LINE__, (long long)default_scheduler.task_count);
+        return 1;
+      }
+    }
+  }
+
+  if (bench_calls_count !=
+      1ULL * BENCH_DRAINS_QUANTITY * BENCH_ROUNDS * MAX_TASK_QUANTITY) {
+    fprintf(stderr, "Error(%s() function at %d): %llu callbacks called\n",
+            __func__, __LINE__, bench_calls_count);
+    return 1;
+  }
+
+  printf("%10d %24.1f %24.1f %24.1f\n", MAX_TASK_QUANTITY,
+         (double)drain_ns[GET_CALLBACK_LOOP] / BENCH_ROUNDS /
+             MAX_TASK_QUANTITY,
+         (double)drain_ns[GET_READY_TASKS_LOOP] / BENCH_ROUNDS /
+             MAX_TASK_QUANTITY,
+         (double)drain_ns[RUN_READY_TASKS_CALL] / BENCH_ROUNDS /
+             MAX_TASK_QUANTITY);
+
+  return 0;
+}
@@ -0,0 +1,151 @@
+/**
+ *  @note Ready latency benchmark of the scheduler's file descriptor (
+ *  @see{get_scheduler_fd} ) in the epoll loop with thousands of concurrent
+ *  timers: the lateness (the callback's moment minus the deadline) of the
+ *  timerfd readiness + @link{scheduler_dispatch_ready} vs the epoll_wait()
+ *  timeout counted from the earliest deadline (ms resolution). Linux only.
+ *
+ *  Usage
+ *  BENCH_FLAGS="-DTASK_CAPACITY=4096" ./build_benchmarks_gcc.sh scheduler_fd \
+ *    && ./benchmarks/scheduler_fd_bench
+ *
+ *  @note The timers' quantity is limited by the @link{TASK_CAPACITY}.
+ *
+ */
+
+#include <sys/epoll.h>
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+enum Bench_scheduler_fd_variables {
+  BENCH_TIMERS_QUANTITY = 4'096, /**< concurrent timers (at most) */
+  BENCH_MAX_DELAY = 2'000,       /**< max delay (ms) of the timers */
+};
+
+typedef enum { TIMERFD_LOOP, EPOLL_TIMEOUT_LOOP } BENCH_LOOP;
+
+static unsigned int bench_seed = 42;
+static TASK_TICKS bench_deadlines[BENCH_TIMERS_QUANTITY] = {0};
+static long long bench_lateness_ns[BENCH_TIMERS_QUANTITY] = {0};
+static int bench_fired_count = 0;
+
+/**
+ *  @brief Utility function (encapsulated) to get pseudo random delay (ms) in
+ *  range [1; BENCH_MAX_DELAY] (linear congruential generator)
+ *
+ */
+static TASK_DELAY get_bench_delay(void) {
+  bench_seed = bench_seed * 1'103'515'245U + 12'345U;
+
+  return 1 + (bench_seed >> 16) % BENCH_MAX_DELAY;
+}
+
+/**
+ *  @brief The timer's callback: save the lateness of the timer @link{arg}
+ *
+ */
+static void lateness_callback(unsigned short arg) {
+  bench_lateness_ns[bench_fired_count] =
+      get_now_ticks().handle_clock_result.TICKS - bench_deadlines[arg];
+  bench_fired_count += 1;
+}
+
+static int compare_lateness(const void *a, const void *b) {
+  long long lhs = *(const long long *)a;
+  long long rhs = *(const long long *)b;
+
+  return (lhs > rhs) - (lhs < rhs);
+}
+
+/**
+ *  @brief Utility function (encapsulated) to register the timers (one clock
+ *  reading for all, so the deadlines are known) and serve them via the given
+ *  loop
+ *
+ */
+static void run_timers(BENCH_LOOP loop, int timers_quantity) {
+  int epoll_fd = epoll_create1(0);
+  int scheduler_fd = -1;
+  long long wakeups_count = 0;
+  long long spurious_count = 0;
+
+  bench_fired_count = 0;
+
+  TASK_TICKS now_ticks = begin_clock_tick().handle_clock_result.TICKS;
+  for (int i = 0; i < timers_quantity; i += 1) {
+    TASK_DELAY delay = get_bench_delay();
+
+    bench_deadlines[i] = now_ticks + (TASK_TICKS)delay * RATIO_NANOSEC_MSEC;
+    register_task_ex(lateness_callback, (unsigned short)i, delay);
+  }
+  end_clock_tick();
+
+  if (loop == TIMERFD_LOOP) {
+    scheduler_fd = get_scheduler_fd().scheduler_fd_result.FD;
+    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, scheduler_fd,
+              &(struct epoll_event){.events = EPOLLIN});
+  }
+
+  while (bench_fired_count < timers_quantity) {
+    struct epoll_event event = {};
+    int timeout_ms = -1;
+
+    if (loop == EPOLL_TIMEOUT_LOOP) {
+      // ceil to ms => never earlier than the deadline
+      TASK_TICKS remaining_ticks =
+          task_queue_get_next_deadline(&default_scheduler) -
+          get_now_ticks().handle_clock_result.TICKS;
+      timeout_ms =
+          remaining_ticks <= 0
+              ? 0
+              : (int)((remaining_ticks + RATIO_NANOSEC_MSEC - 1) /
+                      RATIO_NANOSEC_MSEC);
+    }
+
+    epoll_wait(epoll_fd, &event, 1, timeout_ms);
+    wakeups_count += 1;
+
+    PROMISE_SCHEDULER_FD log_dispatch = scheduler_dispatch_ready();
+    if (log_dispatch.scheduler_fd_result.DISPATCHED_COUNT == 0) {
+      spurious_count += 1;
+    }
+  }
+
+  if (loop == TIMERFD_LOOP) {
+    close_scheduler_fd();
+  }
+  close(epoll_fd);
+
+  qsort(bench_lateness_ns, timers_quantity, sizeof(long long),
+        compare_lateness);
+
+  long long lateness_sum_ns = 0;
+  for (int i = 0; i < timers_quantity; i += 1) {
+    lateness_sum_ns += bench_lateness_ns[i];
+  }
+
+  printf("%-14s %8d %8lld %9lld %10.1f %10.1f %10.1f %10.1f\n",
+         loop == TIMERFD_LOOP ? "timerfd" : "epoll timeout", timers_quantity,
+         wakeups_count, spurious_count,
+         (double)lateness_sum_ns / timers_quantity / 1'000,
+         (double)bench_lateness_ns[timers_quantity / 2] / 1'000,
+         (double)bench_lateness_ns[timers_quantity * 99 / 100] / 1'000,
+         (double)bench_lateness_ns[timers_quantity - 1] / 1'000);
+}
+
+int main(void) {
+  int timers_quantity = (int)MAX_TASK_QUANTITY < (int)BENCH_TIMERS_QUANTITY
+                            ? (int)MAX_TASK_QUANTITY
+                            : (int)BENCH_TIMERS_QUANTITY;
+
+  printf("%-14s %8s %8s %9s %10s %10s %10s %10s\n", "loop", "timers",
+         "wakeups", "spurious", "mean us", "p50 us", "p99 us", "max us");
+
+  run_timers(TIMERFD_LOOP, timers_quantity);
+  run_timers(EPOLL_TIMEOUT_LOOP, timers_quantity);
+
+  return 0;
+}
@@ -0,0 +1,126 @@
+/**
+ *  @note Multi-threaded scaling benchmark: every thread registers the batches
+ *  of the zero-delay tasks and runs them via run_ready_tasks, 1 to 64
+ *  threads, print the throughput (M tasks/s). Build it twice to compare the
+ *  shard per thread (no locks) vs one global scheduler behind the mutex (the
+ *  only safe way without the shards), e.g.
+ *
+ *  Usage
+ *  BENCH_FLAGS="-DTASK_SHARDED=1 -DTASK_CAPACITY=1024" \
+ *    ./build_benchmarks_gcc.sh shards && ./benchmarks/shards_bench
+ *  BENCH_FLAGS="-DTASK_CAPACITY=1024" ./build_benchmarks_gcc.sh shards \
+ *    && ./benchmarks/shards_bench
+ *
+ */
+
+// clock_gettime() declaration for the strict -std=c23 builds
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+enum Bench_shards_variables {
+  BENCH_MAX_THREADS = 64,           /**< max threads quantity */
+  BENCH_TASKS_PER_THREAD = 200'000, /**< registered + run per thread */
+  BENCH_BATCH_SIZE = 64,            /**< tasks per run_ready_tasks call */
+};
+
+#if !TASK_SHARDED
+static pthread_mutex_t queue_mutex = PTHREAD_MUTEX_INITIALIZER;
+#endif
+
+static atomic_ullong bench_calls_count = 0;
+
+static void counting_callback(unsigned short arg) {
+  (void)arg;
+  atomic_fetch_add_explicit(&bench_calls_count, 1, memory_order_relaxed);
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get current timestamp (ns)
+ *
+ */
+static long long get_bench_timestamp_ns(void) {
+  struct timespec ts = {};
+  timespec_get(&ts, TIME_UTC);
+
+  return (long long)ts.tv_sec * RATIO_SEC_NANOSEC + ts.tv_nsec;
+}
+
+/**
+ *  @brief The benchmark's thread: register the batch, run it, repeat
+ *
+ */
+static void *run_bench_thread(void *arg) {
+  (void)arg;
+
+  for (int done = 0; done < BENCH_TASKS_PER_THREAD;
+       done += BENCH_BATCH_SIZE) {
+#if !TASK_SHARDED
+    pthread_mutex_lock(&queue_mutex);
+#endif
+    for (int i = 0; i < BENCH_BATCH_SIZE; i += 1) {
+      register_task(counting_callback, 0, 0);
+    }
+#if !TASK_SHARDED
+    pthread_mutex_unlock(&queue_mutex);
+#endif
+
+    // the zero-delay batch is ready already (one call drains it)
+#if !TASK_SHARDED
+    pthread_mutex_lock(&queue_mutex);
+#endif
+    run_ready_tasks((RUN_BUDGET){});
+#if !TASK_SHARDED
+    pthread_mutex_unlock(&queue_mutex);
+#endif
+  }
+
+  release_shard();
+
+  return NULL;
+}
+
+int main(void) {
+#if TASK_SHARDED
+  printf("mode: shard per thread (TASK_SHARDED=1)\n");
+#else
+  printf("mode: one global scheduler behind the mutex\n");
+#endif
+  printf("%10s %20s\n", "threads", "M tasks/s");
+
+  pthread_t threads[BENCH_MAX_THREADS];
+
+  for (int threads_count = 1; threads_count <= BENCH_MAX_THREADS;
+       threads_count *= 2) {
+    atomic_store(&bench_calls_count, 0);
+    long long started_ns = get_bench_timestamp_ns();
+
+    for (int i = 0; i < threads_count; i += 1) {
+      pthread_create(&threads[i], NULL, run_bench_thread, NULL);
+    }
+
+    for (int i = 0; i < threads_count; i += 1) {
+      pthread_join(threads[i], NULL);
+    }
+
+    long long elapsed_ns = get_bench_timestamp_ns() - started_ns;
+    unsigned long long calls_count = atomic_load(&bench_calls_count);
+
+    if (calls_count != 1ULL * threads_count * BENCH_TASKS_PER_THREAD) {
+      fprintf(stderr, "Error(%s() function at %d): %llu callbacks called\n",
+              __func__, __LINE__, calls_count);
+      return 1;
+    }
+
+    printf("%10d %20.2f\n", threads_count,
+           (double)calls_count * RATIO_SEC_MS / elapsed_ns);
+  }
+
+  return 0;
+}
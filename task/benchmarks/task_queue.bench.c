@@ -0,0 +1,145 @@
+/**
+ *  @note Benchmark of the Tasks queue backends ( @see{TASK_QUEUE_BACKEND} ):
+ *  cost (ns) per register_task / change_task_delay / remove_task operation
+ *  for 50, 1k, 64k and 1M tasks in the queue. The tasks are removed in the
+ *  random order (the id => index lookup must not depend on the position).
+ *
+ *  @note Sizes greater than @link{MAX_TASK_QUANTITY} are skipped, build with
+ *  e.g. BENCH_FLAGS='-DTASK_CAPACITY=1000000' to run them.
+ *
+ *  Usage
+ *  ./build_benchmarks_gcc.sh task_queue && ./benchmarks/task_queue_bench
+ *  BENCH_FLAGS='-DTASK_QUEUE_BACKEND=TASK_QUEUE_BACKEND_SORTED_ARRAY' \
+ *    ./build_benchmarks_gcc.sh task_queue && ./benchmarks/task_queue_bench
+ *  BENCH_FLAGS='-DTASK_QUEUE_BACKEND=TASK_QUEUE_BACKEND_TIMING_WHEEL' \
+ *    ./build_benchmarks_gcc.sh task_queue && ./benchmarks/task_queue_bench
+ *  BENCH_FLAGS='-DTASK_QUEUE_BACKEND=TASK_QUEUE_BACKEND_PACKED_DEADLINES' \
+ *    ./build_benchmarks_gcc.sh task_queue && ./benchmarks/task_queue_bench
+ *
+ */
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+enum Bench_task_queue_variables {
+  BENCH_MAX_DELAY = 60'000, /**< max delay (ms) of the registered tasks */
+};
+
+static const long long BENCH_SIZES[] = {50, 1'000, 65'536, 1'000'000};
+
+static TASK_HANDLE bench_ids[MAX_TASK_QUANTITY] = {0};
+static unsigned int bench_seed = 42;
+
+/**
+ *  @brief Utility function (encapsulated) to get pseudo random delay (ms) in
+ *  range [1; BENCH_MAX_DELAY] (linear congruential generator)
+ *
+ */
+static unsigned short get_bench_delay(void) {
+  bench_seed = bench_seed * 1'103'515'245U + 12'345U;
+
+  return (unsigned short)(1 + (bench_seed >> 16) % BENCH_MAX_DELAY);
+}
+
+/**
+ *  @brief Utility function (encapsulated) to shuffle the first @link{size}
+ *  handles of the @link{bench_ids} (Fisher-Yates)
+ *
+ */
+static void shuffle_bench_ids(long long size) {
+  for (long long i = size - 1; i > 0; i -= 1) {
+    bench_seed = bench_seed * 1'103'515'245U + 12'345U;
+    long long j = (long long)(((unsigned long long)bench_seed << 16 ^
+                               bench_seed >> 16) %
+                              (unsigned long long)(i + 1));
+    TASK_HANDLE temp = bench_ids[i];
+    bench_ids[i] = bench_ids[j];
+    bench_ids[j] = temp;
+  }
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get current timestamp (ns)
+ *
+ */
+static long long get_bench_timestamp_ns(void) {
+  struct timespec ts = {};
+  timespec_get(&ts, TIME_UTC);
+
+  return (long long)ts.tv_sec * RATIO_SEC_NANOSEC + ts.tv_nsec;
+}
+
+static void noop_callback(unsigned short arg) {
+  (void)arg;
+}
+
+int main(void) {
+#if TASK_QUEUE_BACKEND == TASK_QUEUE_BACKEND_SORTED_ARRAY
+  printf("backend: sorted array (qsort)\n");
+#elif TASK_QUEUE_BACKEND == TASK_QUEUE_BACKEND_TIMING_WHEEL
+  printf("backend: hierarchical timing wheel\n");
+#elif TASK_QUEUE_BACKEND == TASK_QUEUE_BACKEND_PACKED_DEADLINES
+  printf("backend: packed deadlines (SoA)\n");
+#else
+  printf("backend: binary min-heap\n");
+#endif
+  printf("%10s %16s %16s %16s\n", "tasks", "register ns/op", "change ns/op",
+         "remove ns/op");
+
+  // untimed warm-up: the first register_task initializes the id storage
+  // (O(MAX_TASK_QUANTITY)), keep it out of the first row
+  if (remove_task(register_task(noop_callback, 0, get_bench_delay())
+                      .register_task_result.TASK_ID)
+          .type != SUCCESS) {
+    fprintf(stderr, "Error(%s() function at %d): warm-up task not removed\n",
+            __func__, __LINE__);
+    return 1;
+  }
+
+  for (size_t s = 0; s < sizeof(BENCH_SIZES) / sizeof(BENCH_SIZES[0]); s += 1) {
+    long long size = BENCH_SIZES[s];
+
+    if (size > MAX_TASK_QUANTITY) {
+      printf("%10lld %16s (TASK_CAPACITY = %d)\n", size, "skipped",
+             MAX_TASK_QUANTITY);
+      continue;
+    }
+
+    long long started_ns = get_bench_timestamp_ns();
+    for (long long i = 0; i < size; i += 1) {
+      bench_ids[i] =
+          register_task(noop_callback, 0, get_bench_delay())
+              .register_task_result.TASK_ID;
+    }
+    long long register_ns = get_bench_timestamp_ns() - started_ns;
+
+    started_ns = get_bench_timestamp_ns();
+    for (long long i = 0; i < size; i += 1) {
+      change_task_delay(bench_ids[i], get_bench_delay());
+    }
+    long long change_ns = get_bench_timestamp_ns() - started_ns;
+
+    shuffle_bench_ids(size);
+
+    started_ns = get_bench_timestamp_ns();
+    for (long long i = 0; i < size; i += 1) {
+      if (remove_task(bench_ids[i]).type != SUCCESS) {
+        fprintf(stderr, "Error(%s() function at %d): task %lld not removed\n",
+                __func__, __LINE__, (long long)bench_ids[i]);
+        return 1;
+      }
+    }
+    long long remove_ns = get_bench_timestamp_ns() - started_ns;
+
+    printf("%10lld %16.1f %16.1f %16.1f\n", size, (double)register_ns / size,
+           (double)change_ns / size, (double)remove_ns / size);
+
+    if (default_scheduler.task_count != 0) {
+      fprintf(stderr, "Error(%s() function at %d): %lld tasks left\n",
+              __func__, __LINE__, (long long)default_scheduler.task_count);
+      return 1;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,294 @@
+/**
+ *  @note Wakeups benchmark of the timer slack ( @see{register_task_with_slack}
+ *  ): BENCH_TASKS tasks (MAX_TASK_QUANTITY at most) requeue themselves (
+ *  @see{requeue_current_task_in} ) with the pseudo random delays in range
+ *  [1; BENCH_MAX_DELAY] ms, the loop wakes up at the next deadline and
+ *  drains the ready tasks. Per slack prints the wakeups per second, the tasks
+ *  per wakeup, the lateness (the serving moment minus created + delay)
+ *  percentiles and the scheduler's cost per task:
+ *  - simulated: the simulated clock (the opened clock tick), the loop wakes
+ *    exactly at the deadline, BENCH_SIMULATED_TIME ms
+ *  - real: the monotonic clock, the loop sleeps via
+ *    @link{wait_next_deadline_in} (one sleep + wake i.e. two context switches
+ *    per wakeup), prints the voluntary context switches per second too,
+ *    BENCH_REAL_TIME ms
+ *
+ *  Usage
+ *  BENCH_FLAGS='-DTASK_CAPACITY=10000' ./build_benchmarks_gcc.sh timer_slack
+ *  && ./benchmarks/timer_slack_bench
+ *
+ */
+
+// getrusage() declaration for the strict -std=c23 builds
+#define _POSIX_C_SOURCE 200809L
+
+#include <sys/resource.h>
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+enum Bench_timer_slack_variables {
+  BENCH_TASKS = MAX_TASK_QUANTITY < 10'000 ? MAX_TASK_QUANTITY
+                                           : 10'000, /**< requeued tasks */
+  BENCH_REAL_TASKS =
+      BENCH_TASKS < 1'000 ? BENCH_TASKS : 1'000, /**< tasks of the real loop */
+  BENCH_MAX_DELAY = 1'000,           /**< max delay (ms) of the tasks */
+  BENCH_SIMULATED_TIME = 10'000,     /**< simulated time (ms) per slack */
+  BENCH_REAL_TIME = 1'000,           /**< real time (ms) per slack */
+  BENCH_LATENESS_BUCKETS = 100'000,  /**< lateness histogram (us) */
+  BENCH_START_TICKS = 1'000'000'000, /**< simulated start timestamp (ns) */
+  BENCH_NANOSEC_USEC = 1'000,        /**< for converting ns => us */
+};
+
+static const TASK_DELAY BENCH_SLACKS[] = {0, 1, 5, 10, 50};
+
+typedef struct s_Bench_timer_slack_result {
+  long long wakeups_count;  /**< wakeups of the loop */
+  long long served_count;   /**< served tasks */
+  long long scheduler_ns;   /**< time (ns) of the scheduler calls */
+  long long switches_count; /**< voluntary context switches */
+} BENCH_TIMER_SLACK_RESULT;
+
+static Scheduler bench_scheduler = SCHEDULER_INITIALIZER;
+static unsigned int bench_seed = 42;
+static TASK_TICKS bench_requested_ticks[BENCH_TASKS] = {};
+static long long bench_lateness_histogram[BENCH_LATENESS_BUCKETS + 1] = {};
+
+/**
+ *  @brief Utility function (encapsulated) to get pseudo random delay (ms) in
+ *  range [1; BENCH_MAX_DELAY] (linear congruential generator)
+ *
+ */
+static TASK_DELAY get_bench_delay(void) {
+  bench_seed = bench_seed * 1'103'515'245U + 12'345U;
+
+  return 1 + (bench_seed >> 16) % BENCH_MAX_DELAY;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get current timestamp (ns)
+ *
+ */
+static long long get_bench_timestamp_ns(void) {
+  struct timespec ts = {};
+  timespec_get(&ts, TIME_UTC);
+
+  return (long long)ts.tv_sec * RATIO_SEC_NANOSEC + ts.tv_nsec;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get the voluntary context
+ *  switches of the process
+ *
+ */
+static long long get_bench_switches_count(void) {
+  struct rusage usage = {};
+  getrusage(RUSAGE_SELF, &usage);
+
+  return usage.ru_nvcsw;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to move the simulated clock of the
+ *  @link{bench_scheduler} to @link{now_ticks}
+ *
+ */
+static void set_bench_now(TASK_TICKS now_ticks) {
+  bench_scheduler.clock =
+      (CLOCK_TICK){.cached_now_ticks = now_ticks, .is_tick_opened = true};
+}
+
+/**
+ *  @brief Bench callback: saves the lateness of the task @link{arg} to the
+ *  histogram and requeues it with the next pseudo random delay
+ *
+ */
+static void requeuing_callback(unsigned short arg) {
+  TASK_TICKS now_ticks =
+      get_now_ticks_in(&bench_scheduler).handle_clock_result.TICKS;
+  long long lateness_us =
+      (now_ticks - bench_requested_ticks[arg]) / BENCH_NANOSEC_USEC;
+
+  bench_lateness_histogram[lateness_us < BENCH_LATENESS_BUCKETS
+                               ? lateness_us
+                               : BENCH_LATENESS_BUCKETS] += 1;
+
+  TASK_DELAY delay = get_bench_delay();
+  bench_requested_ticks[arg] =
+      now_ticks + (TASK_TICKS)delay * RATIO_NANOSEC_MSEC;
+  requeue_current_task_in(&bench_scheduler, delay);
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get the lateness (us) of the
+ *  @link{percent} percentile from the histogram
+ *
+ */
+static long long get_bench_lateness_percentile(long long served_count,
+                                               double percent) {
+  long long rank = (long long)((served_count - 1) * percent / 100.0);
+  long long seen_count = 0;
+
+  for (long long us = 0; us <= BENCH_LATENESS_BUCKETS; us += 1) {
+    seen_count += bench_lateness_histogram[us];
+
+    if (seen_count > rank) {
+      return us;
+    }
+  }
+
+  return BENCH_LATENESS_BUCKETS;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to register @link{tasks_quantity}
+ *  tasks with the @link{slack} at the pseudo random moments of the first
+ *  millisecond (the simulated clock) or now
+ *
+ *  @return {int} - 0 => done, 1 => error
+ *
+ */
+static int register_bench_tasks(int tasks_quantity, TASK_DELAY slack,
+                                bool is_simulated) {
+  init_scheduler(&bench_scheduler);
+  memset(bench_lateness_histogram, 0, sizeof(bench_lateness_histogram));
+
+  for (int i = 0; i < tasks_quantity; i += 1) {
+    TASK_DELAY delay = get_bench_delay();
+
+    if (is_simulated) {
+      set_bench_now(BENCH_START_TICKS + get_bench_delay() * BENCH_NANOSEC_USEC);
+    }
+
+    PROMISE_TASK_ID log_id = register_task_with_slack_in(
+        &bench_scheduler, requeuing_callback, (unsigned short)i, delay, slack);
+
+    if (log_id.type == ERROR_CODE) {
+      fprintf(stderr, "Error(%s() function at %d): %d\n", __func__, __LINE__,
+              log_id.register_task_result.CODES_RESULT);
+      return 1;
+    }
+
+    bench_requested_ticks[i] =
+        get_now_ticks_in(&bench_scheduler).handle_clock_result.TICKS +
+        (TASK_TICKS)delay * RATIO_NANOSEC_MSEC;
+  }
+
+  return 0;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to run the loop on the simulated
+ *  clock: wake up exactly at the next deadline, drain the ready tasks
+ *
+ */
+static BENCH_TIMER_SLACK_RESULT run_bench_simulated_loop(void) {
+  BENCH_TIMER_SLACK_RESULT result = {};
+  const TASK_TICKS FINISH_TICKS =
+      BENCH_START_TICKS + (TASK_TICKS)BENCH_SIMULATED_TIME * RATIO_NANOSEC_MSEC;
+  TASK_TICKS next_ticks = task_queue_get_next_deadline(&bench_scheduler);
+
+  while (next_ticks <= FINISH_TICKS) {
+    set_bench_now(next_ticks);
+
+    long long started_ns = get_bench_timestamp_ns();
+    PROMISE_RUN_READY_TASKS log_run =
+        run_ready_tasks_in(&bench_scheduler, (RUN_BUDGET){});
+    result.scheduler_ns += get_bench_timestamp_ns() - started_ns;
+
+    result.wakeups_count += 1;
+    result.served_count += log_run.run_ready_tasks_result.REPORT.RAN_COUNT;
+    next_ticks = log_run.run_ready_tasks_result.REPORT.NEXT_DEADLINE_TICKS;
+  }
+
+  return result;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to run the loop on the monotonic
+ *  clock: sleep till the next deadline, drain the ready tasks
+ *
+ */
+static BENCH_TIMER_SLACK_RESULT run_bench_real_loop(void) {
+  BENCH_TIMER_SLACK_RESULT result = {};
+  const long long FINISH_NS = get_bench_timestamp_ns() +
+                              (long long)BENCH_REAL_TIME * RATIO_NANOSEC_MSEC;
+  const long long STARTED_SWITCHES_COUNT = get_bench_switches_count();
+
+  while (get_bench_timestamp_ns() < FINISH_NS) {
+    wait_next_deadline_in(&bench_scheduler, HANDLE_WAIT_FOREVER);
+
+    long long started_ns = get_bench_timestamp_ns();
+    PROMISE_RUN_READY_TASKS log_run =
+        run_ready_tasks_in(&bench_scheduler, (RUN_BUDGET){});
+    result.scheduler_ns += get_bench_timestamp_ns() - started_ns;
+
+    result.wakeups_count += 1;
+    result.served_count += log_run.run_ready_tasks_result.REPORT.RAN_COUNT;
+  }
+
+  result.switches_count = get_bench_switches_count() - STARTED_SWITCHES_COUNT;
+
+  return result;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to print the result of the loop of
+ *  @link{time_ms} ms
+ *
+ */
+static void print_bench_result(TASK_DELAY slack,
+                               BENCH_TIMER_SLACK_RESULT result,
+                               long long time_ms, bool is_simulated) {
+  double seconds = (double)time_ms / RATIO_SEC_MS;
+
+  printf("%8llu %12.0f %10.1f %10lld %10lld %10lld %10.1f", slack,
+         result.wakeups_count / seconds,
+         (double)result.served_count / result.wakeups_count,
+         get_bench_lateness_percentile(result.served_count, 50),
+         get_bench_lateness_percentile(result.served_count, 99),
+         get_bench_lateness_percentile(result.served_count, 100),
+         (double)result.scheduler_ns / result.served_count);
+
+  if (is_simulated) {
+    printf("\n");
+  } else {
+    printf(" %12.0f\n", result.switches_count / seconds);
+  }
+}
+
+int main(void) {
+  const size_t SLACKS_QUANTITY = sizeof(BENCH_SLACKS) / sizeof(BENCH_SLACKS[0]);
+
+  printf("simulated: %d tasks, delays [1; %d] ms, %d ms\n", BENCH_TASKS,
+         BENCH_MAX_DELAY, BENCH_SIMULATED_TIME);
+  printf("%8s %12s %10s %10s %10s %10s %10s\n", "slack ms", "wakeups/s",
+         "tasks/wake", "p50 us", "p99 us", "max us", "ns/task");
+
+  for (size_t i = 0; i < SLACKS_QUANTITY; i += 1) {
+    if (register_bench_tasks(BENCH_TASKS, BENCH_SLACKS[i], true) != 0) {
+      return 1;
+    }
+
+    print_bench_result(BENCH_SLACKS[i], run_bench_simulated_loop(),
+                       BENCH_SIMULATED_TIME, true);
+  }
+
+  printf("real: %d tasks, delays [1; %d] ms, %d ms\n", BENCH_REAL_TASKS,
+         BENCH_MAX_DELAY, BENCH_REAL_TIME);
+  printf("%8s %12s %10s %10s %10s %10s %10s %12s\n", "slack ms", "wakeups/s",
+         "tasks/wake", "p50 us", "p99 us", "max us", "ns/task", "switches/s");
+
+  for (size_t i = 0; i < SLACKS_QUANTITY; i += 1) {
+    if (register_bench_tasks(BENCH_REAL_TASKS, BENCH_SLACKS[i], false) != 0) {
+      return 1;
+    }
+
+    print_bench_result(BENCH_SLACKS[i], run_bench_real_loop(), BENCH_REAL_TIME,
+                       false);
+  }
+
+  return 0;
+}
@@ -0,0 +1,166 @@
+/**
+ *  @note Lateness and CPU usage benchmark of the serving loops: the old
+ *  polling one (get_callback + sleep 100 ms) vs the blocking
+ *  @link{wait_next_deadline}. Serve BENCH_TASKS_QUANTITY tasks with pseudo
+ *  random delays, print mean / max lateness (the serving moment minus the
+ *  deadline), wake ups and CPU time, then the same for the idle second.
+ *
+ *  Usage
+ *  ./build_benchmarks_gcc.sh wait && ./benchmarks/wait_bench
+ *
+ */
+
+// nanosleep() declaration for the strict -std=c23 builds
+#define _POSIX_C_SOURCE 200809L
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+enum Bench_wait_variables {
+  BENCH_TASKS_QUANTITY = 40, /**< tasks served per loop */
+  BENCH_MAX_DELAY = 2'000,   /**< max delay (ms) of the registered tasks */
+  BENCH_POLL_PERIOD = 100,   /**< sleep (ms) of the polling loop */
+  BENCH_IDLE_TIME = 1'000,   /**< time (ms) of the idle case */
+};
+
+typedef enum { POLLING_LOOP, WAITING_LOOP } BENCH_LOOP;
+
+typedef struct s_Bench_wait_result {
+  long long served_count;    /**< served tasks */
+  long long wakeups_count;   /**< wake ups of the loop */
+  long long lateness_sum_ns; /**< sum of the lateness (ns) */
+  long long lateness_max_ns; /**< max lateness (ns) */
+  double cpu_ms;             /**< CPU time (ms) of the process */
+} BENCH_WAIT_RESULT;
+
+static unsigned int bench_seed = 42;
+
+/**
+ *  @brief Utility function (encapsulated) to get pseudo random delay (ms) in
+ *  range [1; BENCH_MAX_DELAY] (linear congruential generator)
+ *
+ */
+static TASK_DELAY get_bench_delay(void) {
+  bench_seed = bench_seed * 1'103'515'245U + 12'345U;
+
+  return 1 + (bench_seed >> 16) % BENCH_MAX_DELAY;
+}
+
+static void noop_callback(unsigned short arg) {
+  (void)arg;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to sleep one period of the polling
+ *  loop (the old @file{task/main.c} way)
+ *
+ */
+static void sleep_poll_period(void) {
+  nanosleep(
+      &(struct timespec){.tv_nsec = BENCH_POLL_PERIOD * RATIO_NANOSEC_MSEC},
+      NULL);
+}
+
+/**
+ *  @brief Utility function (encapsulated) to serve all the ready tasks and
+ *  collect their lateness
+ *
+ */
+static void serve_ready_tasks(BENCH_WAIT_RESULT *ptr_result) {
+  PROMISE_TASK log_task = get_callback();
+
+  while (log_task.type == SUCCESS) {
+    long long lateness_ns = get_now_ticks().handle_clock_result.TICKS -
+                            log_task.get_callback_result.TASK.deadline_ticks;
+
+    ptr_result->served_count += 1;
+    ptr_result->lateness_sum_ns += lateness_ns;
+    if (lateness_ns > ptr_result->lateness_max_ns) {
+      ptr_result->lateness_max_ns = lateness_ns;
+    }
+
+    get_task_callback(&log_task.get_callback_result.TASK)(
+        log_task.get_callback_result.TASK.func_arg);
+    log_task = get_callback();
+  }
+}
+
+/**
+ *  @brief Utility function (encapsulated) to register the tasks and serve them
+ *  via the given loop
+ *
+ */
+static BENCH_WAIT_RESULT run_tasks(BENCH_LOOP loop) {
+  BENCH_WAIT_RESULT result = {};
+
+  for (int i = 0; i < BENCH_TASKS_QUANTITY; i += 1) {
+    register_task_ex(noop_callback, 0, get_bench_delay());
+  }
+
+  clock_t started_clock = clock();
+  while (result.served_count < BENCH_TASKS_QUANTITY) {
+    if (loop == POLLING_LOOP) {
+      sleep_poll_period();
+    } else {
+      wait_next_deadline(HANDLE_WAIT_FOREVER);
+    }
+
+    result.wakeups_count += 1;
+    serve_ready_tasks(&result);
+  }
+  result.cpu_ms =
+      (double)(clock() - started_clock) * RATIO_SEC_MS / CLOCKS_PER_SEC;
+
+  return result;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to stay idle (empty queue) for
+ *  BENCH_IDLE_TIME via the given loop
+ *
+ */
+static BENCH_WAIT_RESULT run_idle(BENCH_LOOP loop) {
+  BENCH_WAIT_RESULT result = {};
+
+  clock_t started_clock = clock();
+  if (loop == POLLING_LOOP) {
+    for (int i = 0; i < BENCH_IDLE_TIME / BENCH_POLL_PERIOD; i += 1) {
+      sleep_poll_period();
+      result.wakeups_count += 1;
+      serve_ready_tasks(&result);
+    }
+  } else {
+    wait_next_deadline(BENCH_IDLE_TIME);
+    result.wakeups_count += 1;
+    serve_ready_tasks(&result);
+  }
+  result.cpu_ms =
+      (double)(clock() - started_clock) * RATIO_SEC_MS / CLOCKS_PER_SEC;
+
+  return result;
+}
+
+static void print_result(const char *name, BENCH_WAIT_RESULT result) {
+  double mean_ms = result.served_count == 0
+                       ? 0.0
+                       : (double)result.lateness_sum_ns / result.served_count /
+                             RATIO_NANOSEC_MSEC;
+
+  printf("%-16s %8lld %8lld %12.3f %12.3f %10.3f\n", name,
+         result.served_count, result.wakeups_count, mean_ms,
+         (double)result.lateness_max_ns / RATIO_NANOSEC_MSEC, result.cpu_ms);
+}
+
+int main(void) {
+  printf("%-16s %8s %8s %12s %12s %10s\n", "loop", "tasks", "wakeups",
+         "late mean ms", "late max ms", "cpu ms");
+
+  print_result("polling", run_tasks(POLLING_LOOP));
+  print_result("wait", run_tasks(WAITING_LOOP));
+  print_result("polling (idle)", run_idle(POLLING_LOOP));
+  print_result("wait (idle)", run_idle(WAITING_LOOP));
+
+  return 0;
+}
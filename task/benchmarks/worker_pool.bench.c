@@ -0,0 +1,149 @@
+/**
+ *  @note Mixed burst benchmark: register the queue full of tasks expiring at
+ *  the same moment, every BENCH_SLOW_EVERY'th callback is slow (blocks for
+ *  BENCH_SLOW_CALLBACK_US, e.g. the I/O), the rest are fast. Drain it via
+ *  run_ready_tasks inline (the dispatcher calls every callback) vs the worker
+ *  pool of 1 to BENCH_MAX_WORKERS workers (the dispatcher pushes, the idle
+ *  workers steal). Print the expiry-to-execution latency (us) percentiles
+ *  of the fast callbacks i.e. the callback's start minus the burst deadline,
+ *  e.g.
+ *
+ *  Usage
+ *  BENCH_FLAGS="-DTASK_CAPACITY=10000" ./build_benchmarks_gcc.sh worker_pool \
+ *    && ./benchmarks/worker_pool_bench
+ *
+ */
+
+// nanosleep(), clock_gettime() declarations for the strict -std=c23 builds
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdatomic.h>
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+enum Bench_worker_pool_variables {
+  BENCH_DELAY = 5,               /**< delay (ms) of the burst */
+  BENCH_ROUNDS = 5,              /**< bursts per variant */
+  BENCH_SLOW_EVERY = 100,        /**< 1% of the callbacks are slow */
+  BENCH_SLOW_CALLBACK_US = 1000, /**< duration of the slow callback */
+  BENCH_MAX_WORKERS = 8,         /**< max workers quantity */
+  BENCH_BURST_SIZE = MAX_TASK_QUANTITY < 65'535 ? MAX_TASK_QUANTITY : 65'535,
+};
+
+static TASK_TICKS burst_deadline_ticks = 0;
+static TASK_TICKS latencies_ns[BENCH_ROUNDS * BENCH_BURST_SIZE];
+static atomic_int calls_count = 0;
+static int latencies_offset = 0; /**< the round's part of @link{latencies_ns} */
+
+/**
+ *  @brief Utility function (encapsulated) to get the monotonic timestamp (ns)
+ *  on any thread (the scheduler's clock tick belongs to the dispatcher)
+ *
+ */
+static TASK_TICKS get_bench_ticks(void) {
+  struct timespec ts = {};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return (TASK_TICKS)ts.tv_sec * RATIO_SEC_NANOSEC + ts.tv_nsec;
+}
+
+static void mixed_callback(unsigned short arg) {
+  latencies_ns[latencies_offset + arg] =
+      get_bench_ticks() - burst_deadline_ticks;
+
+  if (arg % BENCH_SLOW_EVERY == BENCH_SLOW_EVERY - 1) {
+    nanosleep(&(struct timespec){.tv_nsec = BENCH_SLOW_CALLBACK_US * 1'000L},
+              NULL);
+  }
+
+  atomic_fetch_add_explicit(&calls_count, 1, memory_order_release);
+}
+
+static int compare_ticks(const void *ptr_a, const void *ptr_b) {
+  TASK_TICKS a = *(const TASK_TICKS *)ptr_a;
+  TASK_TICKS b = *(const TASK_TICKS *)ptr_b;
+
+  return (a > b) - (a < b);
+}
+
+/**
+ *  @brief Utility function (encapsulated) to drain one burst, the callbacks
+ *  are called inline or on the started workers
+ *
+ */
+static int drain_burst(void) {
+  atomic_store(&calls_count, 0);
+
+  for (int i = 0; i < BENCH_BURST_SIZE; i += 1) {
+    if (register_task_ex(mixed_callback, (unsigned short)i, BENCH_DELAY).type ==
+        ERROR_CODE) {
+      fprintf(stderr, "Error(%s() function at %d): register_task_ex\n",
+              __func__, __LINE__);
+      return 1;
+    }
+  }
+
+  burst_deadline_ticks = task_queue_get_next_deadline(&default_scheduler);
+
+  while (default_scheduler.task_count > 0) {
+    wait_next_deadline(HANDLE_WAIT_FOREVER);
+    run_ready_tasks((RUN_BUDGET){});
+  }
+
+  while (atomic_load_explicit(&calls_count, memory_order_acquire) <
+         BENCH_BURST_SIZE) {
+    nanosleep(&(struct timespec){.tv_nsec = 100'000}, NULL);
+  }
+
+  return 0;
+}
+
+int main(void) {
+  printf("%10s %8s %12s %12s %12s %12s\n", "mode", "workers", "p50 us",
+         "p99 us", "p99.9 us", "max us");
+
+  for (int workers_count = 0; workers_count <= BENCH_MAX_WORKERS;
+       workers_count = workers_count == 0 ? 1 : workers_count * 2) {
+    if ((workers_count > 0) &&
+        ((start_worker_pool(workers_count) !=
+          HANDLE_WORKER_POOL_DONE_SUCCESSFULLY) ||
+         (attach_worker_pool() != HANDLE_WORKER_POOL_DONE_SUCCESSFULLY))) {
+      fprintf(stderr, "Error(%s() function at %d): start_worker_pool\n",
+              __func__, __LINE__);
+      return 1;
+    }
+
+    // only the fast callbacks' latencies are sorted
+    int samples_count = 0;
+
+    for (int round = 0; round < BENCH_ROUNDS; round += 1) {
+      latencies_offset = round * BENCH_BURST_SIZE;
+
+      if (drain_burst() != 0) {
+        return 1;
+      }
+    }
+
+    for (int i = 0; i < BENCH_ROUNDS * BENCH_BURST_SIZE; i += 1) {
+      if ((i % BENCH_BURST_SIZE) % BENCH_SLOW_EVERY != BENCH_SLOW_EVERY - 1) {
+        latencies_ns[samples_count] = latencies_ns[i];
+        samples_count += 1;
+      }
+    }
+
+    stop_worker_pool();
+    qsort(latencies_ns, samples_count, sizeof(TASK_TICKS), compare_ticks);
+
+    printf("%10s %8d %12.1f %12.1f %12.1f %12.1f\n",
+           workers_count == 0 ? "inline" : "pool", workers_count,
+           (double)latencies_ns[samples_count * 50 / 100] / RATIO_SEC_MS,
+           (double)latencies_ns[samples_count * 99 / 100] / RATIO_SEC_MS,
+           (double)latencies_ns[samples_count * 999 / 1000] / RATIO_SEC_MS,
+           (double)latencies_ns[samples_count - 1] / RATIO_SEC_MS);
+  }
+
+  return 0;
+}
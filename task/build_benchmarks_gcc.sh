@@ -0,0 +1,44 @@
+#!/bin/bash
+
+# ---start log---
+printf '⚙️  run "%s"\n' "$0"
+
+# ---exit on any error---
+set -euo pipefail
+
+# ---set cwd as current script's folder---
+# e.g. ./task (cwd relative)
+cd "$(dirname "$0")" || exit 1
+
+# ---variables---
+# folder with benchmarks (each `*.bench.c` file => separate executable)
+BENCHMARKS_FOLDER='benchmarks'
+# optional benchmark name to compile only it (e.g. `task_queue`)
+BENCHMARK_NAME="${1:-}"
+# extra compiler flags, e.g.
+# BENCH_FLAGS='-DTASK_QUEUE_BACKEND=TASK_QUEUE_BACKEND_SORTED_ARRAY'
+read -r -a BENCH_FLAGS <<<"${BENCH_FLAGS:-}"
+# folders for excluding
+EXCLUDE_FOLDERS=('tests' "$BENCHMARKS_FOLDER")
+# get all *c files of the module except of the `main.c` to the array => C_FILES
+mapfile -t C_FILES < <(find . \( -name "${EXCLUDE_FOLDERS[0]}" -o -name "${EXCLUDE_FOLDERS[1]}" \) -prune -o -name "*.c" ! -name "main.c" -type f -print)
+# get all *.bench.c files to the array => BENCH_FILES
+mapfile -t BENCH_FILES < <(find "./$BENCHMARKS_FOLDER" -name "${BENCHMARK_NAME:-*}.bench.c" -type f -print)
+
+# ---check that BENCH_FILES array is not empty---
+if [[ "${#BENCH_FILES[@]}" -eq 0 ]]; then
+  printf '😒 ❌ *.bench.c files are not found in the "%s" folder' "$BENCHMARKS_FOLDER"
+  exit 1
+fi
+
+# ---handle EXIT signal---
+trap 'echo "📜✅ script done"' EXIT
+
+# ---compile *.bench.c files---
+for BENCH_FILE in "${BENCH_FILES[@]}"; do
+  COMPILED_FILE_NAME="$(basename "$BENCH_FILE" .bench.c)_bench"
+  printf '⚗️ ⏳ compiling "%s" ...\n' "$COMPILED_FILE_NAME"
+  gcc -O2 -I. -Wall -std=c23 "${BENCH_FLAGS[@]}" "${C_FILES[@]}" "$BENCH_FILE" -o "./$BENCHMARKS_FOLDER/$COMPILED_FILE_NAME" -lm -pthread
+done
+
+printf '✅ Compilation Succeed\n'
@@ -14,9 +14,9 @@ cd "$(dirname "$0")" || exit 1
 # compiled file name
 COMPILED_FILE_NAME="main"
 # folders for excluding
-EXCLUDE_FOLDERS='tests'
+EXCLUDE_FOLDERS=('tests' 'benchmarks')
 # get all *c files ('\0' separated) to the array => C_FILES
-mapfile -t C_FILES < <(find . -name "$EXCLUDE_FOLDERS" -prune -o -name "*.c" -type f -print)
+mapfile -t C_FILES < <(find . \( -name "${EXCLUDE_FOLDERS[0]}" -o -name "${EXCLUDE_FOLDERS[1]}" \) -prune -o -name "*.c" -type f -print)
 
 # ---check that C_FILES array is not empty---
 if [[ "${#C_FILES[@]}" -eq 0 ]]; then
@@ -26,7 +26,7 @@ fi
 
 # ---compile *.c files---
 printf '⚗️ ⏳ compiling "%s.exe" ...\n' "$COMPILED_FILE_NAME"
-gcc -g -I. -Wall -std=c23 "${C_FILES[@]}" -o "$COMPILED_FILE_NAME"
+gcc -g -I. -Wall -std=c23 "${C_FILES[@]}" -o "$COMPILED_FILE_NAME" -pthread
 
 # ---handle EXIT signal---
 trap 'echo "📜✅ script done"' EXIT
@@ -0,0 +1,116 @@
+#include <stdatomic.h>
+
+#include "../environment/global_variables.h"
+#include "../module_run_tasks_after_delay.h"
+#include "../utilities/utils.h"
+
+/**
+ *  @brief Apply the commands submitted by the other threads to the ring (
+ *  @see{submit_register_task}, @see{submit_remove_task},
+ *  @see{submit_change_task_delay} ) in the submitting order. Call it from the
+ *  dispatcher thread (the one that owns the queue) each tick, e.g. after
+ *  @link{wait_next_deadline}
+ *
+ *  @details Controller like function on top of the controllers (calls them
+ *  directly per command).
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on @callback{pop_task_command}
+ *  - implicit dependency on @callback{register_task_in}
+ *  - implicit dependency on @callback{remove_task_in}
+ *  - implicit dependency on @callback{change_task_delay_in}
+ *
+ *  - mutates the @link{task_count} of the @link{ptr_scheduler}
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the @link{id_storage_array} of the @link{ptr_scheduler}'s ids
+ *  - mutates the @link{ring_head} of the @link{ptr_scheduler}'s commands
+ *
+ *  @note The registering is done via one clock reading for the whole batch
+ *  ( @see{begin_clock_tick_in} ). The handle of the registered task is stored
+ *  to the command's ptr_handle (TASK_COMMAND_HANDLE_FAILED on error).
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {size_t} max_commands - max quantity of the commands to apply, 0
+ *    => all the submitted ones
+ *
+ *  @return {TASK_COMMANDS_REPORT} - @see{TASK_COMMANDS_REPORT}
+ *
+ *  @example
+ *    while (true) {
+ *      wait_next_deadline(HANDLE_WAIT_FOREVER); => wakes up on the commands
+ *      apply_task_commands_in(&default_scheduler, 0);
+ *      run_ready_tasks((RUN_BUDGET){});
+ *    }
+ *
+ */
+TASK_COMMANDS_REPORT apply_task_commands_in(Scheduler *ptr_scheduler,
+                                            size_t max_commands) {
+  TASK_COMMANDS_REPORT report = {};
+  TASK_COMMAND command = {};
+  bool is_tick_began = false;
+
+  while (((max_commands == 0) || (report.APPLIED_COUNT < max_commands)) &&
+         (pop_task_command(ptr_scheduler, &command) ==
+          HANDLE_COMMAND_RING_DONE_SUCCESSFULLY)) {
+    bool is_failed = false;
+
+    switch (command.type) {
+    case TASK_COMMAND_REGISTER: {
+      if (!is_tick_began) {
+        is_tick_began = begin_clock_tick_in(ptr_scheduler).type == SUCCESS;
+      }
+
+      PROMISE_TASK_ID log_id =
+          register_task_in(ptr_scheduler, command.callback, command.func_arg,
+                           command.delay);
+      is_failed = log_id.type == ERROR_CODE;
+
+      if (command.ptr_handle != NULL) {
+        atomic_store_explicit(command.ptr_handle,
+                              is_failed ? TASK_COMMAND_HANDLE_FAILED
+                                        : log_id.register_task_result.TASK_ID,
+                              memory_order_release);
+      }
+      break;
+    }
+    case TASK_COMMAND_REMOVE:
+      is_failed =
+          remove_task_in(ptr_scheduler, command.id).type == ERROR_CODE;
+      break;
+    case TASK_COMMAND_CHANGE_DELAY:
+      is_failed = change_task_delay_in(ptr_scheduler, command.id,
+                                       command.delay)
+                      .type == ERROR_CODE;
+      break;
+    default:
+      is_failed = true;
+      break;
+    }
+
+    report.APPLIED_COUNT += 1;
+    report.FAILED_COUNT += is_failed;
+  }
+
+  if (is_tick_began) {
+    end_clock_tick_in(ptr_scheduler);
+  }
+
+  return report;
+}
+
+/**
+ *  @brief Apply the commands submitted to the ring of the default scheduler
+ *  instance ( @see{apply_task_commands_in} )
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{apply_task_commands_in} ones
+ *
+ *  @param {size_t} max_commands - max quantity of the commands to apply, 0
+ *    => all the submitted ones
+ *
+ *  @return {TASK_COMMANDS_REPORT} - @see{TASK_COMMANDS_REPORT}
+ *
+ */
+TASK_COMMANDS_REPORT apply_task_commands(size_t max_commands) {
+  return apply_task_commands_in(&default_scheduler, max_commands);
+}
@@ -1,39 +1,42 @@
-#include "../environment/arguments.h"
+#include "../environment/global_variables.h"
+#include "../model/handle_tasks.h"
 #include "../module_run_tasks_after_delay.h"
-
-extern bool is_change_task_delay;
+#include "../utilities/handle_shards_config.h"
 
 /**
  *  @brief Modify the delay value (ms) of the task from @link{tasks_array}
  *
- *  @details Controller like function to get arguments and skip them further to
- *  the correspondent handler function via @link{handle_events_tasks}.
+ *  @details Controller like function: calls the correspondent handler
+ *  function of the model directly with its' arguments (no global state of
+ *  the call, i.e. reentrant, e.g. from the callbacks) and publishes the
+ *  shard's head ( @see{publish_shard_head} ).
  *
  *  @note ! Impure function !
- *  - mutates the outer global variable @link{is_change_task_delay}
- *  - implicit dependency on @callback{arguments_set_id}
- *  - implicit dependency on @callback{arguments_set_patch_delay}
- *  - implicit dependency on @callback{handle_events_tasks}
+ *  - implicit dependency on @callback{handle_change_task_delay}
+ *  - implicit dependency on @callback{publish_shard_head}
  *
- *  - mutates the outer Task in the @link{tasks_array}
- *  - implicit dependency on @type{TASK_COUNTER}
+ *  - mutates the Task in the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - implicit dependency on @type{TASK_HANDLE}
  *  - implicit dependency on @type{PROMISE_CHANGE_TASK_DELAY}
  *  - implicit dependency on @type{Task}
- *  - implicit dependency on @type{struct timespec} of <time.h>
- *  - implicit dependency on @callback{timespec_get} function of <time.h>
- *  - implicit dependency on @callback{sort_tasks_descending_by_delay_func}
- *  - under the hood uses @link{qsort} function from <stdlib.h> for sorting
- *    descending @link{tasks_array} via Task.delay(ms)
+ *  - implicit dependency on @type{TASK_TICKS}
+ *  - implicit dependency on @callback{get_now_ticks_in}
+ *  - implicit dependency on @callback{resolve_id_handle}
+ *  - implicit dependency on @callback{notify_new_deadline_in}
+ *  - implicit dependency on @callback{rearm_scheduler_fd}
+ *  - implicit dependency on @callback{task_queue_reschedule} (the queue
+ *    backend is set up via @link{TASK_QUEUE_BACKEND})
  *
  *  @note Returns promise like structure @link{PROMISE_CHANGE_TASK_DELAY}!
  *  Examine the example below how to handle it properly!
  *
  *  @note After the moment the delay time is successfully changed, inner
- *  @link{Task.created_timespec} is newed! So previous delay(ms) is omitted.
+ *  @link{Task.created_ticks} is newed! So previous delay(ms) is omitted.
  *
- *  @param {TASK_COUNTER} id - id of the task from @link{tasks_array} to change
- *  delay at
- *  @param {unsigned short} new_delay - new delay value (ms!)
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_HANDLE} id - handle of the task from @link{tasks_array} to
+ *  change delay at ( @see{register_task} )
+ *  @param {TASK_DELAY} new_delay - new delay value (ms!)
  *
  *  @return {PROMISE_CHANGE_TASK_DELAY} - structure of complex type
  *    @see{PROMISE_CHANGE_TASK_DELAY} for details and examples below for
@@ -45,13 +48,13 @@ extern bool is_change_task_delay;
  *      - CHANGE_TASK_DELAY_TASK_ID_IS_NOT_DETERMINED - no such task
  *        with given ID
  *      - CHANGE_TASK_DELAY_TIMESPEC_GET_ERROR - at the moment of
- *        getting current timestamp via @link{timespec_get}() function with
- *        TIME_UTC base problems occured
+ *        getting current timestamp via @link{get_now_ticks_in}() monotonic
+ *        clock function problems occured
  *
  *  @example
  *     *** Predefined context ***
  *    PROMISE_TASK_ID log_id = register_task(some_callback, 400, 400);
- *    TASK_COUNTER task_id;
+ *    TASK_HANDLE task_id;
  *    ***
  *    task_id = 0; (first one)
  *    ***
@@ -79,15 +82,54 @@ extern bool is_change_task_delay;
  *      break;
  *    }
  */
-PROMISE_CHANGE_TASK_DELAY change_task_delay(TASK_COUNTER id,
-                                            unsigned short new_delay) {
-  // set up the flag
-  is_change_task_delay = true;
+PROMISE_CHANGE_TASK_DELAY change_task_delay_in(Scheduler *ptr_scheduler,
+                                               TASK_HANDLE id,
+                                               TASK_DELAY new_delay) {
+  PROMISE_CHANGE_TASK_DELAY result =
+      handle_change_task_delay(ptr_scheduler, id, new_delay);
+  publish_shard_head(ptr_scheduler);
 
-  // update arguments
-  arguments_set_id(id);
-  arguments_set_patch_delay(new_delay);
+  return result;
+}
 
-  // handle the events
-  return handle_events_tasks().results.result_change_task_delay;
+/**
+ *  @brief Modify the delay value (ms) of the task of the default scheduler
+ *  instance ( @see{change_task_delay_in} )
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{change_task_delay_in} ones
+ *
+ *  @param {TASK_HANDLE} id - handle of the task
+ *  @param {unsigned short} new_delay - new delay value (ms!)
+ *
+ *  @return {PROMISE_CHANGE_TASK_DELAY} - the same as
+ *    @link{change_task_delay_in} one
+ *
+ */
+PROMISE_CHANGE_TASK_DELAY change_task_delay(TASK_HANDLE id,
+                                            unsigned short new_delay) {
+  return change_task_delay_in(&default_scheduler, id, new_delay);
+}
+
+/**
+ *  @brief Wide-delay variant of the @link{change_task_delay}: the same, but
+ *  the delay is 64-bit (ms), i.e. delays over 65535 ms (~65.5 s) are possible
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{change_task_delay} ones
+ *
+ *  @param {TASK_HANDLE} id - handle of the task
+ *  @param {TASK_DELAY} new_delay - new delay value (ms!)
+ *
+ *  @return {PROMISE_CHANGE_TASK_DELAY} - the same as @link{change_task_delay}
+ *    one
+ *
+ *  @example
+ *    PROMISE_CHANGE_TASK_DELAY log_change_task_delay =
+ *      change_task_delay_ex(0, 90'000); => the task is ready in 90 s
+ *
+ */
+PROMISE_CHANGE_TASK_DELAY change_task_delay_ex(TASK_HANDLE id,
+                                               TASK_DELAY new_delay) {
+  return change_task_delay_in(&default_scheduler, id, new_delay);
 }
@@ -1,37 +1,43 @@
+#include "../environment/global_variables.h"
+#include "../model/handle_tasks.h"
 #include "../module_run_tasks_after_delay.h"
-
-extern bool is_get_callback;
+#include "../utilities/handle_shards_config.h"
 
 /**
  *  @brief Get the sructure @link{PROMISE_TASK} with the last task (study the
  *  example for details!) from the @link{tasks_array[]} to call it's callback
  *  with the saved argument.
  *
- *  @details Controller like function to get arguments and skip them further to
- *  the correspondent handler function via @link{handle_events_tasks}.
+ *  @details Controller like function: calls the correspondent handler
+ *  function of the model directly with its' arguments (no global state of
+ *  the call, i.e. reentrant, e.g. from the callbacks) and publishes the
+ *  shard's head ( @see{publish_shard_head} ).
  *
  *  @note ! Impure function !
- *  - mutates the outer global variable @link{is_get_callback}
- *  - implicit dependency on @callback{handle_events_tasks}
+ *  - implicit dependency on @callback{handle_get_callback}
+ *  - implicit dependency on @callback{publish_shard_head}
  *
- *  - mutates the outer @link{task_count}
- *  - mutates the outer @link{tasks_array}
- *  - mutates the outer (encapsulated) @link{id_storage_array}
- *  - mutates the outer (encapsulated) @link{is_first_call}
- *  - mutates the outer (encapsulated) @link{ptr_free_elem}
+ *  - mutates the @link{task_count} of the @link{ptr_scheduler}
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the @link{id_storage_array} of the @link{ptr_scheduler}'s ids
+ *  - mutates the @link{is_initialized} of the @link{ptr_scheduler}'s ids
+ *  - mutates the @link{ptr_free_elem} of the @link{ptr_scheduler}'s ids
  *  - implicit dependency on @type{PROMISE_TASK}
  *  - implicit dependency on @type{Task}
- *  - implicit dependency on @type{struct timespec} of <time.h>
+ *  - implicit dependency on @type{TASK_TICKS}
  *  - implicit dependency on @type{ID_LIST_ELEM}
  *  - implicit dependency on @callback{free_id}
- *  - implicit dependency on @callback{timespec_get} function of <time.h>
+ *  - implicit dependency on @callback{get_now_ticks_in}
+ *  - implicit dependency on @callback{task_queue_advance}
+ *  - implicit dependency on @callback{task_queue_peek}
+ *  - implicit dependency on @callback{task_queue_pop}
  *
  *  @note Returns promise like structure @link{PROMISE_TASK}! Examine the
  *  example below how to handle it properly!
- *  @note Expected @link{tasks_array} to be sorted descending via Task.delay(ms)
- *  value.
+ *  @note Expected the queue backend to keep the task with the least deadline
+ *  on top ( @see{task_queue_peek} ).
  *
- *  @param {void} - no params expected
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
  *
  *  @return {PROMISE_TASK} - structure of complex type
  *    @see{PROMISE_TASK} for details and examples below for clarification how
@@ -40,14 +46,16 @@ extern bool is_get_callback;
  *    - PROMISE_TASK.get_callback_result.CODES_RESULT =>
  *      - GET_CALLBACK_ARRAY_OF_TASKS_EMPTY - current task counter value is 0
  *      - GET_CALLBACK_TIMESPEC_GET_ERROR - at the moment of getting current
- *        timestamp via timespec_get() function with TIME_UTC base problems
+ *        timestamp via get_now_ticks() monotonic clock function problems
  *        occured
  *      - GET_CALLBACK_PENDING - the least task's delay is not gone yet
+ *      - GET_CALLBACK_TASK_FIRING - called from the callback run by
+ *        run_ready_tasks
  *
  *  @example
  *    *** Predefined context ***
  *    PROMISE_TASK_ID log_id = register_task(some_callback, 400, 400);
- *    TASK_COUNTER task_id;
+ *    TASK_HANDLE task_id;
  *    ***
  *    task_id = 0; (first one)
  *    ***
@@ -63,10 +71,8 @@ extern bool is_get_callback;
  *        func_arg: 400;
  *        delay:  400;
  *        id: 0;
- *        created_timespec: {
- *          tv.sec = 0;
- *          tv.nsec = 6291136;
- *        }
+ *        created_ticks: 6291136;
+ *        deadline_ticks: 406291136;
  *      }
  *      break;
  *    case ERROR_CODE:
@@ -83,13 +89,28 @@ extern bool is_get_callback;
  *    }
  *
  *    *** Run callback with arg ***
- *    task.callback(task.func_arg);
+ *    get_task_callback(&task)(task.func_arg);
  *
  */
-PROMISE_TASK get_callback(void) {
-  // set up the flag
-  is_get_callback = true;
+PROMISE_TASK get_callback_in(Scheduler *ptr_scheduler) {
+  PROMISE_TASK result = handle_get_callback(ptr_scheduler);
+  publish_shard_head(ptr_scheduler);
 
-  // handle the events
-  return handle_events_tasks().results.result_get_callback;
+  return result;
+}
+
+/**
+ *  @brief Get the last ready task of the default scheduler instance (
+ *  @see{get_callback_in} )
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{get_callback_in} ones
+ *
+ *  @param {void} - no params expected
+ *
+ *  @return {PROMISE_TASK} - the same as @link{get_callback_in} one
+ *
+ */
+PROMISE_TASK get_callback(void) {
+  return get_callback_in(&default_scheduler);
 }
@@ -0,0 +1,101 @@
+#include "../environment/global_variables.h"
+#include "../model/handle_tasks.h"
+#include "../module_run_tasks_after_delay.h"
+#include "../utilities/handle_shards_config.h"
+
+/**
+ *  @brief Drain all the ready tasks (up to @link{capacity}) to the buffer in
+ *  the deadline order via one clock reading, i.e. the batch variant of the
+ *  @link{get_callback} (one controller call per burst instead of one per
+ *  task)
+ *
+ *  @details Controller like function: calls the correspondent handler
+ *  function of the model directly with its' arguments (no global state of
+ *  the call, i.e. reentrant, e.g. from the callbacks) and publishes the
+ *  shard's head ( @see{publish_shard_head} ).
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on @callback{handle_get_ready_tasks}
+ *  - implicit dependency on @callback{publish_shard_head}
+ *
+ *  - mutates the @link{task_count} of the @link{ptr_scheduler}
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the @link{id_storage_array} of the @link{ptr_scheduler}'s ids
+ *  - implicit dependency on @type{PROMISE_READY_TASKS}
+ *  - implicit dependency on @type{Task}
+ *  - implicit dependency on @callback{free_id}
+ *  - implicit dependency on @callback{get_now_ticks_in}
+ *  - implicit dependency on @callback{task_queue_advance}
+ *  - implicit dependency on @callback{task_queue_peek}
+ *  - implicit dependency on @callback{task_queue_pop}
+ *
+ *  @note Returns promise like structure @link{PROMISE_READY_TASKS}! Examine
+ *  the example below how to handle it properly!
+ *  @note READY_COUNT == @link{capacity} => there may be more ready tasks, call
+ *  it again
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {Task *} ready_tasks - buffer for the ready tasks
+ *  @param {size_t} capacity - max quantity of the tasks to drain
+ *
+ *  @return {PROMISE_READY_TASKS} - structure of complex type
+ *    @see{PROMISE_READY_TASKS} for details and examples below for
+ *    clarification how to handle it
+ *  @throw PROMISE_READY_TASKS.type = ERROR_CODE
+ *    - PROMISE_READY_TASKS.get_ready_tasks_result.CODES_RESULT =>
+ *      - GET_READY_TASKS_INVALID_BUFFER - NULL buffer for the non zero
+ *        capacity
+ *      - GET_READY_TASKS_TIMESPEC_GET_ERROR - at the moment of getting current
+ *        timestamp via get_now_ticks() monotonic clock function problems
+ *        occured
+ *      - GET_READY_TASKS_FREE_ID_ERROR - error at the process of freeing the
+ *        id
+ *
+ *  @example
+ *    Task ready_tasks[64];
+ *    PROMISE_READY_TASKS log_ready = get_ready_tasks(ready_tasks, 64);
+ *
+ *    switch (log_ready.type) {
+ *    case SUCCESS:
+ *      for (size_t i = 0; i < log_ready.get_ready_tasks_result.READY_COUNT;
+ *           i += 1) {
+ *        get_task_callback(&ready_tasks[i])(ready_tasks[i].func_arg);
+ *      }
+ *      break;
+ *    case ERROR_CODE:
+ *      printf("ERROR_CODE: %hd\n",
+ *        log_ready.get_ready_tasks_result.CODES_RESULT);
+ *      OUTPUT: e.g. GET_READY_TASKS_INVALID_BUFFER
+ *      break;
+ *    default:
+ *      fprintf(stderr, "Error(%s() function at %d): ups... Unknown
+ *        log_ready.type\n", __func__, __LINE__);
+ *      break;
+ *    }
+ *
+ */
+PROMISE_READY_TASKS get_ready_tasks_in(Scheduler *ptr_scheduler,
+                                       Task *ready_tasks, size_t capacity) {
+  PROMISE_READY_TASKS result =
+      handle_get_ready_tasks(ptr_scheduler, ready_tasks, capacity);
+  publish_shard_head(ptr_scheduler);
+
+  return result;
+}
+
+/**
+ *  @brief Drain the ready tasks of the default scheduler instance (
+ *  @see{get_ready_tasks_in} )
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{get_ready_tasks_in} ones
+ *
+ *  @param {Task *} ready_tasks - buffer for the ready tasks
+ *  @param {size_t} capacity - max quantity of the tasks to drain
+ *
+ *  @return {PROMISE_READY_TASKS} - the same as @link{get_ready_tasks_in} one
+ *
+ */
+PROMISE_READY_TASKS get_ready_tasks(Task *ready_tasks, size_t capacity) {
+  return get_ready_tasks_in(&default_scheduler, ready_tasks, capacity);
+}
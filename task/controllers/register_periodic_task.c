@@ -0,0 +1,77 @@
+#include "../environment/global_variables.h"
+#include "../model/handle_tasks.h"
+#include "../module_run_tasks_after_delay.h"
+#include "../utilities/handle_shards_config.h"
+
+/**
+ *  @brief Register the periodic task: @link{func_to_call} is called with
+ *  @link{arg} in @link{phase} ms and then every @link{period} ms till the
+ *  task is removed via its' handle ( @see{remove_task_in} )
+ *
+ *  @details Controller like function: calls the correspondent handler
+ *  function of the model directly with its' arguments (no global state of
+ *  the call, i.e. reentrant, e.g. from the callbacks) and publishes the
+ *  shard's head ( @see{publish_shard_head} ).
+ *
+ *  @note The served periodic task keeps its' id and handle, the next
+ *  deadline is the previous one + @link{period} (no drift, the lateness of
+ *  the serving doesn't accumulate), @see{reschedule_periodic_task}
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on @callback{handle_register_periodic_task}
+ *  - implicit dependency on @callback{publish_shard_head}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {task_callback} func_to_call - callback to call with @link{arg}
+ *  @param {unsigned short} arg - argument to call with @link{func_to_call}
+ *  @param {TASK_DELAY} period - period (ms), must be positive
+ *  @param {TASK_DELAY} phase - delay (ms) of the first call
+ *  @param {enum Task_catch_up_policies} catch_up_policy - what to do with the
+ *    missed periods (TASK_CATCH_UP_SKIP | TASK_CATCH_UP_BURST)
+ *
+ *  @return {PROMISE_TASK_ID} - structure of complex type
+ *    @see{PROMISE_TASK_ID} for details
+ *  @throw PROMISE_TASK_ID.type = ERROR_CODE
+ *    - PROMISE_TASK_ID.register_task_result.CODES_RESULT =>
+ *      REGISTER_TASK_INVALID_PERIOD - the period is 0
+ *      the rest ones @see{register_task_in}
+ *
+ *  @example
+ *    static Scheduler io_scheduler = SCHEDULER_INITIALIZER;
+ *    ...
+ *    PROMISE_TASK_ID log_id = register_periodic_task_in(
+ *        &io_scheduler, show_task_info, 1, 100, 0, TASK_CATCH_UP_SKIP);
+ *    => show_task_info(1) every 100 ms starting now
+ *    remove_task_in(&io_scheduler, log_id.register_task_result.TASK_ID);
+ *    => stopped
+ *
+ */
+PROMISE_TASK_ID
+register_periodic_task_in(Scheduler *ptr_scheduler, task_callback func_to_call,
+                          unsigned short arg, TASK_DELAY period,
+                          TASK_DELAY phase,
+                          enum Task_catch_up_policies catch_up_policy) {
+  PROMISE_TASK_ID result = handle_register_periodic_task(
+      ptr_scheduler, func_to_call, arg, period, phase, catch_up_policy);
+  publish_shard_head(ptr_scheduler);
+
+  return result;
+}
+
+/**
+ *  @brief Register the periodic task in the @link{default_scheduler}, @see{
+ *  register_periodic_task_in}
+ *
+ *  @example
+ *    *** every second, the missed seconds are served in a row ***
+ *    register_periodic_task(show_task_info, 1, 1'000, 1'000,
+ *                           TASK_CATCH_UP_BURST);
+ *
+ */
+PROMISE_TASK_ID
+register_periodic_task(task_callback func_to_call, unsigned short arg,
+                       TASK_DELAY period, TASK_DELAY phase,
+                       enum Task_catch_up_policies catch_up_policy) {
+  return register_periodic_task_in(&default_scheduler, func_to_call, arg,
+                                   period, phase, catch_up_policy);
+}
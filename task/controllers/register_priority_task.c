@@ -0,0 +1,62 @@
+#include "../environment/global_variables.h"
+#include "../model/handle_tasks.h"
+#include "../module_run_tasks_after_delay.h"
+#include "../utilities/handle_shards_config.h"
+
+/**
+ *  @brief Register the task in the priority class @link{priority} of the
+ *  priority scheduler ( @see{PriorityScheduler} ) to delay its' usage at
+ *  @link{delay} ms
+ *
+ *  @details Controller like function: calls the correspondent handler
+ *  function of the model directly with its' arguments (no global state of
+ *  the call, i.e. reentrant, e.g. from the callbacks) and publishes the
+ *  class' head ( @see{publish_shard_head} ).
+ *
+ *  @note The handle is valid within the class' instance only: remove /
+ *  change the task via the usual *_in controllers with
+ *  &ptr_priority_scheduler->classes[priority].
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on @callback{handle_register_priority_task}
+ *  - implicit dependency on @callback{publish_shard_head}
+ *
+ *  @param {PriorityScheduler *} ptr_priority_scheduler - the priority
+ *    scheduler
+ *  @param {unsigned int} priority - the priority class, range
+ *    [0; TASK_PRIORITY_CLASSES), 0 is the highest one
+ *  @param {task_callback} func_to_call - callback to call with @link{arg}
+ *  @param {unsigned short} arg - argument to call with @link{func_to_call}
+ *  @param {TASK_DELAY} delay - delay time (ms)
+ *
+ *  @return {PROMISE_TASK_ID} - structure of complex type
+ *    @see{PROMISE_TASK_ID} for details
+ *  @throw PROMISE_TASK_ID.type = ERROR_CODE
+ *    - PROMISE_TASK_ID.register_task_result.CODES_RESULT =>
+ *      REGISTER_TASK_INVALID_PRIORITY - no such priority class
+ *      the rest ones @see{register_task_in}
+ *
+ *  @example
+ *    static PriorityScheduler net_scheduler;
+ *    ...
+ *    init_priority_scheduler(&net_scheduler, 50);
+ *    PROMISE_TASK_ID log_id =
+ *        register_priority_task_in(&net_scheduler, 2, show_task_info, 1, 400);
+ *    ...
+ *    remove_task_in(&net_scheduler.classes[2],
+ *                   log_id.register_task_result.TASK_ID);
+ *
+ */
+PROMISE_TASK_ID
+register_priority_task_in(PriorityScheduler *ptr_priority_scheduler,
+                          unsigned int priority, task_callback func_to_call,
+                          unsigned short arg, TASK_DELAY delay) {
+  PROMISE_TASK_ID result = handle_register_priority_task(
+      ptr_priority_scheduler, priority, func_to_call, arg, delay);
+
+  if (priority < TASK_PRIORITY_CLASSES) {
+    publish_shard_head(&ptr_priority_scheduler->classes[priority]);
+  }
+
+  return result;
+}
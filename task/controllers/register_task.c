@@ -1,49 +1,51 @@
-#include "../environment/arguments.h"
+#include "../environment/global_variables.h"
+#include "../model/handle_tasks.h"
 #include "../module_run_tasks_after_delay.h"
-
-extern bool is_register_task;
+#include "../utilities/handle_shards_config.h"
 
 /**
  *  @brief Register task in the @link{tasks_array[]} to delay its' usage at
  *  @link{delay} ms and get the strucure @link{PROMISE_TASK_ID} for saving
- *  registered task's id
+ *  registered task's handle ( @see{TASK_HANDLE} )
  *
- *  @details Controller like function to get arguments and skip them further to
- *  the correspondent handler function via @link{handle_events_tasks}.
+ *  @details Controller like function: calls the correspondent handler
+ *  function of the model directly with its' arguments (no global state of
+ *  the call, i.e. reentrant, e.g. from the callbacks) and publishes the
+ *  shard's head ( @see{publish_shard_head} ).
  *
  *  @note ! Impure function !
- *  - mutates the outer global variable @link{is_register_task}
- *  - implicit dependency on @callback{arguments_set_callback}
- *  - implicit dependency on @callback{arguments_set_func_arg}
- *  - implicit dependency on @callback{arguments_set_delay}
- *  - implicit dependency on @callback{handle_events_tasks}
- *
- *  - mutates the outer @link{task_count}
- *  - mutates the outer @link{tasks_array}
- *  - mutates the outer (encapsulated) @link{id_storage_array}
- *  - mutates the outer (encapsulated) @link{is_first_call}
- *  - mutates the outer (encapsulated) @link{ptr_free_elem}
+ *  - implicit dependency on @callback{handle_register_task}
+ *  - implicit dependency on @callback{publish_shard_head}
+ *
+ *  - mutates the @link{task_count} of the @link{ptr_scheduler}
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the @link{id_storage_array} of the @link{ptr_scheduler}'s ids
+ *  - mutates the @link{is_initialized} of the @link{ptr_scheduler}'s ids
+ *  - mutates the @link{ptr_free_elem} of the @link{ptr_scheduler}'s ids
  *  - implicit dependency on @type{PROMISE_TASK_ID}
  *  - implicit dependency on @type{task_callback}
  *  - implicit dependency on @type{Task}
- *  - implicit dependency on @type{struct timespec} of <time.h>
+ *  - implicit dependency on @type{TASK_TICKS}
  *  - implicit dependency on @type{ID_LIST_ELEM}
  *  - implicit dependency on @callback{get_id}
- *  - implicit dependency on global variable @link{MIN_DELAY_FOR_SORT}
- *  - implicit dependency on @callback{timespec_get} function of <time.h>
- *  - implicit dependency on @callback{sort_tasks_descending_by_delay_func}
- *  - under the hood uses @link{qsort} function from <stdlib.h> for sorting
- *    descending @link{tasks_array} via Task.delay(ms)
+ *  - implicit dependency on @callback{get_id_handle}
+ *  - implicit dependency on @callback{notify_new_deadline_in}
+ *  - implicit dependency on @callback{rearm_scheduler_fd}
+ *  - implicit dependency on @callback{get_now_ticks_in}
+ *  - implicit dependency on @callback{task_queue_push} (the queue backend is
+ *    set up via @link{TASK_QUEUE_BACKEND})
  *
  *  @note Returns promise like structure @link{PROMISE_TASK_ID}! Examine the
  *  example below how to handle it properly!
  *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
  *  @param {task_callback} func_to_call - callback that user will call with
  *    @link{arg} after @link{delay} ms is gone
  *    e.g. @see{show_task_info}
  *  @param {unsigned short} arg - argument to call with @link{func_to_call}
- *  @param {unsigned short} delay - delay time (ms). When it's gone user can
- *    call `func_to_call(arg)` or `Task task.callback(task.func_arg)` , where
+ *  @param {TASK_DELAY} delay - delay time (ms). When it's gone user can
+ *    call `func_to_call(arg)` or
+ *    `get_task_callback(&task)(task.func_arg)` , where
  *    `task` is created via `register_task` function instance of
  *    @type{Task} and nested to the @link{tasks_array}
  *
@@ -54,16 +56,16 @@ extern bool is_register_task;
  *    - PROMISE_TASK_ID.register_task_result.CODES_RESULT =>
  *      REGISTER_TASK_ARRAY_OF_TASKS_FULL - no free space to add extra Task
  *      REGISTER_TASK_TIMESPEC_GET_ERROR - problems occured at
- *      @link{timespec_get}() function calling
+ *      @link{get_now_ticks_in}() function calling
  *
  *  @example
  *    PROMISE_TASK_ID log_id = register_task(some_callback, 400, 400);
- *    TASK_COUNTER task_id;
+ *    TASK_HANDLE task_id;
  *
  *    switch (log_id.type) {
  *    case SUCCESS:
  *      task_id = log_id.register_task_result.TASK_ID;
- *      printf("task_id: %hd\n", task_id);
+ *      printf("task_id: %llu\n", task_id);
  *      OUTPUT: e.g. 9 (task_id: 9)
  *      break;
  *    case ERROR_CODE:
@@ -80,16 +82,113 @@ extern bool is_register_task;
  *    }
  *
  */
+PROMISE_TASK_ID register_task_in(Scheduler *ptr_scheduler,
+                                 task_callback func_to_call,
+                                 unsigned short arg, TASK_DELAY delay) {
+  PROMISE_TASK_ID result =
+      handle_register_task(ptr_scheduler, func_to_call, arg, delay, 0);
+  publish_shard_head(ptr_scheduler);
+
+  return result;
+}
+
+/**
+ *  @brief Register task in the default scheduler instance (
+ *  @see{register_task_in} )
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{register_task_in} ones
+ *
+ *  @param {task_callback} func_to_call - callback that user will call with
+ *    @link{arg} after @link{delay} ms is gone
+ *  @param {unsigned short} arg - argument to call with @link{func_to_call}
+ *  @param {unsigned short} delay - delay time (ms)
+ *
+ *  @return {PROMISE_TASK_ID} - the same as @link{register_task_in} one
+ *
+ */
 PROMISE_TASK_ID register_task(task_callback func_to_call, unsigned short arg,
                               unsigned short delay) {
-  // set up the flag
-  is_register_task = true;
+  return register_task_in(&default_scheduler, func_to_call, arg, delay);
+}
+
+/**
+ *  @brief Wide-delay variant of the @link{register_task}: the same, but the
+ *  delay is 64-bit (ms), i.e. delays over 65535 ms (~65.5 s) are possible
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{register_task} ones
+ *
+ *  @param {task_callback} func_to_call - callback that user will call with
+ *    @link{arg} after @link{delay} ms is gone
+ *  @param {unsigned short} arg - argument to call with @link{func_to_call}
+ *  @param {TASK_DELAY} delay - delay time (ms), e.g. 86'400'000 (one day).
+ *    Too far deadlines are saturated ( @see{get_task_deadline_ticks} )
+ *
+ *  @return {PROMISE_TASK_ID} - the same as @link{register_task} one
+ *
+ *  @example
+ *    PROMISE_TASK_ID log_id = register_task_ex(some_callback, 400,
+ *      2ULL * 60 * 60 * 1'000); => the task is ready in 2 hours
+ *
+ */
+PROMISE_TASK_ID register_task_ex(task_callback func_to_call,
+                                 unsigned short arg, TASK_DELAY delay) {
+  return register_task_in(&default_scheduler, func_to_call, arg, delay);
+}
+
+/**
+ *  @brief Register the task with the timer slack: it may be served at any
+ *  moment of [@link{delay}; @link{delay} + @link{slack}] ms from now, so the
+ *  scheduler coalesces its' deadline with the nearby ones (one wakeup and
+ *  one batch drain for them, @see{get_coalesced_deadline_ticks})
+ *
+ *  @details Controller like function: the same as @link{register_task_in},
+ *  the slack is kept for the task's reschedules ( @see{change_task_delay_in},
+ *  @see{requeue_current_task_in} ).
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{register_task_in} ones
+ *  - mutates the @link{slacks} of the @link{ptr_scheduler}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {task_callback} func_to_call - callback to call with @link{arg}
+ *  @param {unsigned short} arg - argument to call with @link{func_to_call}
+ *  @param {TASK_DELAY} delay - delay time (ms), the earliest moment
+ *  @param {TASK_DELAY} slack - slack (ms), the latest moment is @link{delay}
+ *    + @link{slack}, 0 => the same as @link{register_task_in}
+ *
+ *  @return {PROMISE_TASK_ID} - the same as @link{register_task_in} one
+ *
+ *  @example
+ *    *** the cache flush due in 1..1.1 s ***
+ *    register_task_with_slack_in(&io_scheduler, flush_cache, 0, 1'000, 100);
+ *
+ */
+PROMISE_TASK_ID register_task_with_slack_in(Scheduler *ptr_scheduler,
+                                            task_callback func_to_call,
+                                            unsigned short arg,
+                                            TASK_DELAY delay,
+                                            TASK_DELAY slack) {
+  PROMISE_TASK_ID result =
+      handle_register_task(ptr_scheduler, func_to_call, arg, delay, slack);
+  publish_shard_head(ptr_scheduler);
 
-  // update arguments
-  arguments_set_callback(func_to_call);
-  arguments_set_func_arg(arg);
-  arguments_set_delay(delay);
+  return result;
+}
 
-  // handle the events
-  return handle_events_tasks().results.result_register_task;
+/**
+ *  @brief Register the task with the timer slack in the default scheduler
+ *  instance ( @see{register_task_with_slack_in} )
+ *
+ *  @example
+ *    register_task_with_slack(show_task_info, 1, 400, 50);
+ *    => show_task_info(1) in 400..450 ms
+ *
+ */
+PROMISE_TASK_ID register_task_with_slack(task_callback func_to_call,
+                                         unsigned short arg, TASK_DELAY delay,
+                                         TASK_DELAY slack) {
+  return register_task_with_slack_in(&default_scheduler, func_to_call, arg,
+                                     delay, slack);
 }
@@ -1,37 +1,39 @@
-#include "../environment/arguments.h"
+#include "../environment/global_variables.h"
+#include "../model/handle_tasks.h"
 #include "../module_run_tasks_after_delay.h"
-
-extern bool is_remove_task;
+#include "../utilities/handle_shards_config.h"
 
 /**
- *  @brief Remove the task via valid id from @link{tasks_array}
+ *  @brief Remove the task via valid handle from @link{tasks_array}
  *
- *  @details Controller like function to get arguments and skip them further to
- *  the correspondent handler function via @link{handle_events_tasks}.
+ *  @details Controller like function: calls the correspondent handler
+ *  function of the model directly with its' arguments (no global state of
+ *  the call, i.e. reentrant, e.g. from the callbacks) and publishes the
+ *  shard's head ( @see{publish_shard_head} ).
  *
  *  @note ! Impure function !
- *  - mutates the outer global variable @link{is_remove_task}
- *  - implicit dependency on @callback{arguments_set_id_remove}
- *  - implicit dependency on @callback{handle_events_tasks}
+ *  - implicit dependency on @callback{handle_remove_task}
+ *  - implicit dependency on @callback{publish_shard_head}
  *
- *  - mutates the outer @link{tasks_array}
- *  - mutates the outer (encapsulated) @link{id_storage_array}
- *  - mutates the outer (encapsulated) @link{is_first_call}
- *  - mutates the outer (encapsulated) @link{ptr_free_elem}
- *  - implicit dependency on @type{TASK_COUNTER}
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the @link{id_storage_array} of the @link{ptr_scheduler}'s ids
+ *  - mutates the @link{is_initialized} of the @link{ptr_scheduler}'s ids
+ *  - mutates the @link{ptr_free_elem} of the @link{ptr_scheduler}'s ids
+ *  - implicit dependency on @type{TASK_HANDLE}
  *  - implicit dependency on @type{PROMISE_REMOVE_TASK}
  *  - implicit dependency on @type{Task}
  *  - implicit dependency on @type{ID_LIST_ELEM}
+ *  - implicit dependency on @callback{resolve_id_handle}
  *  - implicit dependency on @callback{free_id}
- *  - implicit dependency on @callback{sort_tasks_descending_by_delay_func}
- *  - under the hood uses @link{qsort} function from <stdlib.h> for sorting
- *    descending @link{tasks_array} via Task.delay(ms)
+ *  - implicit dependency on @callback{task_queue_remove} (the queue backend is
+ *    set up via @link{TASK_QUEUE_BACKEND})
  *
  *  @note Returns promise like structure @link{PROMISE_REMOVE_TASK}!
  *  Examine the example below how to handle it properly!
  *
- *  @param {TASK_COUNTER} id - id of the task from @link{tasks_array} that will
- *  be removed
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_HANDLE} id - handle of the task from @link{tasks_array} that
+ *  will be removed ( @see{register_task} )
  *
  *  @return {PROMISE_REMOVE_TASK} - structure of complex type
  *    @see{PROMISE_REMOVE_TASK} for details and examples below for
@@ -41,12 +43,12 @@ extern bool is_remove_task;
  *      - REMOVE_TASK_ARRAY_OF_TASKS_EMPTY - current task
  *        counter value is 0
  *      - REMOVE_TASK_TASK_ID_IS_NOT_DETERMINED - no such task
- *        with given ID
+ *        with given ID (or the handle is stale)
  *
  *  @example
  *    *** Predefined context ***
  *    PROMISE_TASK_ID log_id = register_task(some_callback, 400, 400);
- *    TASK_COUNTER task_id;
+ *    TASK_HANDLE task_id;
  *    ***
  *    task_id = 0; (first one)
  *    ***
@@ -75,20 +77,30 @@ extern bool is_remove_task;
  *      func_arg = 0
  *      delay = 0
  *      id = 0
- *      created_timespec = {
- *        tv_sec = 0
- *        tv_nsec = 0
- *      }
+ *      created_ticks = 0
+ *      deadline_ticks = 0
  *    }
  *
  */
-PROMISE_REMOVE_TASK remove_task(TASK_COUNTER id) {
-  // set up the flag
-  is_remove_task = true;
+PROMISE_REMOVE_TASK remove_task_in(Scheduler *ptr_scheduler, TASK_HANDLE id) {
+  PROMISE_REMOVE_TASK result = handle_remove_task(ptr_scheduler, id);
+  publish_shard_head(ptr_scheduler);
 
-  // update arguments
-  arguments_set_id_remove(id);
+  return result;
+}
 
-  // handle the events
-  return handle_events_tasks().results.result_remove_task;
+/**
+ *  @brief Remove the task of the default scheduler instance (
+ *  @see{remove_task_in} )
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{remove_task_in} ones
+ *
+ *  @param {TASK_HANDLE} id - handle of the task to remove
+ *
+ *  @return {PROMISE_REMOVE_TASK} - the same as @link{remove_task_in} one
+ *
+ */
+PROMISE_REMOVE_TASK remove_task(TASK_HANDLE id) {
+  return remove_task_in(&default_scheduler, id);
 }
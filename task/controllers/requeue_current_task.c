@@ -0,0 +1,69 @@
+#include "../environment/global_variables.h"
+#include "../model/handle_tasks.h"
+#include "../module_run_tasks_after_delay.h"
+#include "../utilities/handle_shards_config.h"
+
+/**
+ *  @brief Requeue the task whose callback is being called (call it from the
+ *  callback): @link{new_delay} ms from now, the same id and handle
+ *
+ *  @details Controller like function: calls the correspondent handler
+ *  function of the model directly with its' arguments (no global state of
+ *  the call, i.e. reentrant, e.g. from the callbacks) and publishes the
+ *  shard's head ( @see{publish_shard_head} ).
+ *
+ *  @note The fast path of the self rescheduling callback: one move of the
+ *  task in the queue instead of pop + push, no get_id / free_id
+ *  ( @see{handle_requeue_current_task} ). Only for the callbacks called by
+ *  @link{run_ready_tasks_in} in the serving thread.
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on @callback{handle_requeue_current_task}
+ *  - implicit dependency on @callback{publish_shard_head}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_DELAY} new_delay - delay (ms) from now
+ *
+ *  @return {PROMISE_CHANGE_TASK_DELAY} - structure of complex type
+ *    @see{PROMISE_CHANGE_TASK_DELAY} for details
+ *  @throw PROMISE_CHANGE_TASK_DELAY.type = ERROR_CODE
+ *    - PROMISE_CHANGE_TASK_DELAY.CODES_RESULT =>
+ *      CHANGE_TASK_DELAY_TASK_ID_IS_NOT_DETERMINED - not from the callback
+ *      of the task served by @link{run_ready_tasks_in}
+ *      the rest ones @see{change_task_delay_in}
+ *
+ *  @example
+ *    static Scheduler io_scheduler = SCHEDULER_INITIALIZER;
+ *    void poll_socket(unsigned short arg) {
+ *      ...
+ *      requeue_current_task_in(&io_scheduler, 20);
+ *    }
+ *    ...
+ *    register_task_in(&io_scheduler, poll_socket, 0, 20);
+ *    run_ready_tasks_in(&io_scheduler, (RUN_BUDGET){});
+ *    => poll_socket(0) is called and stays in the queue for 20 ms more
+ *
+ */
+PROMISE_CHANGE_TASK_DELAY requeue_current_task_in(Scheduler *ptr_scheduler,
+                                                  TASK_DELAY new_delay) {
+  PROMISE_CHANGE_TASK_DELAY result =
+      handle_requeue_current_task(ptr_scheduler, new_delay);
+  publish_shard_head(ptr_scheduler);
+
+  return result;
+}
+
+/**
+ *  @brief Requeue the task of the @link{default_scheduler} whose callback is
+ *  being called, @see{requeue_current_task_in}
+ *
+ *  @example
+ *    void show_task_info_again(unsigned short arg) {
+ *      show_task_info(arg);
+ *      requeue_current_task(arg); => again in arg ms
+ *    }
+ *
+ */
+PROMISE_CHANGE_TASK_DELAY requeue_current_task(TASK_DELAY new_delay) {
+  return requeue_current_task_in(&default_scheduler, new_delay);
+}
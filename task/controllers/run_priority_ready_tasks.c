@@ -0,0 +1,51 @@
+#include "../environment/global_variables.h"
+#include "../model/handle_tasks.h"
+#include "../module_run_tasks_after_delay.h"
+#include "../utilities/handle_shards_config.h"
+
+/**
+ *  @brief Call the callbacks of the ready tasks of the priority scheduler (
+ *  @see{PriorityScheduler} ): the highest class first, the earliest deadline
+ *  first within the class, the late tasks promoted by the aging
+ *
+ *  @details Controller like function: calls the correspondent handler
+ *  function of the model directly with its' arguments (no global state of
+ *  the call) and publishes the classes' heads ( @see{publish_shard_head} ).
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on @callback{handle_run_priority_ready_tasks}
+ *  - implicit dependency on @callback{publish_shard_head}
+ *
+ *  @param {PriorityScheduler *} ptr_priority_scheduler - the priority
+ *    scheduler
+ *  @param {RUN_BUDGET} budget - @see{RUN_BUDGET} (zero fields => no limits)
+ *
+ *  @return {PROMISE_RUN_READY_TASKS} - structure of complex type
+ *    @see{PROMISE_RUN_READY_TASKS} for details, NEXT_DEADLINE_TICKS is the
+ *    earliest one of all the classes
+ *  @throw PROMISE_RUN_READY_TASKS.type = ERROR_CODE
+ *    - the same as @link{run_ready_tasks_in} ones
+ *
+ *  @example
+ *    static PriorityScheduler net_scheduler;
+ *    ...
+ *    init_priority_scheduler(&net_scheduler, 50);
+ *    register_priority_task_in(&net_scheduler, 0, send_heartbeat, 0, 10);
+ *    register_priority_task_in(&net_scheduler, 2, flush_stats, 0, 10);
+ *    ...
+ *    run_priority_ready_tasks_in(&net_scheduler, (RUN_BUDGET){});
+ *    => send_heartbeat(0) is called before flush_stats(0)
+ *
+ */
+PROMISE_RUN_READY_TASKS
+run_priority_ready_tasks_in(PriorityScheduler *ptr_priority_scheduler,
+                            RUN_BUDGET budget) {
+  PROMISE_RUN_READY_TASKS result =
+      handle_run_priority_ready_tasks(ptr_priority_scheduler, budget);
+
+  for (int priority = 0; priority < TASK_PRIORITY_CLASSES; priority += 1) {
+    publish_shard_head(&ptr_priority_scheduler->classes[priority]);
+  }
+
+  return result;
+}
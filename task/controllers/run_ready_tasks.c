@@ -0,0 +1,97 @@
+#include "../environment/global_variables.h"
+#include "../model/handle_tasks.h"
+#include "../module_run_tasks_after_delay.h"
+#include "../utilities/handle_shards_config.h"
+
+/**
+ *  @brief Call the callbacks of the ready tasks straight from the queue (the
+ *  built-in executor: no Task copy out, no promise per task) in the deadline
+ *  order within the @link{budget} and report how many ran and the earliest
+ *  pending deadline
+ *
+ *  @details Controller like function: calls the correspondent handler
+ *  function of the model directly with its' arguments (no global state of
+ *  the call, i.e. reentrant, e.g. from the callbacks) and publishes the
+ *  shard's head ( @see{publish_shard_head} ).
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on @callback{handle_run_ready_tasks}
+ *  - implicit dependency on @callback{publish_shard_head}
+ *
+ *  - mutates the @link{task_count} of the @link{ptr_scheduler}
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the @link{id_storage_array} of the @link{ptr_scheduler}'s ids
+ *  - implicit dependency on @type{PROMISE_RUN_READY_TASKS}
+ *  - implicit dependency on @type{RUN_BUDGET}
+ *  - implicit dependency on @callback{free_id}
+ *  - implicit dependency on @callback{get_now_ticks_in}
+ *  - implicit dependency on @callback{task_queue_advance}
+ *  - implicit dependency on @callback{task_queue_peek}
+ *  - implicit dependency on @callback{task_queue_pop}
+ *  - implicit dependency on @callback{task_queue_get_next_deadline}
+ *
+ *  @note Returns promise like structure @link{PROMISE_RUN_READY_TASKS}!
+ *  Examine the example below how to handle it properly!
+ *  @note The callbacks may call the controllers (e.g. register_task), the
+ *  tasks registered by them run at the next call.
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {RUN_BUDGET} budget - @see{RUN_BUDGET} (zero fields => no limits)
+ *
+ *  @return {PROMISE_RUN_READY_TASKS} - structure of complex type
+ *    @see{PROMISE_RUN_READY_TASKS} for details and examples below for
+ *    clarification how to handle it
+ *  @throw PROMISE_RUN_READY_TASKS.type = ERROR_CODE
+ *    - PROMISE_RUN_READY_TASKS.run_ready_tasks_result.CODES_RESULT =>
+ *      - RUN_READY_TASKS_TIMESPEC_GET_ERROR - at the moment of getting
+ *        current timestamp via get_now_ticks() monotonic clock function
+ *        problems occured
+ *      - RUN_READY_TASKS_FREE_ID_ERROR - error at the process of freeing the
+ *        id
+ *
+ *  @example
+ *    PROMISE_RUN_READY_TASKS log_run =
+ *        run_ready_tasks((RUN_BUDGET){.max_time_ns = 2 * RATIO_NANOSEC_MSEC});
+ *
+ *    switch (log_run.type) {
+ *    case SUCCESS:
+ *      printf("%zu\n", log_run.run_ready_tasks_result.REPORT.RAN_COUNT);
+ *      OUTPUT: e.g. 3 (3 callbacks are called)
+ *      break;
+ *    case ERROR_CODE:
+ *      printf("ERROR_CODE: %hd\n",
+ *        log_run.run_ready_tasks_result.CODES_RESULT);
+ *      OUTPUT: e.g. RUN_READY_TASKS_FREE_ID_ERROR
+ *      break;
+ *    default:
+ *      fprintf(stderr, "Error(%s() function at %d): ups... Unknown
+ *        log_run.type\n", __func__, __LINE__);
+ *      break;
+ *    }
+ *
+ */
+PROMISE_RUN_READY_TASKS run_ready_tasks_in(Scheduler *ptr_scheduler,
+                                           RUN_BUDGET budget) {
+  PROMISE_RUN_READY_TASKS result =
+      handle_run_ready_tasks(ptr_scheduler, budget);
+  publish_shard_head(ptr_scheduler);
+
+  return result;
+}
+
+/**
+ *  @brief Call the callbacks of the ready tasks of the default scheduler
+ *  instance ( @see{run_ready_tasks_in} )
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{run_ready_tasks_in} ones
+ *
+ *  @param {RUN_BUDGET} budget - @see{RUN_BUDGET} (zero fields => no limits)
+ *
+ *  @return {PROMISE_RUN_READY_TASKS} - the same as @link{run_ready_tasks_in}
+ *  one
+ *
+ */
+PROMISE_RUN_READY_TASKS run_ready_tasks(RUN_BUDGET budget) {
+  return run_ready_tasks_in(&default_scheduler, budget);
+}
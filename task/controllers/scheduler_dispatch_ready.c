@@ -0,0 +1,94 @@
+#include "../environment/global_variables.h"
+#include "../module_run_tasks_after_delay.h"
+#include "../utilities/utils.h"
+
+/**
+ *  @brief Serve (call) all the ready tasks and re-arm the scheduler's file
+ *  descriptor ( @see{get_scheduler_fd} ) at the next deadline. Call it when
+ *  the descriptor is readable
+ *
+ *  @details Controller like function on top of the
+ *  @link{run_ready_tasks_in} (calls it directly).
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on @callback{run_ready_tasks_in}
+ *  - implicit dependency on @callback{sync_scheduler_fd}
+ *
+ *  - mutates the @link{task_count} of the @link{ptr_scheduler}
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the @link{id_storage_array} of the @link{ptr_scheduler}'s ids
+ *  - mutates the @link{armed_deadline_ticks} of the @link{ptr_scheduler}'s fd
+ *
+ *  @note Works without the descriptor too (it just serves the ready tasks).
+ *  The spurious calls (e.g. the descriptor armed at the removed head or the
+ *  timing wheel's slot start) serve nothing and re-arm the descriptor.
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {PROMISE_SCHEDULER_FD} - structure of complex type
+ *    @see{PROMISE_SCHEDULER_FD} for details
+ *  @throw PROMISE_SCHEDULER_FD.type = ERROR_CODE
+ *    - PROMISE_SCHEDULER_FD.scheduler_fd_result.CODES_RESULT =>
+ *      - HANDLE_SCHEDULER_FD_TIMESPEC_GET_ERROR - problems occured at
+ *        @link{get_now_ticks}() function calling
+ *      - HANDLE_SCHEDULER_FD_SETTIME_ERROR - timerfd_settime() failed (the
+ *        ready tasks are served already)
+ *
+ *  @example
+ *    int fd = get_scheduler_fd().scheduler_fd_result.FD;
+ *    epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &(struct epoll_event){
+ *      .events = EPOLLIN, .data.fd = fd});
+ *
+ *    while (epoll_wait(epoll_fd, events, MAX_EVENTS, -1) > 0) {
+ *      if (events[i].data.fd == fd) {
+ *        PROMISE_SCHEDULER_FD log_dispatch =
+ *            scheduler_dispatch_ready_in(&default_scheduler);
+ *        printf("%llu\n",
+ *          log_dispatch.scheduler_fd_result.DISPATCHED_COUNT);
+ *        OUTPUT: e.g. 3 (3 tasks are called)
+ *      }
+ *    }
+ *
+ */
+PROMISE_SCHEDULER_FD scheduler_dispatch_ready_in(Scheduler *ptr_scheduler) {
+  unsigned long long dispatched_count = 0;
+  PROMISE_RUN_READY_TASKS log_run =
+      run_ready_tasks_in(ptr_scheduler, (RUN_BUDGET){});
+
+  if (log_run.type == SUCCESS) {
+    dispatched_count = log_run.run_ready_tasks_result.REPORT.RAN_COUNT;
+  } else if (log_run.run_ready_tasks_result.CODES_RESULT ==
+             RUN_READY_TASKS_TIMESPEC_GET_ERROR) {
+    return (PROMISE_SCHEDULER_FD){.type = ERROR_CODE,
+                                  .scheduler_fd_result.CODES_RESULT =
+                                      HANDLE_SCHEDULER_FD_TIMESPEC_GET_ERROR};
+  }
+
+  enum Handle_scheduler_fd_errors_codes code = sync_scheduler_fd(ptr_scheduler);
+
+  if (code != HANDLE_SCHEDULER_FD_DONE_SUCCESSFULLY) {
+    return (PROMISE_SCHEDULER_FD){.type = ERROR_CODE,
+                                  .scheduler_fd_result.CODES_RESULT = code};
+  }
+
+  return (PROMISE_SCHEDULER_FD){.type = SUCCESS,
+                                .scheduler_fd_result.DISPATCHED_COUNT =
+                                    dispatched_count};
+}
+
+/**
+ *  @brief Serve all the ready tasks of the default scheduler instance and
+ *  re-arm its' descriptor ( @see{scheduler_dispatch_ready_in} )
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{scheduler_dispatch_ready_in} ones
+ *
+ *  @param {void} - no params expected
+ *
+ *  @return {PROMISE_SCHEDULER_FD} - the same as
+ *    @link{scheduler_dispatch_ready_in} one
+ *
+ */
+PROMISE_SCHEDULER_FD scheduler_dispatch_ready(void) {
+  return scheduler_dispatch_ready_in(&default_scheduler);
+}
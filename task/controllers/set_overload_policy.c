@@ -0,0 +1,55 @@
+#include "../environment/global_variables.h"
+#include "../module_run_tasks_after_delay.h"
+#include "../utilities/utils.h"
+
+/**
+ *  @brief Set up what the registering does under the overload (
+ *  @see{OVERLOAD_POLICY} ): with the full queue - reject (default), block
+ *  till a slot frees (serving the expired tasks in the registering thread) or
+ *  evict the task with the latest deadline (with the notification), and the
+ *  admission control - refuse the new tasks the late loop would serve more
+ *  than max_lateness_ms after their deadlines
+ *
+ *  @details Controller like function: calls the correspondent utility
+ *  function directly with its' arguments.
+ *
+ *  @note Every instance has its' own policy, e.g. the classes of the
+ *  @type{PriorityScheduler}: shed the low classes first (the eviction, the
+ *  tight admission limit), block the producers of the high ones.
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on @callback{set_scheduler_overload_policy}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {OVERLOAD_POLICY} policy - @see{OVERLOAD_POLICY}
+ *
+ *  @example
+ *    void count_shed_task(TASK_HANDLE handle, unsigned short arg) {...}
+ *    ...
+ *    set_overload_policy_in(
+ *        &io_scheduler,
+ *        (OVERLOAD_POLICY){
+ *            .full_queue_policy = TASK_FULL_QUEUE_EVICT_FURTHEST,
+ *            .on_evicted = count_shed_task,
+ *            .max_lateness_ms = 100});
+ *    => the full queue sheds its' furthest task for the earlier one, no new
+ *    tasks the loop would serve more than 100 ms late
+ *
+ */
+void set_overload_policy_in(Scheduler *ptr_scheduler, OVERLOAD_POLICY policy) {
+  set_scheduler_overload_policy(ptr_scheduler, policy);
+}
+
+/**
+ *  @brief Set up the overload policy of the @link{default_scheduler}, @see{
+ *  set_overload_policy_in}
+ *
+ *  @example
+ *    set_overload_policy(
+ *        (OVERLOAD_POLICY){.full_queue_policy = TASK_FULL_QUEUE_BLOCK,
+ *                          .block_timeout_ms = 50});
+ *
+ */
+void set_overload_policy(OVERLOAD_POLICY policy) {
+  set_overload_policy_in(&default_scheduler, policy);
+}
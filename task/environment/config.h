@@ -8,19 +8,289 @@
 #include <time.h>
 #include <unistd.h>
 
+/**
+ *  @brief Build-time capacity of the static arenas (@link{tasks_array},
+ *  id storage, queue backends' indexes) i.e. max quantity of the Tasks
+ *
+ *  @note No dynamic memory: all the arenas are static arrays sized via this
+ *  value. Choose the capacity via compiler flag, e.g.
+ *  -DTASK_CAPACITY=1000000
+ *
+ */
+#ifndef TASK_CAPACITY
+#define TASK_CAPACITY 50
+#endif
+
+#if TASK_CAPACITY < 1 || TASK_CAPACITY > 2'147'483'646
+#error "TASK_CAPACITY must be in range [1; 2147483646]"
+#endif
+
 enum Global_variables {
-  MAX_TASK_QUANTITY = 50,  /**< size of array for Tasks instances */
-  MIN_DELAY_FOR_SORT = 50, /**< min delay to run qsort in the Tasks array */
-  RATIO_SEC_MS = 1'000LL,  /**< for converting sec => ms */
+  MAX_TASK_QUANTITY = TASK_CAPACITY, /**< size of array for Tasks instances */
+  RATIO_SEC_MS = 1'000LL, /**< for converting sec => ms */
   RATIO_NANOSEC_MSEC = 1'000'000LL,   /**< for converting nsec => ms */
-  RATIO_SEC_NANOSEC = 1'000'000'000LL /**< for converting sec => ns */
+  RATIO_SEC_NANOSEC = 1'000'000'000LL, /**< for converting sec => ns */
+  TASK_HANDLE_SLOT_BITS = 32 /**< low bits of the @type{TASK_HANDLE} (id) */
 };
 
 /**
- *  @brief type for global Tasks counter
+ *  @brief Build-time selection of the Tasks queue storage engine (backend)
+ *  behind the @link{tasks_array}
+ *
+ *  @details
+ *  - TASK_QUEUE_BACKEND_SORTED_ARRAY - legacy array sorted descending via
+ *    @link{qsort} after every change (O(n log n) per operation)
+ *  - TASK_QUEUE_BACKEND_BINARY_HEAP - binary min-heap keyed by the absolute
+ *    deadline (O(log n) sift-up / sift-down per operation)
+ *  - TASK_QUEUE_BACKEND_TIMING_WHEEL - hierarchical (cascading) timing wheel
+ *    with 1 ms resolution (O(1) register and cancel), expired tasks are
+ *    drained slot by slot
+ *  - TASK_QUEUE_BACKEND_PACKED_DEADLINES - unordered array with the
+ *    deadlines packed apart from the tasks (structure of arrays): O(1)
+ *    register and cancel, the expired tasks are found via the vectorised
+ *    scan of the deadlines only (for the small and medium queues)
+ *
+ *  @note Choose the backend via compiler flag, e.g.
+ *  -DTASK_QUEUE_BACKEND=TASK_QUEUE_BACKEND_SORTED_ARRAY
+ *
+ */
+#define TASK_QUEUE_BACKEND_SORTED_ARRAY 1     /**< legacy qsort'ed array */
+#define TASK_QUEUE_BACKEND_BINARY_HEAP 2      /**< binary min-heap (default) */
+#define TASK_QUEUE_BACKEND_TIMING_WHEEL 3     /**< hierarchical timing wheel */
+#define TASK_QUEUE_BACKEND_PACKED_DEADLINES 4 /**< SoA deadlines scan */
+
+#ifndef TASK_QUEUE_BACKEND
+#define TASK_QUEUE_BACKEND TASK_QUEUE_BACKEND_BINARY_HEAP
+#endif
+
+/**
+ *  @brief Build-time selection of the id storage (the allocator of the
+ *  tasks' ids, @see{get_id})
+ *
+ *  @details
+ *  - TASK_ID_ALLOCATOR_FREE_LIST - singly linked list of the free ids on the
+ *    array (LIFO, the last freed id is reused first), linked at the first
+ *    call
+ *  - TASK_ID_ALLOCATOR_BITMAP - hierarchical bitmap (the bit per id plus the
+ *    summary bit per 64 ids), the lowest free id is found via tzcnt,
+ *    constant-initialised (zeroed => all the ids are free)
+ *  - TASK_ID_ALLOCATOR_ATOMIC_BITMAP - the same bitmap updated via atomic
+ *    compare-and-swap, i.e. get_id / free_id are thread-safe
+ *
+ *  @note Choose the allocator via compiler flag, e.g.
+ *  -DTASK_ID_ALLOCATOR=TASK_ID_ALLOCATOR_BITMAP
+ *
+ */
+#define TASK_ID_ALLOCATOR_FREE_LIST 1     /**< linked list (default) */
+#define TASK_ID_ALLOCATOR_BITMAP 2        /**< hierarchical bitmap */
+#define TASK_ID_ALLOCATOR_ATOMIC_BITMAP 3 /**< thread-safe bitmap */
+
+#ifndef TASK_ID_ALLOCATOR
+#define TASK_ID_ALLOCATOR TASK_ID_ALLOCATOR_FREE_LIST
+#endif
+
+/**
+ *  @brief Build-time multi-threaded (sharded) mode. Every thread (core) owns
+ *  its' shard of the scheduler: @link{tasks_array}, @link{task_count}, the id
+ *  storage, the queue backend's indexes and the clock / wait state. So the
+ *  controllers called from any thread work with the local shard without
+ *  locks, and the shards' heads are published to the global "earliest ready"
+ *  view ( @see{get_earliest_shard} )
+ *
+ *  @details
+ *  - TASK_SHARDED - 0 => one global scheduler (single-threaded), 1 => the
+ *    shard per thread
+ *  - TASK_SHARD_LOCAL - storage qualifier of the shard's state
+ *    (_Thread_local for the sharded mode)
+ *  - TASK_SHARDS_MAX - max quantity of the threads (shards) in the global
+ *    view
+ *
+ *  @note The static arenas are allocated per thread (TLS), i.e. the memory
+ *  is TASK_CAPACITY * threads. Choose the mode via compiler flag, e.g.
+ *  -DTASK_SHARDED=1 -DTASK_SHARDS_MAX=128
+ *
+ */
+#ifndef TASK_SHARDED
+#define TASK_SHARDED 0
+#endif
+
+#if TASK_SHARDED
+#define TASK_SHARD_LOCAL _Thread_local /**< the shard (thread) state */
+#else
+#define TASK_SHARD_LOCAL /**< one global scheduler */
+#endif
+
+#ifndef TASK_SHARDS_MAX
+#define TASK_SHARDS_MAX 64
+#endif
+
+#if TASK_SHARDS_MAX < 1
+#error "TASK_SHARDS_MAX must be positive"
+#endif
+
+/**
+ *  @brief Build-time capacity of the static lock-free command ring (the
+ *  register / remove / change delay commands submitted by the other threads
+ *  to the dispatcher thread, @see{submit_register_task}). Power of 2
+ *
+ *  @note Choose the capacity via compiler flag, e.g.
+ *  -DTASK_COMMAND_RING_CAPACITY=4096
+ *
+ */
+#ifndef TASK_COMMAND_RING_CAPACITY
+#define TASK_COMMAND_RING_CAPACITY 1024
+#endif
+
+#if TASK_COMMAND_RING_CAPACITY < 2 ||                                         \
+    (TASK_COMMAND_RING_CAPACITY & (TASK_COMMAND_RING_CAPACITY - 1)) != 0
+#error "TASK_COMMAND_RING_CAPACITY must be a power of 2"
+#endif
+
+/**
+ *  @brief Build-time quantity of the priority classes of the
+ *  @type{PriorityScheduler} ( @see{run_priority_ready_tasks_in} ): every
+ *  class is its' own @type{Scheduler} instance (its' own deadline queue),
+ *  class 0 is the highest one
+ *
+ *  @note Every class has the static arenas of TASK_CAPACITY tasks. Choose
+ *  the quantity via compiler flag, e.g. -DTASK_PRIORITY_CLASSES=4
+ *
+ */
+#ifndef TASK_PRIORITY_CLASSES
+#define TASK_PRIORITY_CLASSES 3
+#endif
+
+#if TASK_PRIORITY_CLASSES < 1
+#error "TASK_PRIORITY_CLASSES must be positive"
+#endif
+
+/**
+ *  @brief Build-time limits of the optional worker pool (the executor of the
+ *  expired callbacks, @see{start_worker_pool})
+ *
+ *  @details
+ *  - TASK_WORKERS_MAX - max quantity of the worker threads
+ *  - TASK_WORKER_DEQUE_CAPACITY - capacity of the static work-stealing deque
+ *    of each worker (power of 2)
+ *
+ *  @note Choose the limits via compiler flags, e.g.
+ *  -DTASK_WORKERS_MAX=32 -DTASK_WORKER_DEQUE_CAPACITY=4096
+ *
+ */
+#ifndef TASK_WORKERS_MAX
+#define TASK_WORKERS_MAX 16
+#endif
+
+#ifndef TASK_WORKER_DEQUE_CAPACITY
+#define TASK_WORKER_DEQUE_CAPACITY 1024
+#endif
+
+#if TASK_WORKERS_MAX < 1
+#error "TASK_WORKERS_MAX must be positive"
+#endif
+
+#if TASK_WORKER_DEQUE_CAPACITY < 2 ||                                         \
+    (TASK_WORKER_DEQUE_CAPACITY & (TASK_WORKER_DEQUE_CAPACITY - 1)) != 0
+#error "TASK_WORKER_DEQUE_CAPACITY must be a power of 2"
+#endif
+
+/**
+ *  @brief Build-time compact task record: the @type{Task} refers to its'
+ *  callback via the 16-bit index of the process-wide callback registry (
+ *  @see{get_callback_index} ) instead of the 8-byte pointer and keeps only
+ *  the deadline (no delay and creation timestamp), i.e. 16 bytes per task
+ *  instead of 48 (four tasks per cache line)
+ *
+ *  @details
+ *  - TASK_COMPACT_TASKS - 0 => the full @type{Task} record, 1 => the compact
+ *    one
+ *  - TASK_CALLBACKS_MAX - capacity of the callback registry i.e. max quantity
+ *    of the distinct callbacks (registering of the extra one fails)
+ *
+ *  @note Read the task's callback via @link{get_task_callback} (works for
+ *  both records). The timing wheel backend needs the creation timestamp, so
+ *  it works with the full record only. Choose the record via compiler flag,
+ *  e.g. -DTASK_COMPACT_TASKS=1 -DTASK_CALLBACKS_MAX=1024
+ *
+ */
+#ifndef TASK_COMPACT_TASKS
+#define TASK_COMPACT_TASKS 0
+#endif
+
+#ifndef TASK_CALLBACKS_MAX
+#define TASK_CALLBACKS_MAX 256
+#endif
+
+#if TASK_CALLBACKS_MAX < 1 || TASK_CALLBACKS_MAX > 65'535
+#error "TASK_CALLBACKS_MAX must be in range [1:65535]"
+#endif
+
+#if TASK_COMPACT_TASKS &&                                                      \
+    TASK_QUEUE_BACKEND == TASK_QUEUE_BACKEND_TIMING_WHEEL
+#error "TASK_COMPACT_TASKS is not supported by the timing wheel backend"
+#endif
+
+/**
+ *  @brief type for global Tasks counter (and ids). The narrowest one to fit
+ *  @link{TASK_CAPACITY} (+1 for the "no task" sentinel values)
  *
  */
+#if TASK_CAPACITY < 65'535
 typedef unsigned short TASK_COUNTER; /**< type for tasks counter */
+#else
+typedef unsigned int TASK_COUNTER; /**< type for tasks counter */
+#endif
+
+/**
+ *  @brief type for the task handles given out to the user (register_task,
+ *  remove_task, change_task_delay). Packs the slot i.e. the task's id (low
+ *  @link{TASK_HANDLE_SLOT_BITS} bits, the direct @link{tasks_array} offset)
+ *  and the generation of the slot (high bits), @see{get_id_handle}
+ *
+ *  @note The generation is bumped every time the id is freed, so a stale
+ *  handle of the removed (or served) task never matches the newer task that
+ *  reuses the same id
+ *
+ */
+typedef unsigned long long TASK_HANDLE; /**< type for the task handles */
+
+/**
+ *  @brief type for monotonic clock timestamps (ns) i.e. 64-bit integer ticks,
+ *  @see{get_now_ticks}
+ *
+ */
+typedef long long TASK_TICKS; /**< type for monotonic timestamps (ns) */
+
+/**
+ *  @brief type for delays (ms), 64-bit i.e. no 65.5 s ceiling of the
+ *  @type{unsigned short} one
+ *
+ */
+typedef unsigned long long TASK_DELAY; /**< type for delays (ms) */
+
+/**
+ *  @brief type for the indexes of the callback registry (
+ *  @see{get_callback_index} )
+ *
+ */
+typedef unsigned short TASK_CALLBACK_INDEX; /**< type for callback indexes */
+
+/**
+ *  @brief The scheduler instance: all the state of one queue (the tasks'
+ *  arena, the id storage, the queue backend's indexes, the clock tick, the
+ *  waiter, the timerfd and the command ring), @see{Scheduler} (defined in
+ *  @file{environment/scheduler_config.h})
+ *
+ */
+typedef struct s_Scheduler Scheduler;
+
+/**
+ *  @brief The priority scheduler: @link{TASK_PRIORITY_CLASSES} scheduler
+ *  instances (one per priority class) served by one loop, @see{
+ *  PriorityScheduler} (defined in @file{environment/scheduler_config.h})
+ *
+ */
+typedef struct s_Priority_scheduler PriorityScheduler;
 
 /**
  *  @brief Callback to use after delay time in the task is gone
@@ -29,6 +299,31 @@ typedef unsigned short TASK_COUNTER; /**< type for tasks counter */
  */
 typedef void (*task_callback)(unsigned short arg);
 
+#if TASK_COMPACT_TASKS
+/**
+ *  @brief Structure for detailing the task entity (the compact record, @see{
+ *  TASK_COMPACT_TASKS} )
+ *
+ *  @details
+ *  - @type{TASK_TICKS} deadline_ticks - absolute expiry monotonic timestamp
+ *    (ns) i.e. the creation timestamp + delay (ms => ns), @see{
+ *    get_task_deadline_ticks}
+ *  - @type{TASK_CALLBACK_INDEX} callback_index - index of the callback in the
+ *    callback registry, @see{get_task_callback}
+ *  - @type{unsigned short} func_arg - argument to call the callback with
+ *    after delay is gone
+ *  - @type{TASK_COUNTER} id - id of the current Task instance (the slot of
+ *    its' @type{TASK_HANDLE})
+ *
+ */
+typedef struct s_Task_template {
+  TASK_TICKS deadline_ticks; /**< absolute expiry monotonic timestamp (ns) */
+  TASK_CALLBACK_INDEX callback_index; /**< index of the callback */
+  unsigned short func_arg; /**< argument to call the callback with */
+  TASK_COUNTER id; /**< id of the current Task (set up at the creating moment
+                 manually!) */
+} Task;
+#else
 /**
  *  @brief Structure for detailing the task entity
  *
@@ -36,29 +331,32 @@ typedef void (*task_callback)(unsigned short arg);
  *  - @type{task_callback} - @see{task_callback}
  *  - @type{unsigned short} func_arg - argument to call @link{task_callback}
  *    with after delay is gone
- *  - @type{unsigned short} delay - delay time (ms) to freeze @link{callback}
+ *  - @type{TASK_DELAY} delay - delay time (ms) to freeze @link{callback}
  *    calling
- *  - @type{TASK_ID} id - id of the current Task instance
- *  - @type{struct timespec} created_timespec - timespec structure of
- *    the Task instance creating
- *    @note Before usage (!transformation due to @link{delay} measurement units
- *    (e.g. ms) expected!) do this:
- *    e.g. (Task.created_timespec.tv_sec * 1000LL +
- *      Task.created_timespec.tv_nsec / 1000000LL) or
- *    (Task.created_timespec.tv_sec * RATIO_SEC_MS +
- *      Task.created_timespec.tv_nsec / RATIO_NANOSEC_MSEC)
+ *  - @type{TASK_COUNTER} id - id of the current Task instance (the slot of
+ *    its' @type{TASK_HANDLE})
+ *  - @type{TASK_TICKS} created_ticks - monotonic timestamp (ns) of the Task
+ *    instance creating ( @see{get_now_ticks} )
+ *    @note Before comparing with @link{delay} transform the units, e.g.
+ *    Task.created_ticks / RATIO_NANOSEC_MSEC (ms)
+ *  - @type{TASK_TICKS} deadline_ticks - absolute expiry monotonic timestamp
+ *    (ns) i.e. created_ticks + delay (ms => ns). Counted once at the
+ *    registration (and at the delay changing) via
+ *    @link{get_task_deadline_ticks}, so the queue backends order the tasks and
+ *    check the readiness via one comparison
  *
  */
 typedef struct s_Task_template {
   task_callback callback;  /**< callback to call after delay time is gone */
   unsigned short func_arg; /**< argument to call @link{callback} with */
-  unsigned short
+  TASK_DELAY
       delay;       /**< delay time (ms) to freeze @link{callback} calling */
   TASK_COUNTER id; /**< id of the current Task (set up at the creating moment
                  manually!) */
-  struct timespec created_timespec; /**< created_timespec structure of the Task
-                                       instance creating */
+  TASK_TICKS created_ticks;  /**< monotonic timestamp (ns) of the creating */
+  TASK_TICKS deadline_ticks; /**< absolute expiry monotonic timestamp (ns) */
 } Task;
+#endif
 
 /**
  *  @details
@@ -1,11 +1,69 @@
+#include <limits.h>
+#include <pthread.h>
+
 #include "./config.h"
+#include "./scheduler_config.h"
 
-/** Global counter for Tasks. Range [0:MAX_TASK_QUANTITY],
- * @note 0 => 0 Tasks,
- * 1 => 1 Task in the @link{tasks_array} but with index 0 !
- * 2 => 2 Tasks in the @link{tasks_array} but last with index 1 !
+/** global (per thread in the sharded mode) default @link{Scheduler}
+ * instance, served by the functions without the *_in suffix
+ * (e.g. @link{register_task}). The Tasks are counted via
+ * default_scheduler.task_count and collected in default_scheduler.tasks_array
  * */
-TASK_COUNTER task_count = 0;
+TASK_SHARD_LOCAL Scheduler default_scheduler = SCHEDULER_INITIALIZER;
+
+/**
+ *  @brief Initialize the caller-provided scheduler instance (empty queue),
+ *  the same as @link{SCHEDULER_INITIALIZER} for the storage that isn't
+ *  static (e.g. the arena of the caller's allocator)
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{ptr_scheduler}
+ *
+ *  @note Don't initialize the instance in use (the waiting thread, the open
+ *  timerfd, e.g. @link{close_scheduler_fd_in} first)
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @example
+ *    Scheduler *ptr_scheduler = my_arena_alloc(sizeof(Scheduler));
+ *    init_scheduler(ptr_scheduler);
+ *    register_task_in(ptr_scheduler, show_task_info, 1, 400);
+ *
+ */
+void init_scheduler(Scheduler *ptr_scheduler) {
+  // no compound literal: the instance is too large for the stack
+  memset(ptr_scheduler, 0, sizeof(Scheduler));
+
+  pthread_mutex_init(&ptr_scheduler->wait.wait_mutex, NULL);
+  ptr_scheduler->wait.waited_deadline_ticks = LLONG_MIN;
+  ptr_scheduler->fd.scheduler_fd = -1;
+  ptr_scheduler->fd.armed_deadline_ticks = LLONG_MAX;
+}
+
+/**
+ *  @brief Initialize the priority scheduler: every class' instance (
+ *  @see{init_scheduler}) and the aging
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{ptr_priority_scheduler}
+ *  - implicit dependency on @callback{init_scheduler}
+ *
+ *  @param {PriorityScheduler *} ptr_priority_scheduler - the priority
+ *    scheduler to initialize
+ *  @param {TASK_DELAY} aging_ms - @see{PriorityScheduler} (0 => strict
+ *    priorities)
+ *
+ *  @example
+ *    static PriorityScheduler net_scheduler;
+ *    ...
+ *    init_priority_scheduler(&net_scheduler, 50);
+ *
+ */
+void init_priority_scheduler(PriorityScheduler *ptr_priority_scheduler,
+                             TASK_DELAY aging_ms) {
+  for (int priority = 0; priority < TASK_PRIORITY_CLASSES; priority += 1) {
+    init_scheduler(&ptr_priority_scheduler->classes[priority]);
+  }
 
-/** global array for @link{Task} instances collecting and handling */
-Task tasks_array[MAX_TASK_QUANTITY] = {};
+  ptr_priority_scheduler->aging_ms = aging_ms;
+}
@@ -2,8 +2,8 @@
 #define GLOBAL_VARIABLES_H
 
 #include "./config.h"
+#include "./scheduler_config.h"
 
-extern TASK_COUNTER task_count;
-extern Task tasks_array[];
+extern TASK_SHARD_LOCAL Scheduler default_scheduler;
 
 #endif
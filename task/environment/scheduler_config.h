@@ -0,0 +1,114 @@
+#ifndef SCHEDULER_CONFIG_H
+#define SCHEDULER_CONFIG_H
+
+#include "../utilities/handle_clock_config.h"
+#include "../utilities/handle_command_ring_config.h"
+#include "../utilities/handle_id_config.h"
+#include "../utilities/handle_overload_config.h"
+#include "../utilities/handle_periodic_tasks_config.h"
+#include "../utilities/handle_scheduler_fd_config.h"
+#include "../utilities/handle_timer_slack_config.h"
+#include "../utilities/handle_wait_config.h"
+#include "../utilities/task_queue_config.h"
+#include "./config.h"
+
+/**
+ *  @details
+ *  The scheduler instance i.e. all the state of one queue. The controllers'
+ *  *_in functions (e.g. @link{register_task_in}) work with the given
+ *  instance, the rest ones (e.g. @link{register_task}) with the
+ *  @link{default_scheduler}
+ *  - task_count - counter of the Tasks. Range [0:MAX_TASK_QUANTITY]
+ *    @note 0 => 0 Tasks,
+ *    1 => 1 Task in the @link{tasks_array} but with index 0 !
+ *  - tasks_array - arena of the @link{Task} instances
+ *  - queue - the queue backend's indexes ( @see{TASK_QUEUE_STATE} )
+ *  - ids - the id storage ( @see{ID_STORAGE} )
+ *  - periodic - the periods of the tasks ( @see{PERIODIC_TASKS_STATE} )
+ *  - firing - the task whose callback is being called (
+ *    @see{FIRING_TASK_STATE} )
+ *  - slacks - the timer slack of the tasks ( @see{TASK_SLACKS_STATE} )
+ *  - overload - the overload policy and counters ( @see{OVERLOAD_STATE} )
+ *  - clock - the clock tick ( @see{CLOCK_TICK} )
+ *  - wait - the waiter ( @see{DEADLINE_WAITER} )
+ *  - fd - the timerfd ( @see{SCHEDULER_FD_STATE} )
+ *  - commands - the command ring ( @see{COMMAND_RING} )
+ *
+ *  @note The storage is provided by the caller (static, stack of the long
+ *  living thread, the arena of the caller's own allocator), the size is
+ *  fixed at the build time via @link{TASK_CAPACITY}. Initialize it via
+ *  @link{SCHEDULER_INITIALIZER} (static) or @link{init_scheduler} before the
+ *  first use. Never copy the instance in use: the id storage links its' own
+ *  elements via pointers.
+ *  @note The task handles are valid only within the instance that gave them
+ *  out. One instance is served by one thread at a time (the other threads
+ *  submit via the command ring, e.g. @link{submit_register_task_in})
+ *
+ *  @example
+ *    static Scheduler io_scheduler = SCHEDULER_INITIALIZER;
+ *    ...
+ *    register_task_in(&io_scheduler, show_task_info, 1, 400);
+ *    while (io_scheduler.task_count > 0) {
+ *      wait_next_deadline_in(&io_scheduler, HANDLE_WAIT_FOREVER);
+ *      run_ready_tasks_in(&io_scheduler, (RUN_BUDGET){});
+ *    }
+ *
+ */
+struct s_Scheduler {
+  TASK_COUNTER task_count;              /**< counter of the Tasks */
+  Task tasks_array[MAX_TASK_QUANTITY];  /**< arena of the Tasks */
+  TASK_QUEUE_STATE queue;               /**< the queue backend's indexes */
+  ID_STORAGE ids;                       /**< the id storage */
+  PERIODIC_TASKS_STATE periodic;        /**< the periods of the tasks */
+  FIRING_TASK_STATE firing;             /**< the firing task */
+  TASK_SLACKS_STATE slacks;             /**< the slack of the tasks */
+  OVERLOAD_STATE overload;              /**< the overload policy */
+  CLOCK_TICK clock;                     /**< the clock tick */
+  DEADLINE_WAITER wait;                 /**< the waiter */
+  SCHEDULER_FD_STATE fd;                /**< the timerfd */
+  COMMAND_RING commands;                /**< the command ring */
+};
+
+/**
+ *  @brief Static initializer of the @type{Scheduler} (empty queue), e.g.
+ *  static Scheduler scheduler = SCHEDULER_INITIALIZER;
+ *
+ */
+#define SCHEDULER_INITIALIZER                                                  \
+  {.wait = DEADLINE_WAITER_INITIALIZER, .fd = SCHEDULER_FD_STATE_INITIALIZER}
+
+/**
+ *  @details
+ *  The priority scheduler: one @type{Scheduler} instance (i.e. its' own
+ *  deadline queue) per priority class, served by one loop via
+ *  @link{run_priority_ready_tasks_in}
+ *  - classes - the classes' instances, class 0 is the highest priority
+ *  - aging_ms - every aging_ms of lateness promote the expired task one
+ *    class (the earliest deadline first within the same class), so the low
+ *    classes can't starve. 0 => strict priorities
+ *
+ *  @note The tasks are registered via @link{register_priority_task_in}, the
+ *  rest of the task's operations (remove, change delay, requeue from the
+ *  callback, periodic, slack) are the usual *_in ones with the class'
+ *  instance, e.g. remove_task_in(&ptr_priority_scheduler->classes[1], id):
+ *  the handle is valid only within its' class. The storage is provided by the
+ *  caller (static), initialize it via @link{init_priority_scheduler}.
+ *
+ *  @example
+ *    static PriorityScheduler net_scheduler;
+ *    ...
+ *    init_priority_scheduler(&net_scheduler, 50);
+ *    register_priority_task_in(&net_scheduler, 0, show_task_info, 1, 400);
+ *    run_priority_ready_tasks_in(&net_scheduler, (RUN_BUDGET){});
+ *
+ */
+struct s_Priority_scheduler {
+  Scheduler classes[TASK_PRIORITY_CLASSES]; /**< class => its' own queue */
+  TASK_DELAY aging_ms; /**< lateness (ms) per one class of promotion */
+};
+
+void init_scheduler(Scheduler *ptr_scheduler);
+void init_priority_scheduler(PriorityScheduler *ptr_priority_scheduler,
+                             TASK_DELAY aging_ms);
+
+#endif
@@ -3,10 +3,16 @@
 
 int main(void) {
   while (true) {
-    // !caution improper FSM logic implementation!
-    // TODO! Fix this to desired logic from the ./Architecture and structure.md
-    // !
-    handle_events_tasks();
-    usleep(100'000);
+    // sleep till the earliest deadline (no polling), an earlier deadline
+    // registered by the other thread wakes the loop up
+    wait_next_deadline(HANDLE_WAIT_FOREVER);
+
+    // apply the commands submitted by the other threads (submit_register_task
+    // etc.), a wake up on the first one of the batch
+    apply_task_commands(0);
+
+    // call all the ready tasks' callbacks straight from the queue (pass the
+    // budget, e.g. (RUN_BUDGET){.max_tasks = 100}, to share the loop)
+    run_ready_tasks((RUN_BUDGET){});
   }
 }
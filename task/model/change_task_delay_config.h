@@ -10,7 +10,7 @@
  *  - CHANGE_TASK_DELAY_ARRAY_OF_TASKS_EMPTY - current task counter value is 0
  *  - CHANGE_TASK_DELAY_TASK_ID_IS_NOT_DETERMINED - no such task with given ID
  *  - CHANGE_TASK_DELAY_TIMESPEC_GET_ERROR - at the moment of getting current
- *    timestamp via timespec_get() function with TIME_UTC base problems occured
+ *    timestamp via get_now_ticks() monotonic clock function problems occured
  *
  */
 enum Change_task_delay_errors_codes {
@@ -22,7 +22,7 @@ enum Change_task_delay_errors_codes {
       2, /**< no such task with given ID */
   CHANGE_TASK_DELAY_TIMESPEC_GET_ERROR =
       3, /**< at the moment of getting current
-          *    timestamp via timespec_get() function with TIME_UTC base problems
+          *    timestamp via get_now_ticks() monotonic clock function problems
           * occured */
 };
 
@@ -42,7 +42,7 @@ enum Change_task_delay_errors_codes {
  *  @example
  *    *** Predefined context ***
  *    PROMISE_TASK_ID log_id = register_task(some_callback, 400, 400);
- *    TASK_COUNTER task_id;
+ *    TASK_HANDLE task_id;
  *    ***
  *    task_id = 0; (first one)
  *    ***
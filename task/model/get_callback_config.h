@@ -7,9 +7,11 @@
  *  @details
  *  - GET_CALLBACK_ARRAY_OF_TASKS_EMPTY - current task counter value is 0
  *  - GET_CALLBACK_TIMESPEC_GET_ERROR - at the moment of getting current
- *    timestamp via timespec_get() function with TIME_UTC base problems occured
- *  - GET_CALLBACK_PENDING - the least task's delay is not gone yet
+ *    timestamp via get_now_ticks() monotonic clock function problems occured
+ *  - GET_CALLBACK_PENDING - the least task's deadline is not due yet
  *  - GET_CALLBACK_FREE_ID_ERROR - error at the process of freeing the id
+ *  - GET_CALLBACK_TASK_FIRING - called from the callback of the firing task
+ *    (its' task is still on top, @see{begin_firing_task})
  *
  */
 enum Get_callback_errors_codes {
@@ -17,9 +19,10 @@ enum Get_callback_errors_codes {
   /**< current task counter value is 0 */
   GET_CALLBACK_TIMESPEC_GET_ERROR =
       2,                    /**< at the moment of getting current timestamp via
-                             *    timespec_get() function with TIME_UTC base problems occured */
-  GET_CALLBACK_PENDING = 3, /**< the least task's delay is not gone yet */
+                             *    get_now_ticks() monotonic clock function problems occured */
+  GET_CALLBACK_PENDING = 3, /**< the least task's deadline is not due yet */
   GET_CALLBACK_FREE_ID_ERROR = 4, /**< error at the process of freeing the id */
+  GET_CALLBACK_TASK_FIRING = 5,   /**< called from the firing callback */
 };
 
 /**
@@ -45,12 +48,12 @@ union Union_task {
  *    @type{Task} for TASK (SUCCESS, everything is OK) or
  *    one of error codes for ERROR_CODE
  *    i.e. (GET_CALLBACK_ARRAY_OF_TASKS_EMPTY | GET_CALLBACK_PENDING |
- *    GET_CALLBACK_FREE_ID_ERROR)
+ *    GET_CALLBACK_FREE_ID_ERROR | GET_CALLBACK_TASK_FIRING)
  *
  *  @example
  *    *** Predefined context ***
  *    PROMISE_TASK_ID log_id = register_task(some_callback, 400, 400);
- *    TASK_COUNTER task_id;
+ *    TASK_HANDLE task_id;
  *    ***
  *    task_id = 0; (first one)
  *    ***
@@ -66,10 +69,8 @@ union Union_task {
  *        func_arg: 400;
  *        delay:  400;
  *        id: 0;
- *        created_timespec: {
- *          tv.sec = 0;
- *          tv.nsec = 6291136;
- *        }
+ *        created_ticks: 6291136;
+ *        deadline_ticks: 406291136;
  *      }
  *      break;
  *    case ERROR_CODE:
@@ -88,7 +89,7 @@ union Union_task {
  *    }
  *
  *    *** Run callback with arg ***
- *    task.callback(task.func_arg);
+ *    get_task_callback(&task)(task.func_arg);
  *
  */
 typedef struct s_Get_callback_result {
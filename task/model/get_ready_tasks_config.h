@@ -0,0 +1,83 @@
+#ifndef GET_READY_TASKS_CONFIG_H
+#define GET_READY_TASKS_CONFIG_H
+
+#include "../environment/config.h"
+
+/**
+ *  @details
+ *  - GET_READY_TASKS_DONE_SUCCESSFULLY - no errors, done successfully
+ *  - GET_READY_TASKS_INVALID_BUFFER - NULL buffer for the non zero capacity
+ *  - GET_READY_TASKS_TIMESPEC_GET_ERROR - at the moment of getting current
+ *    timestamp via get_now_ticks() monotonic clock function problems occured
+ *  - GET_READY_TASKS_FREE_ID_ERROR - error at the process of freeing the id
+ *
+ */
+enum Get_ready_tasks_errors_codes {
+  GET_READY_TASKS_DONE_SUCCESSFULLY = 0, /**< no errors, done successfully */
+  GET_READY_TASKS_INVALID_BUFFER =
+      1, /**< NULL buffer for the non zero capacity */
+  GET_READY_TASKS_TIMESPEC_GET_ERROR =
+      2, /**< at the moment of getting current timestamp via get_now_ticks()
+            monotonic clock function problems occured */
+  GET_READY_TASKS_FREE_ID_ERROR =
+      3, /**< error at the process of freeing the id */
+};
+
+/**
+ *  @details
+ *  Union for handling results of @link{get_ready_tasks} function execution.
+ *  Possible values @note only one of is possible!:
+ *  - READY_COUNT - quantity of the ready tasks copied to the buffer (0 if
+ *    nothing is ready)
+ *  - CODES_RESULT - Error codes at the process of getting the ready tasks
+ *
+ */
+union Union_ready_tasks {
+  size_t READY_COUNT; /**< quantity of the ready tasks copied to the buffer */
+  enum Get_ready_tasks_errors_codes
+      CODES_RESULT; /**< Error codes at the process of getting the ready
+                       tasks */
+};
+
+/**
+ *  @details
+ *  Structure for handling results of @link{get_ready_tasks} function
+ *  execution.
+ *  - type - (SUCCESS | ERROR_CODE)
+ *  - get_ready_tasks_result - union @link{union Union_ready_tasks}, that is
+ *    READY_COUNT (SUCCESS, everything is OK) or
+ *    one of error codes for ERROR_CODE
+ *    i.e. (GET_READY_TASKS_INVALID_BUFFER | GET_READY_TASKS_TIMESPEC_GET_ERROR
+ *    | GET_READY_TASKS_FREE_ID_ERROR)
+ *
+ *  @example
+ *    Task ready_tasks[64];
+ *    PROMISE_READY_TASKS log_ready = get_ready_tasks(ready_tasks, 64);
+ *
+ *    switch (log_ready.type) {
+ *    case SUCCESS:
+ *      for (size_t i = 0; i < log_ready.get_ready_tasks_result.READY_COUNT;
+ *           i += 1) {
+ *        get_task_callback(&ready_tasks[i])(ready_tasks[i].func_arg);
+ *      }
+ *      OUTPUT: e.g. 64 => call get_ready_tasks() again, there may be more
+ *      break;
+ *    case ERROR_CODE:
+ *      printf("ERROR_CODE: %hd\n",
+ *        log_ready.get_ready_tasks_result.CODES_RESULT);
+ *      OUTPUT: e.g. GET_READY_TASKS_TIMESPEC_GET_ERROR
+ *      break;
+ *    default:
+ *      fprintf(stderr, "Error(%s() function at %d): ups... Unknown
+ *        log_ready.type\n", __func__, __LINE__);
+ *      break;
+ *    }
+ *
+ */
+typedef struct s_Get_ready_tasks_result {
+  PROMISE_TYPE type; /**< SUCCESS | ERROR_CODE */
+  union Union_ready_tasks
+      get_ready_tasks_result; /**< READY_COUNT | CODES_RESULT */
+} PROMISE_READY_TASKS;
+
+#endif
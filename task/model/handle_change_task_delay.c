@@ -8,24 +8,31 @@
  *
  *  @note ! Impure function !
  *  - mutates the outer Task in the @link{tasks_array}
- *  - implicit dependency on @type{TASK_COUNTER}
+ *  - mutates the @link{firing} of the @link{ptr_scheduler}
+ *  - implicit dependency on @type{TASK_HANDLE}
  *  - implicit dependency on @type{PROMISE_CHANGE_TASK_DELAY}
  *  - implicit dependency on @type{Task}
- *  - implicit dependency on @type{struct timespec} of <time.h>
- *  - implicit dependency on @callback{timespec_get} function of <time.h>
- *  - implicit dependency on @callback{sort_tasks_descending_by_delay_func}
- *  - under the hood uses @link{qsort} function from <stdlib.h> for sorting
- *    descending @link{tasks_array} via Task.delay(ms)
+ *  - implicit dependency on @type{TASK_TICKS}
+ *  - implicit dependency on @callback{get_now_ticks_in}
+ *  - implicit dependency on @callback{resolve_id_handle}
+ *  - implicit dependency on @callback{notify_new_deadline_in}
+ *  - implicit dependency on @callback{rearm_scheduler_fd}
+ *  - implicit dependency on @callback{get_coalesced_deadline_ticks}
+ *  - implicit dependency on @callback{task_queue_reschedule} (the queue
+ *    backend is set up via @link{TASK_QUEUE_BACKEND})
  *
  *  @note Returns promise like structure @link{PROMISE_CHANGE_TASK_DELAY}!
  *  Examine the example below how to handle it properly!
  *
  *  @note After the moment the delay time is successfully changed, inner
- *  @link{Task.created_timespec} is newed! So previous delay(ms) is omitted.
+ *  @link{Task.created_ticks} is newed! So previous delay(ms) is omitted.
+ *  @note The task whose callback is being called is requeued in place (the
+ *  same id and handle), @see{handle_requeue_current_task}
  *
- *  @param {TASK_COUNTER} id - id of the task from @link{tasks_array} to change
- *  delay at
- *  @param {unsigned short} new_delay - new delay value (ms!)
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_HANDLE} id - handle of the task from @link{tasks_array} to
+ *  change delay at ( @see{register_task} )
+ *  @param {TASK_DELAY} new_delay - new delay value (ms!)
  *
  *  @return {PROMISE_CHANGE_TASK_DELAY} - structure of complex type
  *    @see{PROMISE_CHANGE_TASK_DELAY} for details and examples below for
@@ -35,21 +42,21 @@
  *      - CHANGE_TASK_DELAY_ARRAY_OF_TASKS_EMPTY - current task
  *        counter value is 0
  *      - CHANGE_TASK_DELAY_TASK_ID_IS_NOT_DETERMINED - no such task
- *        with given ID
+ *        with given ID (or the handle is stale)
  *      - CHANGE_TASK_DELAY_TIMESPEC_GET_ERROR - at the moment of
- *        getting current timestamp via @link{timespec_get}() function with
- *        TIME_UTC base problems occured
+ *        getting current timestamp via @link{get_now_ticks}() monotonic clock
+ *        function problems occured
  *
  *  @example
  *     *** Predefined context ***
  *    PROMISE_TASK_ID log_id = register_task(some_callback, 400, 400);
- *    TASK_COUNTER task_id;
+ *    TASK_HANDLE task_id;
  *    ***
  *    task_id = 0; (first one)
  *    ***
  *    *** Usage ***
  *    PROMISE_CHANGE_TASK_DELAY log_change_task_delay =
- * handle_change_task_delay(0, 1600);
+ * handle_change_task_delay(&default_scheduler, 0, 1600);
  *
  *    switch (log_change_task_delay.type) {
  *    case SUCCESS:
@@ -71,87 +78,65 @@
  *      break;
  *    }
  */
-PROMISE_CHANGE_TASK_DELAY handle_change_task_delay(TASK_COUNTER id,
-                                                   unsigned short new_delay) {
+PROMISE_CHANGE_TASK_DELAY handle_change_task_delay(Scheduler *ptr_scheduler,
+                                                   TASK_HANDLE id,
+                                                   TASK_DELAY new_delay) {
   // check that @link{tasks_array} is not empty
-  if (task_count == 0) {
+  if (ptr_scheduler->task_count == 0) {
     return (PROMISE_CHANGE_TASK_DELAY){
         .type = ERROR_CODE,
         .CODES_RESULT = CHANGE_TASK_DELAY_ARRAY_OF_TASKS_EMPTY};
   }
 
-  // check, that @link{id} is in range [0; task_count - 1]
-  // @note task_count - 1 ? => task id ( @link{Task tasks_array[]} index) ==
-  // task_count - 1
-  // id @type{unsigned short} may not be negative! so -1 => 65536 - 1 = 65535
-  //  where 2 ** 16 (i.e. 2 * 8 i.e. 2 bytes = 16) = 65536
-  if (id >= task_count) {
+  // set up current monotonic timestamp (the cached one inside the opened
+  // tick, @see{begin_clock_tick_in})
+  PROMISE_CLOCK_TICKS log_ticks = get_now_ticks_in(ptr_scheduler);
+
+  if (log_ticks.type == ERROR_CODE) {
     return (PROMISE_CHANGE_TASK_DELAY){
         .type = ERROR_CODE,
-        .CODES_RESULT = CHANGE_TASK_DELAY_TASK_ID_IS_NOT_DETERMINED};
+        .CODES_RESULT = CHANGE_TASK_DELAY_TIMESPEC_GET_ERROR};
   }
 
-  // set up current timestamp
-  struct timespec ts = {};
-  int written_var_count = timespec_get(&ts, TIME_UTC);
+  // get the task's slot over the handle (stale handles are rejected)
+  PROMISE_ID_VALUE log_id_value = resolve_id_handle(ptr_scheduler, id);
 
-  // ts.tv_sec and ts.tv_nsec are set ? => 1(OK) (two fields are set, 1 is base
-  // for @link{TIME_UTC})
-  if (written_var_count == 0) {
+  if (log_id_value.type == ERROR_CODE) {
     return (PROMISE_CHANGE_TASK_DELAY){
         .type = ERROR_CODE,
-        .CODES_RESULT = CHANGE_TASK_DELAY_TIMESPEC_GET_ERROR};
+        .CODES_RESULT = CHANGE_TASK_DELAY_TASK_ID_IS_NOT_DETERMINED};
   }
 
-  // get the task over @link{id} and change the task
-  for (TASK_COUNTER i = 0; i < task_count; i += 1) {
-    // use bidirectional search
-    // search from the beginning
-    if (tasks_array[i].id == id) {
-      // update the task's fields
-      tasks_array[i].created_timespec = ts;
-      tasks_array[i].delay = new_delay;
-
-      // sort @link{tasks_array} only if:
-      // - more than one task in it
-      // - current task index > 0 and
-      //   current task's delay > previous task's delay
-      if ((task_count > 1) &&
-          ((i > 0) && (tasks_array[i].delay > tasks_array[i - 1].delay))) {
-        // sort @link{tasks_array} descending via Task.delay (ms)
-        sort_tasks_descending_by_delay(tasks_array, MAX_TASK_QUANTITY,
-                                       task_count);
-      }
+  // get the task over the slot and change the task's fields (the queue
+  // backend restores the order itself)
+  if (task_queue_reschedule(ptr_scheduler,
+                            log_id_value.handle_id_result.ID_VALUE, new_delay,
+                            log_ticks.handle_clock_result.TICKS) !=
+      TASK_QUEUE_DONE_SUCCESSFULLY) {
+    return (PROMISE_CHANGE_TASK_DELAY){
+        .type = ERROR_CODE,
+        .CODES_RESULT = CHANGE_TASK_DELAY_TASK_ID_IS_NOT_DETERMINED};
+  }
 
-      return (PROMISE_CHANGE_TASK_DELAY){
-          .type = SUCCESS, .CODES_RESULT = CHANGE_TASK_DELAY_DONE_SUCCESSFULLY};
-    }
+  // the firing task is requeued in place (kept in the queue after its'
+  // callback), @see{end_firing_task}
+  if (ptr_scheduler->firing.is_firing &&
+      (ptr_scheduler->firing.handle == id)) {
+    ptr_scheduler->firing.is_kept = true;
+  }
 
-    // search from the end
-    if (tasks_array[task_count - 1 - i].id == id) {
-      // update the task's fields
-      tasks_array[task_count - 1 - i].created_timespec = ts;
-      tasks_array[task_count - 1 - i].delay = new_delay;
+  // the same deadline the queue backend counted ( @see{set_task_delay} )
+  TASK_TICKS new_deadline_ticks = get_coalesced_deadline_ticks(
+      get_task_deadline_ticks(log_ticks.handle_clock_result.TICKS, new_delay),
+      ptr_scheduler->slacks
+          .task_slacks[log_id_value.handle_id_result.ID_VALUE]);
 
-      // sort @link{tasks_array} only if:
-      // - more than one task in it
-      // - current task index > 0 and
-      //   current task's delay > previous task's delay
-      if ((task_count > 1) && ((task_count - 1 - i > 0) &&
-                               (tasks_array[task_count - 1 - i].delay >
-                                tasks_array[task_count - 2 - i].delay))) {
-        // sort @link{tasks_array} descending via Task.delay (ms)
-        sort_tasks_descending_by_delay(tasks_array, MAX_TASK_QUANTITY,
-                                       task_count);
-      }
+  // wake up the serving thread if it sleeps till a later deadline
+  notify_new_deadline_in(ptr_scheduler, new_deadline_ticks);
 
-      return (PROMISE_CHANGE_TASK_DELAY){
-          .type = SUCCESS, .CODES_RESULT = CHANGE_TASK_DELAY_DONE_SUCCESSFULLY};
-    }
-  }
+  // re-arm the scheduler's descriptor (if any) if the head moved earlier
+  rearm_scheduler_fd(ptr_scheduler, new_deadline_ticks);
 
-  // handle case when no match over @link{id} happened
   return (PROMISE_CHANGE_TASK_DELAY){
-      .type = ERROR_CODE,
-      .CODES_RESULT = CHANGE_TASK_DELAY_TASK_ID_IS_NOT_DETERMINED};
+      .type = SUCCESS, .CODES_RESULT = CHANGE_TASK_DELAY_DONE_SUCCESSFULLY};
 }
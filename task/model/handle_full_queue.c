@@ -0,0 +1,187 @@
+#include <stdatomic.h>
+
+#include "../environment/config.h"
+#include "../environment/global_variables.h"
+#include "../utilities/utils.h"
+#include "./handle_tasks.h"
+
+/**
+ *  @brief Utility function (encapsulated) to serve the expired tasks of the
+ *  full queue in the registering thread, i.e. their callbacks are called
+ *  inline here (and sleep till the next deadline), till a slot frees or
+ *  @link{timeout_ms} is over ( @see{
+ *  TASK_FULL_QUEUE_BLOCK} )
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{ptr_scheduler} (the served tasks)
+ *  - implicit dependency on @callback{handle_run_ready_tasks}
+ *  - implicit dependency on @callback{wait_next_deadline_in}
+ *  - implicit dependency on @callback{get_now_ticks_in}
+ *  - implicit dependency on the @link{wait} of the @link{ptr_scheduler} (
+ *    @see{DEADLINE_WAITER} )
+ *
+ *  @note Only for the thread serving the instance: with the other thread
+ *  waiting on the instance's waiter (the instance is shared via the queue
+ *  mutex, @see{wait_next_deadline_locked_in} ) it fails at once. Otherwise
+ *  it would call that thread's callbacks here, sleep holding the caller's
+ *  queue mutex (nothing frees the slot) and overwrite the waited deadline of
+ *  the waiter (losing its' notification).
+ *  @note Called from the callback of the firing task (the nested run serves
+ *  nothing, @see{handle_run_ready_tasks}) it fails at once, i.e. BLOCK acts
+ *  as REJECT inside the callbacks. Inside the opened clock tick (its' cached
+ *  timestamp doesn't move) only the already expired tasks are served, no
+ *  sleep.
+ *
+ *  @return {bool} - true => there is a free slot
+ *
+ */
+static bool wait_free_slot(Scheduler *ptr_scheduler, TASK_DELAY timeout_ms) {
+  // the firing task holds the top, nothing can be served here
+  if (ptr_scheduler->firing.is_firing) {
+    return false;
+  }
+
+  // the other thread serves the instance (LLONG_MIN => nobody waits)
+  if (atomic_load(&ptr_scheduler->wait.waited_deadline_ticks) != LLONG_MIN) {
+    return false;
+  }
+
+  PROMISE_CLOCK_TICKS log_ticks = get_now_ticks_in(ptr_scheduler);
+
+  if (log_ticks.type == ERROR_CODE) {
+    return false;
+  }
+
+  TASK_TICKS now_ticks = log_ticks.handle_clock_result.TICKS;
+
+  // saturate the limit at LLONG_MAX (i.e. "never")
+  TASK_TICKS limit_ticks = LLONG_MAX;
+  if (timeout_ms <= (TASK_DELAY)(LLONG_MAX - now_ticks) / RATIO_NANOSEC_MSEC) {
+    limit_ticks = now_ticks + (TASK_TICKS)timeout_ms * RATIO_NANOSEC_MSEC;
+  }
+
+  while (ptr_scheduler->task_count >= MAX_TASK_QUANTITY) {
+    PROMISE_RUN_READY_TASKS log_run =
+        handle_run_ready_tasks(ptr_scheduler, (RUN_BUDGET){.max_tasks = 1});
+
+    if (log_run.type == ERROR_CODE) {
+      return false;
+    }
+
+    // the served task may have freed the slot (even with the zero timeout)
+    if (ptr_scheduler->task_count < MAX_TASK_QUANTITY) {
+      return true;
+    }
+
+    if (now_ticks >= limit_ticks) {
+      return false;
+    }
+
+    if (log_run.run_ready_tasks_result.REPORT.RAN_COUNT == 0) {
+      if (ptr_scheduler->clock.is_tick_opened) {
+        return false;
+      }
+
+      // the saturated limit => no rounding up (it would overflow)
+      wait_next_deadline_in(
+          ptr_scheduler,
+          limit_ticks == LLONG_MAX
+              ? HANDLE_WAIT_FOREVER
+              : (TASK_DELAY)(limit_ticks - now_ticks + RATIO_NANOSEC_MSEC - 1) /
+                    RATIO_NANOSEC_MSEC);
+    }
+
+    log_ticks = get_now_ticks_in(ptr_scheduler);
+
+    if (log_ticks.type == ERROR_CODE) {
+      return false;
+    }
+
+    now_ticks = log_ticks.handle_clock_result.TICKS;
+  }
+
+  return true;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to remove the task with the latest
+ *  deadline if it is later than the new one's @link{deadline_ticks} and to
+ *  notify about it ( @see{TASK_FULL_QUEUE_EVICT_FURTHEST} )
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{ptr_scheduler} (the evicted task)
+ *  - mutates the @link{evicted_count} of the @link{ptr_scheduler}'s overload
+ *    state
+ *  - implicit dependency on @callback{task_queue_peek_furthest}
+ *  - implicit dependency on @callback{get_id_handle}
+ *  - implicit dependency on @callback{handle_remove_task}
+ *  - implicit dependency on @callback{on_evicted} of the overload policy
+ *
+ *  @return {bool} - true => there is a free slot
+ *
+ */
+static bool evict_furthest_task(Scheduler *ptr_scheduler,
+                                TASK_TICKS deadline_ticks) {
+  Task *ptr_furthest = task_queue_peek_furthest(ptr_scheduler);
+
+  // the new task is the furthest one => it is shed itself
+  if ((ptr_furthest == NULL) ||
+      (ptr_furthest->deadline_ticks <= deadline_ticks)) {
+    return false;
+  }
+
+  unsigned short func_arg = ptr_furthest->func_arg;
+  TASK_HANDLE handle = get_id_handle(ptr_scheduler, ptr_furthest->id);
+
+  if (handle_remove_task(ptr_scheduler, handle).type == ERROR_CODE) {
+    return false;
+  }
+
+  ptr_scheduler->overload.evicted_count += 1;
+
+  if (ptr_scheduler->overload.policy.on_evicted != NULL) {
+    ptr_scheduler->overload.policy.on_evicted(handle, func_arg);
+  }
+
+  // the notification may have registered a task to the freed slot
+  return ptr_scheduler->task_count < MAX_TASK_QUANTITY;
+}
+
+/**
+ *  @brief Make room for the new task in the full queue according to the
+ *  overload policy of the scheduler instance ( @see{OVERLOAD_POLICY} ):
+ *  reject, block till a slot frees or evict the task with the latest
+ *  deadline
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{ptr_scheduler} (the served or evicted tasks)
+ *  - implicit dependency on the @link{overload} of the @link{ptr_scheduler}
+ *  - implicit dependency on @callback{wait_free_slot}
+ *  - implicit dependency on @callback{evict_furthest_task}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_TICKS} deadline_ticks - the deadline (ns) of the new task
+ *
+ *  @return {bool} - true => there is a free slot, false => the new task is
+ *  rejected (REGISTER_TASK_ARRAY_OF_TASKS_FULL)
+ *
+ *  @example
+ *    *** the full queue, TASK_FULL_QUEUE_EVICT_FURTHEST ***
+ *    handle_full_queue(&default_scheduler, now_ticks + 10'000'000)
+ *    => true, the task with the latest deadline (later than in 10 ms) is
+ *    removed, the on_evicted notification is called
+ *
+ */
+bool handle_full_queue(Scheduler *ptr_scheduler, TASK_TICKS deadline_ticks) {
+  const OVERLOAD_POLICY *ptr_policy = &ptr_scheduler->overload.policy;
+
+  switch (ptr_policy->full_queue_policy) {
+  case TASK_FULL_QUEUE_BLOCK:
+    return wait_free_slot(ptr_scheduler, ptr_policy->block_timeout_ms);
+  case TASK_FULL_QUEUE_EVICT_FURTHEST:
+    return evict_furthest_task(ptr_scheduler, deadline_ticks);
+  case TASK_FULL_QUEUE_REJECT:
+  default:
+    return false;
+  }
+}
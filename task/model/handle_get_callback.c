@@ -9,24 +9,31 @@
  *  with the saved argument.
  *
  *  @note ! Impure function !
- *  - mutates the outer @link{task_count}
- *  - mutates the outer @link{tasks_array}
- *  - mutates the outer (encapsulated) @link{id_storage_array}
- *  - mutates the outer (encapsulated) @link{is_first_call}
- *  - mutates the outer (encapsulated) @link{ptr_free_elem}
+ *  - mutates the @link{task_count} of the @link{ptr_scheduler}
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the @link{id_storage_array} of the @link{ptr_scheduler}'s ids
+ *  - mutates the @link{is_initialized} of the @link{ptr_scheduler}'s ids
+ *  - mutates the @link{ptr_free_elem} of the @link{ptr_scheduler}'s ids
  *  - implicit dependency on @type{PROMISE_TASK}
  *  - implicit dependency on @type{Task}
- *  - implicit dependency on @type{struct timespec} of <time.h>
+ *  - implicit dependency on @type{TASK_TICKS}
  *  - implicit dependency on @type{ID_LIST_ELEM}
  *  - implicit dependency on @callback{free_id}
- *  - implicit dependency on @callback{timespec_get} function of <time.h>
+ *  - implicit dependency on @callback{reschedule_periodic_task}
+ *  - implicit dependency on @callback{get_now_ticks_in}
+ *  - implicit dependency on @callback{task_queue_advance}
+ *  - implicit dependency on @callback{task_queue_peek}
+ *  - implicit dependency on @callback{task_queue_pop}
  *
  *  @note Returns promise like structure @link{PROMISE_TASK}! Examine the
  *  example below how to handle it properly!
- *  @note Expected @link{tasks_array} to be sorted descending via Task.delay(ms)
- *  value.
+ *  @note Expected the queue backend to keep the task with the least deadline
+ *  on top ( @see{task_queue_peek} ).
+ *  @note The nested call from the callback called by the run_ready_tasks
+ *  handler is refused: the one-shot firing task is still on top (
+ *  @see{begin_firing_task} ), so it would be served twice.
  *
- *  @param {void} - no params expected
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
  *
  *  @return {PROMISE_TASK} - structure of complex type
  *    @see{PROMISE_TASK} for details and examples below for clarification how
@@ -35,19 +42,21 @@
  *    - PROMISE_TASK.get_callback_result.CODES_RESULT =>
  *      - GET_CALLBACK_ARRAY_OF_TASKS_EMPTY - current task counter value is 0
  *      - GET_CALLBACK_TIMESPEC_GET_ERROR - at the moment of getting current
- *        timestamp via timespec_get() function with TIME_UTC base problems
+ *        timestamp via get_now_ticks() monotonic clock function problems
  *        occured
- *      - GET_CALLBACK_PENDING - the least task's delay is not gone yet
+ *      - GET_CALLBACK_PENDING - the least task's deadline is not due yet
+ *      - GET_CALLBACK_FREE_ID_ERROR - error at the process of freeing the id
+ *      - GET_CALLBACK_TASK_FIRING - called from the firing task's callback
  *
  *  @example
  *    *** Predefined context ***
  *    PROMISE_TASK_ID log_id = register_task(some_callback, 400, 400);
- *    TASK_COUNTER task_id;
+ *    TASK_HANDLE task_id;
  *    ***
  *    task_id = 0; (first one)
  *    ***
  *    *** Usage ***
- *    PROMISE_TASK log_task = handle_get_callback();
+ *    PROMISE_TASK log_task = handle_get_callback(&default_scheduler);
  *    Task task = {};
  *
  *    switch (log_task.type) {
@@ -58,10 +67,8 @@
  *        func_arg: 400;
  *        delay:  400;
  *        id: 0;
- *        created_timespec: {
- *          tv.sec = 0;
- *          tv.nsec = 6291136;
- *        }
+ *        created_ticks: 6291136;
+ *        deadline_ticks: 406291136;
  *      }
  *      break;
  *    case ERROR_CODE:
@@ -78,62 +85,66 @@
  *    }
  *
  *    *** Run callback with arg ***
- *    task.callback(task.func_arg);
+ *    get_task_callback(&task)(task.func_arg);
  *
  */
-PROMISE_TASK handle_get_callback(void) {
+PROMISE_TASK handle_get_callback(Scheduler *ptr_scheduler) {
   // check that @link{tasks_array} is not empty
-  if (task_count == 0) {
+  if (ptr_scheduler->task_count == 0) {
     return (PROMISE_TASK){.type = ERROR_CODE,
                           .get_callback_result.CODES_RESULT =
                               GET_CALLBACK_ARRAY_OF_TASKS_EMPTY};
   }
 
+  // the firing task stays on top till its' callback returns
+  if (ptr_scheduler->firing.is_firing) {
+    return (PROMISE_TASK){.type = ERROR_CODE,
+                          .get_callback_result.CODES_RESULT =
+                              GET_CALLBACK_TASK_FIRING};
+  }
+
   // set up
-  struct timespec current_ts = {};
-  time_t current_timestamp_ms = 0;
-  struct timespec task_created_timespec = {};
-  time_t task_timestamp_ms = 0;
-  unsigned short diff_timestamps_ms = 0;
+  TASK_TICKS current_ticks = 0;
 
-  /** the task in the @link{tasks_array} with
-    the least delay(ms)
-    @note task_count - 1 ? => task_count - 1 == last task index in the
-    @link{tasks_array} */
-  Task last_task = tasks_array[task_count - 1];
+  Task last_task = {};
 
   // create pure instance of @link{PROMISE_TASK} as a result value
   // (assign to it further)
   PROMISE_TASK result_promise_task = {};
 
-  int written_var_count = timespec_get(&current_ts, TIME_UTC);
+  // get current monotonic timestamp(ns) (the cached one inside the opened
+  // tick, @see{begin_clock_tick_in})
+  PROMISE_CLOCK_TICKS log_ticks = get_now_ticks_in(ptr_scheduler);
 
-  // current_ts.tv_sec and current_ts.tv_nsec are set ? => 1(OK) (two fields are
-  // set, 1 is base for @link{TIME_UTC})
-  if (written_var_count == 0) {
+  if (log_ticks.type == ERROR_CODE) {
     return (PROMISE_TASK){.type = ERROR_CODE,
                           .get_callback_result.CODES_RESULT =
                               GET_CALLBACK_TIMESPEC_GET_ERROR};
   }
 
-  // count timestamps(ms)
-  // @note with precision's loss (nsec => ms due to delay(ms))
-  current_timestamp_ms =
-      (time_t)(round(current_ts.tv_sec * RATIO_SEC_MS +
-                     current_ts.tv_nsec / RATIO_NANOSEC_MSEC));
+  current_ticks = log_ticks.handle_clock_result.TICKS;
+
+  // let the queue backend drain the tasks expired till now (e.g. the current
+  // slots of the timing wheel)
+  task_queue_advance(ptr_scheduler, current_ticks);
+
+  /** the task in the @link{tasks_array} with
+    the least deadline(ns)
+    @note the queue backend keeps it on top, @see{task_queue_peek} */
+  Task *ptr_last_task = task_queue_peek(ptr_scheduler);
 
-  task_created_timespec = (last_task).created_timespec;
-  task_timestamp_ms =
-      (time_t)(round(task_created_timespec.tv_sec * RATIO_SEC_MS +
-                     task_created_timespec.tv_nsec / RATIO_NANOSEC_MSEC));
+  // no task is ready to be served yet
+  if (ptr_last_task == NULL) {
+    return (PROMISE_TASK){.type = ERROR_CODE,
+                          .get_callback_result.CODES_RESULT =
+                              GET_CALLBACK_PENDING};
+  }
 
-  diff_timestamps_ms =
-      (unsigned short)(current_timestamp_ms - task_timestamp_ms);
+  last_task = *ptr_last_task;
 
-  // check that
-  // (current timestamp(count from current_ts) - Task.created_timespec) >
-  //  Task.delay
-  if (diff_timestamps_ms <= last_task.delay) {
+  // check that current timestamp(ns) >= Task.deadline_ticks (the deadline is
+  // counted once at the registration, @see{get_task_deadline_ticks})
+  if (current_ticks < last_task.deadline_ticks) {
     return (PROMISE_TASK){.type = ERROR_CODE,
                           .get_callback_result.CODES_RESULT =
                               GET_CALLBACK_PENDING};
@@ -143,8 +154,14 @@ PROMISE_TASK handle_get_callback(void) {
   result_promise_task =
       (PROMISE_TASK){.type = SUCCESS, .get_callback_result.TASK = last_task};
 
+  // the periodic task stays in the queue with the next deadline (the same
+  // id), @see{reschedule_periodic_task}
+  if (reschedule_periodic_task(ptr_scheduler, &last_task, current_ticks)) {
+    return result_promise_task;
+  }
+
   // free the id
-  PROMISE_ID_VALUE log_id_value = free_id(tasks_array[task_count - 1].id);
+  PROMISE_ID_VALUE log_id_value = free_id(ptr_scheduler, last_task.id);
 
   switch (log_id_value.type) {
   case SUCCESS:
@@ -157,10 +174,9 @@ PROMISE_TASK handle_get_callback(void) {
     break;
   }
 
-  // remove the ready task from the @link{tasks_array} (i.e. empty last task),
-  // decrease quantity of tasks and return the ready task
-  tasks_array[task_count - 1] = (Task){0};
-  task_count -= 1;
+  // remove the ready task from the @link{tasks_array} (i.e. empty the top
+  // task), decrease quantity of tasks and return the ready task
+  task_queue_pop(ptr_scheduler);
 
   return result_promise_task;
 }
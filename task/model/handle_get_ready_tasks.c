@@ -0,0 +1,125 @@
+#include "../environment/config.h"
+#include "../environment/global_variables.h"
+#include "../utilities/utils.h"
+#include "./get_ready_tasks_config.h"
+
+/**
+ *  @brief Drain all the ready tasks (up to @link{capacity}) from the
+ *  @link{tasks_array} to the buffer in the deadline order via one clock
+ *  reading, i.e. the batch variant of the @link{handle_get_callback}
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{task_count} of the @link{ptr_scheduler}
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the @link{id_storage_array} of the @link{ptr_scheduler}'s ids
+ *  - implicit dependency on @type{PROMISE_READY_TASKS}
+ *  - implicit dependency on @type{Task}
+ *  - implicit dependency on @type{TASK_TICKS}
+ *  - implicit dependency on @callback{free_id}
+ *  - implicit dependency on @callback{reschedule_periodic_task}
+ *  - implicit dependency on @callback{get_now_ticks_in}
+ *  - implicit dependency on @callback{task_queue_advance}
+ *  - implicit dependency on @callback{task_queue_peek}
+ *  - implicit dependency on @callback{task_queue_pop}
+ *
+ *  @note Returns promise like structure @link{PROMISE_READY_TASKS}! Examine
+ *  the example below how to handle it properly!
+ *  @note READY_COUNT == @link{capacity} => there may be more ready tasks, call
+ *  it again (with the new clock reading)
+ *  @note The nested call from the callback called by the run_ready_tasks
+ *  handler drains nothing: the one-shot firing task is still on top (
+ *  @see{begin_firing_task} ), so it would be served twice.
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {Task *} ready_tasks - buffer for the ready tasks
+ *  @param {size_t} capacity - max quantity of the tasks to drain
+ *
+ *  @return {PROMISE_READY_TASKS} - structure of complex type
+ *    @see{PROMISE_READY_TASKS} for details
+ *  @throw PROMISE_READY_TASKS.type = ERROR_CODE
+ *    - PROMISE_READY_TASKS.get_ready_tasks_result.CODES_RESULT =>
+ *      - GET_READY_TASKS_INVALID_BUFFER - NULL buffer for the non zero
+ *        capacity
+ *      - GET_READY_TASKS_TIMESPEC_GET_ERROR - at the moment of getting current
+ *        timestamp via get_now_ticks() monotonic clock function problems
+ *        occured
+ *      - GET_READY_TASKS_FREE_ID_ERROR - error at the process of freeing the
+ *        id (the tasks drained before are in the buffer)
+ *
+ *  @example
+ *    Task ready_tasks[64];
+ *    PROMISE_READY_TASKS log_ready =
+ *        handle_get_ready_tasks(&default_scheduler, ready_tasks, 64);
+ *
+ *    if (log_ready.type == SUCCESS) {
+ *      for (size_t i = 0; i < log_ready.get_ready_tasks_result.READY_COUNT;
+ *           i += 1) {
+ *        get_task_callback(&ready_tasks[i])(ready_tasks[i].func_arg);
+ *      }
+ *    }
+ *
+ */
+PROMISE_READY_TASKS handle_get_ready_tasks(Scheduler *ptr_scheduler,
+                                           Task *ready_tasks, size_t capacity) {
+  if ((ready_tasks == NULL) && (capacity > 0)) {
+    return (PROMISE_READY_TASKS){.type = ERROR_CODE,
+                                 .get_ready_tasks_result.CODES_RESULT =
+                                     GET_READY_TASKS_INVALID_BUFFER};
+  }
+
+  size_t ready_count = 0;
+
+  // nothing to drain => no clock reading, the nested call from the firing
+  // callback drains nothing (its' task is still on top)
+  if ((ptr_scheduler->task_count == 0) || (capacity == 0) ||
+      ptr_scheduler->firing.is_firing) {
+    return (PROMISE_READY_TASKS){.type = SUCCESS,
+                                 .get_ready_tasks_result.READY_COUNT =
+                                     ready_count};
+  }
+
+  // one clock reading for the whole batch (the cached one inside the opened
+  // tick, @see{begin_clock_tick_in})
+  PROMISE_CLOCK_TICKS log_ticks = get_now_ticks_in(ptr_scheduler);
+
+  if (log_ticks.type == ERROR_CODE) {
+    return (PROMISE_READY_TASKS){.type = ERROR_CODE,
+                                 .get_ready_tasks_result.CODES_RESULT =
+                                     GET_READY_TASKS_TIMESPEC_GET_ERROR};
+  }
+
+  TASK_TICKS current_ticks = log_ticks.handle_clock_result.TICKS;
+
+  // let the queue backend drain the tasks expired till now (e.g. the current
+  // slots of the timing wheel)
+  task_queue_advance(ptr_scheduler, current_ticks);
+
+  // the queue backend keeps the task with the least deadline on top, so the
+  // buffer is filled in the deadline order
+  Task *ptr_task = task_queue_peek(ptr_scheduler);
+
+  while ((ready_count < capacity) && (ptr_task != NULL) &&
+         (ptr_task->deadline_ticks <= current_ticks)) {
+    ready_tasks[ready_count] = *ptr_task;
+
+    // the periodic task stays in the queue with the next deadline, the
+    // one-shot one is freed
+    if (!reschedule_periodic_task(ptr_scheduler, &ready_tasks[ready_count],
+                                  current_ticks)) {
+      if (free_id(ptr_scheduler, ptr_task->id).type == ERROR_CODE) {
+        return (PROMISE_READY_TASKS){.type = ERROR_CODE,
+                                     .get_ready_tasks_result.CODES_RESULT =
+                                         GET_READY_TASKS_FREE_ID_ERROR};
+      }
+
+      task_queue_pop(ptr_scheduler);
+    }
+
+    ready_count += 1;
+    ptr_task = task_queue_peek(ptr_scheduler);
+  }
+
+  return (PROMISE_READY_TASKS){.type = SUCCESS,
+                               .get_ready_tasks_result.READY_COUNT =
+                                   ready_count};
+}
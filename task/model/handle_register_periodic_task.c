@@ -0,0 +1,68 @@
+#include "../environment/global_variables.h"
+#include "../utilities/utils.h"
+#include "./handle_tasks.h"
+
+/**
+ *  @brief Register the periodic task: the first deadline is @link{phase} ms
+ *  after now, then every @link{period} ms. The served periodic task is
+ *  rescheduled in place ( @see{reschedule_periodic_task} ): the same id and
+ *  handle (till the task is removed), the next deadline is counted from the
+ *  previous one, so there is no drift (no timer slack, the coalesced
+ *  deadline would shift the grid)
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{task_count} of the @link{ptr_scheduler}
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the @link{ids} of the @link{ptr_scheduler}
+ *  - mutates the @link{periodic} of the @link{ptr_scheduler}
+ *  - implicit dependency on @callback{handle_register_task}
+ *  - implicit dependency on @callback{set_task_period}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {task_callback} func_to_call - callback to call with @link{arg}
+ *    every @link{period} ms
+ *  @param {unsigned short} arg - argument to call with @link{func_to_call}
+ *  @param {TASK_DELAY} period - period (ms), must be positive
+ *  @param {TASK_DELAY} phase - delay (ms) of the first call
+ *  @param {enum Task_catch_up_policies} catch_up_policy - what to do with the
+ *    missed periods, @see{enum Task_catch_up_policies}
+ *
+ *  @return {PROMISE_TASK_ID} - structure of complex type
+ *    @see{PROMISE_TASK_ID} for details
+ *  @throw PROMISE_TASK_ID.type = ERROR_CODE
+ *    - PROMISE_TASK_ID.register_task_result.CODES_RESULT =>
+ *      REGISTER_TASK_INVALID_PERIOD - the period is 0
+ *      the rest ones @see{handle_register_task}
+ *
+ *  @example
+ *    *** every 100 ms starting in 20 ms ***
+ *    handle_register_periodic_task(&default_scheduler, show_task_info, 1,
+ *                                  100, 20, TASK_CATCH_UP_SKIP)
+ *    => {.type = SUCCESS, .register_task_result.TASK_ID = 0}
+ *
+ */
+PROMISE_TASK_ID handle_register_periodic_task(
+    Scheduler *ptr_scheduler, task_callback func_to_call, unsigned short arg,
+    TASK_DELAY period, TASK_DELAY phase,
+    enum Task_catch_up_policies catch_up_policy) {
+  if (period == 0) {
+    return (PROMISE_TASK_ID){.type = ERROR_CODE,
+                             .register_task_result.CODES_RESULT =
+                                 REGISTER_TASK_INVALID_PERIOD};
+  }
+
+  PROMISE_TASK_ID log_id =
+      handle_register_task(ptr_scheduler, func_to_call, arg, phase, 0);
+
+  if (log_id.type == ERROR_CODE) {
+    return log_id;
+  }
+
+  // the id is the low bits of the handle ( @see{get_id_handle} )
+  set_task_period(ptr_scheduler,
+                  (TASK_COUNTER)(log_id.register_task_result.TASK_ID &
+                                 ((1ULL << TASK_HANDLE_SLOT_BITS) - 1)),
+                  period, catch_up_policy);
+
+  return log_id;
+}
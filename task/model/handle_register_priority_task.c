@@ -0,0 +1,47 @@
+#include "../environment/global_variables.h"
+#include "../utilities/utils.h"
+#include "./handle_tasks.h"
+
+/**
+ *  @brief Register the task in the queue of the priority class
+ *  @link{priority} of the priority scheduler ( @see{PriorityScheduler} )
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{classes} of the @link{ptr_priority_scheduler}
+ *  - implicit dependency on @callback{handle_register_task}
+ *
+ *  @param {PriorityScheduler *} ptr_priority_scheduler - the priority
+ *    scheduler
+ *  @param {unsigned int} priority - the priority class, range
+ *    [0; TASK_PRIORITY_CLASSES), 0 is the highest one
+ *  @param {task_callback} func_to_call - callback to call with @link{arg}
+ *  @param {unsigned short} arg - argument to call with @link{func_to_call}
+ *  @param {TASK_DELAY} delay - delay time (ms)
+ *
+ *  @return {PROMISE_TASK_ID} - structure of complex type
+ *    @see{PROMISE_TASK_ID} for details, the handle is valid within the
+ *    class' instance only
+ *  @throw PROMISE_TASK_ID.type = ERROR_CODE
+ *    - PROMISE_TASK_ID.register_task_result.CODES_RESULT =>
+ *      REGISTER_TASK_INVALID_PRIORITY - no such priority class
+ *      the rest ones @see{handle_register_task}
+ *
+ *  @example
+ *    handle_register_priority_task(&net_scheduler, 1, show_task_info, 1, 400)
+ *    => {.type = SUCCESS, .register_task_result.TASK_ID = 0}
+ *
+ */
+PROMISE_TASK_ID
+handle_register_priority_task(PriorityScheduler *ptr_priority_scheduler,
+                              unsigned int priority,
+                              task_callback func_to_call, unsigned short arg,
+                              TASK_DELAY delay) {
+  if (priority >= TASK_PRIORITY_CLASSES) {
+    return (PROMISE_TASK_ID){.type = ERROR_CODE,
+                             .register_task_result.CODES_RESULT =
+                                 REGISTER_TASK_INVALID_PRIORITY};
+  }
+
+  return handle_register_task(&ptr_priority_scheduler->classes[priority],
+                              func_to_call, arg, delay, 0);
+}
@@ -1,41 +1,66 @@
 #include "../environment/global_variables.h"
 #include "../utilities/utils.h"
+#include "./handle_tasks.h"
 #include "./register_task_config.h"
 
 /**
  *  @brief Register task in the @link{tasks_array[]} to delay its' usage at
  *  @link{delay} ms and get the strucure @link{PROMISE_TASK_ID} for saving
- *  registered task's id
+ *  registered task's handle ( @see{TASK_HANDLE} )
  *
  *  @note ! Impure function !
- *  - mutates the outer @link{task_count}
- *  - mutates the outer @link{tasks_array}
- *  - mutates the outer (encapsulated) @link{id_storage_array}
- *  - mutates the outer (encapsulated) @link{is_first_call}
- *  - mutates the outer (encapsulated) @link{ptr_free_elem}
+ *  - mutates the @link{task_count} of the @link{ptr_scheduler}
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the @link{id_storage_array} of the @link{ptr_scheduler}'s ids
+ *  - mutates the @link{is_initialized} of the @link{ptr_scheduler}'s ids
+ *  - mutates the @link{ptr_free_elem} of the @link{ptr_scheduler}'s ids
+ *  - mutates the @link{periodic} of the @link{ptr_scheduler}
+ *  - mutates the @link{slacks} of the @link{ptr_scheduler}
+ *  - mutates the @link{overload} counters of the @link{ptr_scheduler}
  *  - implicit dependency on @type{PROMISE_TASK_ID}
  *  - implicit dependency on @type{task_callback}
  *  - implicit dependency on @type{Task}
- *  - implicit dependency on @type{struct timespec} of <time.h>
+ *  - implicit dependency on @type{TASK_TICKS}
  *  - implicit dependency on @type{ID_LIST_ELEM}
  *  - implicit dependency on @callback{get_id}
- *  - implicit dependency on global variable @link{MIN_DELAY_FOR_SORT}
- *  - implicit dependency on @callback{timespec_get} function of <time.h>
- *  - implicit dependency on @callback{sort_tasks_descending_by_delay_func}
- *  - under the hood uses @link{qsort} function from <stdlib.h> for sorting
- *    descending @link{tasks_array} via Task.delay(ms)
+ *  - implicit dependency on @callback{get_id_handle}
+ *  - implicit dependency on @callback{notify_new_deadline_in}
+ *  - implicit dependency on @callback{rearm_scheduler_fd}
+ *  - implicit dependency on @callback{set_task_callback}
+ *  - implicit dependency on @callback{set_task_delay}
+ *  - implicit dependency on @callback{set_task_period}
+ *  - implicit dependency on @callback{set_task_slack}
+ *  - implicit dependency on @callback{get_now_ticks_in}
+ *  - implicit dependency on @callback{is_task_admitted}
+ *  - implicit dependency on @callback{handle_full_queue}
+ *  - implicit dependency on @callback{task_queue_push} (the queue backend is
+ *    set up via @link{TASK_QUEUE_BACKEND})
+ *
+ *  @note The overload policy of the instance ( @see{OVERLOAD_POLICY} ) is
+ *  applied before the task takes an id: the admission control refuses the
+ *  task the loop would serve more than max_lateness_ms after its' deadline
+ *  (the loop's lag minus the time till the deadline), the full queue
+ *  is rejected (default), blocked on or evicted from. The deadline is
+ *  recounted after the full queue policy, so the blocked task is still due in
+ *  @link{delay} ms after it got the slot
  *
  *  @note Returns promise like structure @link{PROMISE_TASK_ID}! Examine the
  *  example below how to handle it properly!
  *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
  *  @param {task_callback} func_to_call - callback that user will call with
  *    @link{arg} after @link{delay} ms is gone
  *    e.g. @see{show_task_info}
  *  @param {unsigned short} arg - argument to call with @link{func_to_call}
- *  @param {unsigned short} delay - delay time (ms). When it's gone user can
- *    call `func_to_call(arg)` or `Task task.callback(task.func_arg)` , where
+ *  @param {TASK_DELAY} delay - delay time (ms). When it's gone user can
+ *    call `func_to_call(arg)` or
+ *    `get_task_callback(&task)(task.func_arg)` , where
  *    `task` is created via `handle_register_task` function instance of
  * @type{Task} and nested to the @link{tasks_array}
+ *  @param {TASK_DELAY} slack - timer slack (ms): the task may be served up
+ *    to @link{slack} ms after the delay is gone, so its' deadline is
+ *    coalesced with the nearby ones ( @see{get_coalesced_deadline_ticks} ),
+ *    0 => exact deadline
  *
  *  @return {PROMISE_TASK_ID} - structure of complex type
  *    @see{PROMISE_TASK_ID} for details and examples below for clarification how
@@ -43,17 +68,26 @@
  *  @throw PROMISE_TASK_ID.type = ERROR_CODE
  *    - PROMISE_TASK_ID.register_task_result.CODES_RESULT =>
  *      REGISTER_TASK_ARRAY_OF_TASKS_FULL - no free space to add extra Task
+ *      (after the full queue policy, @see{handle_full_queue} )
+ *      REGISTER_TASK_ADMISSION_REJECTED - the predicted lateness is greater
+ *      than max_lateness_ms of the overload policy
  *      REGISTER_TASK_TIMESPEC_GET_ERROR - problems occured at
- *      @link{timespec_get}() function calling
+ *      @link{get_now_ticks}() function calling
+ *      REGISTER_TASK_GET_ID_ERROR - no free id or the queue backend refused
+ *      the task under it (the id is freed)
+ *      REGISTER_TASK_CALLBACK_REGISTRY_ERROR - the callback is not registered
+ *      in the callback registry (the compact record, @see{
+ *      get_callback_index} )
  *
  *  @example
- *    PROMISE_TASK_ID log_id = handle_register_task(some_callback, 400, 400);
- *    TASK_COUNTER task_id;
+ *    PROMISE_TASK_ID log_id =
+ *        handle_register_task(&default_scheduler, some_callback, 400, 400, 0);
+ *    TASK_HANDLE task_id;
  *
  *    switch (log_id.type) {
  *    case SUCCESS:
  *      task_id = log_id.register_task_result.TASK_ID;
- *      printf("task_id: %hd\n", task_id);
+ *      printf("task_id: %llu\n", task_id);
  *      OUTPUT: e.g. 9 (task_id: 9)
  *      break;
  *    case ERROR_CODE:
@@ -70,15 +104,10 @@
  *    }
  *
  */
-PROMISE_TASK_ID handle_register_task(task_callback func_to_call,
-                                     unsigned short arg, unsigned short delay) {
-  // prevent adding excessive task
-  if (task_count >= MAX_TASK_QUANTITY) {
-    return (PROMISE_TASK_ID){.type = ERROR_CODE,
-                             .register_task_result.CODES_RESULT =
-                                 REGISTER_TASK_ARRAY_OF_TASKS_FULL};
-  }
-
+PROMISE_TASK_ID handle_register_task(Scheduler *ptr_scheduler,
+                                     task_callback func_to_call,
+                                     unsigned short arg, TASK_DELAY delay,
+                                     TASK_DELAY slack) {
   // create pure @link{Task} instance
   Task task = {};
 
@@ -86,32 +115,71 @@ PROMISE_TASK_ID handle_register_task(task_callback func_to_call,
   // (assign to it further)
   PROMISE_TASK_ID result_promise_task_id = {};
 
-  // set up current timestamp
-  struct timespec ts = {};
-  int written_var_count = timespec_get(&ts, TIME_UTC);
+  // set up current monotonic timestamp (the cached one inside the opened
+  // tick, @see{begin_clock_tick_in})
+  PROMISE_CLOCK_TICKS log_ticks = get_now_ticks_in(ptr_scheduler);
 
-  // ts.tv_sec and ts.tv_nsec are set ? => 1(OK) (two fields are set, 1 is base
-  // for @link{TIME_UTC})
-  if (written_var_count == 0) {
+  if (log_ticks.type == ERROR_CODE) {
     return (PROMISE_TASK_ID){.type = ERROR_CODE,
                              .register_task_result.CODES_RESULT =
                                  REGISTER_TASK_TIMESPEC_GET_ERROR};
   }
 
-  // set up the @link{task.created_timespec}
-  task.created_timespec = ts;
+  // set up the @link{task.deadline_ticks} (count it once, the queue backends
+  // compare this field only, coalesced within the @link{slack}), the
+  // @link{task.delay} and @link{task.created_ticks} of the full record
+  set_task_delay(&task, delay, slack, log_ticks.handle_clock_result.TICKS);
+
+  // refuse the work the loop can't serve in time ( @see{is_task_admitted} )
+  if (!is_task_admitted(ptr_scheduler, log_ticks.handle_clock_result.TICKS,
+                        task.deadline_ticks)) {
+    ptr_scheduler->overload.rejected_count += 1;
 
-  // set up the @link{callback}
-  task.callback = func_to_call;
+    return (PROMISE_TASK_ID){.type = ERROR_CODE,
+                             .register_task_result.CODES_RESULT =
+                                 REGISTER_TASK_ADMISSION_REJECTED};
+  }
+
+  // set up the @link{callback} (its' registry index for the compact record)
+  // before the full queue policy, so no task is evicted for the task that
+  // fails here
+  if (set_task_callback(&task, func_to_call) !=
+      HANDLE_CALLBACK_REGISTRY_DONE_SUCCESSFULLY) {
+    return (PROMISE_TASK_ID){.type = ERROR_CODE,
+                             .register_task_result.CODES_RESULT =
+                                 REGISTER_TASK_CALLBACK_REGISTRY_ERROR};
+  }
+
+  // prevent adding excessive task (unless the overload policy makes room for
+  // it, @see{handle_full_queue})
+  if (ptr_scheduler->task_count >= MAX_TASK_QUANTITY) {
+    if (!handle_full_queue(ptr_scheduler, task.deadline_ticks)) {
+      ptr_scheduler->overload.rejected_count += 1;
+
+      return (PROMISE_TASK_ID){.type = ERROR_CODE,
+                               .register_task_result.CODES_RESULT =
+                                   REGISTER_TASK_ARRAY_OF_TASKS_FULL};
+    }
+
+    // TASK_FULL_QUEUE_BLOCK may have served the tasks and slept up to
+    // block_timeout_ms => the delay is counted from the moment the slot is
+    // got, not from the call
+    log_ticks = get_now_ticks_in(ptr_scheduler);
+
+    if (log_ticks.type == ERROR_CODE) {
+      return (PROMISE_TASK_ID){.type = ERROR_CODE,
+                               .register_task_result.CODES_RESULT =
+                                   REGISTER_TASK_TIMESPEC_GET_ERROR};
+    }
+
+    set_task_delay(&task, delay, slack, log_ticks.handle_clock_result.TICKS);
+  }
 
   // set up the @link{task.func_arg}
   task.func_arg = arg;
 
-  // set up the @link{task.delay}
-  task.delay = delay;
-
   // set up the @link{task.id}
-  PROMISE_ID_VALUE log_id_value = get_id();
+  PROMISE_ID_VALUE log_id_value = get_id(ptr_scheduler);
 
   switch (log_id_value.type) {
   case SUCCESS:
@@ -126,26 +194,39 @@ PROMISE_TASK_ID handle_register_task(task_callback func_to_call,
     break;
   }
 
-  // nest the task instance to the @kink{tasks_array}
-  tasks_array[task_count] = task;
-
-  // update @link{result_promise_task_id}
-  result_promise_task_id = (PROMISE_TASK_ID){
-      .type = SUCCESS, .register_task_result.TASK_ID = task_count};
-
-  // update @link{task_count} counter
-  task_count += 1;
-
-  // sort tasks in the @link{tasks_array} descending (over the @link{Task.delay}
-  // field value) i.e. the least delay has greater index
-  // @note if @link{tasks_array} contains at least two tasks and the added
-  // task's delay is greater than min delay for sort
-  // and the added task's delay is greater than previous @link{tasks_array} 's
-  // task delay
-  if ((task_count > 1 && task.delay > MIN_DELAY_FOR_SORT) &&
-      (tasks_array[task_count - 1].delay > tasks_array[task_count - 2].delay)) {
-    sort_tasks_descending_by_delay(tasks_array, MAX_TASK_QUANTITY, task_count);
+  // one-shot task (the id may be reused after the periodic one)
+  set_task_period(ptr_scheduler, task.id, 0, TASK_CATCH_UP_SKIP);
+
+  // the reschedules of the task are coalesced within the same slack
+  set_task_slack(ptr_scheduler, task.id, slack);
+
+  // nest the task instance to the @link{tasks_array} (the queue backend keeps
+  // the task with the least deadline on top, @see{task_queue_push})
+  enum Task_queue_errors_codes push_code = task_queue_push(ptr_scheduler, task);
+
+  // the task isn't nested => its' id isn't given out, free it
+  if (push_code != TASK_QUEUE_DONE_SUCCESSFULLY) {
+    free_id(ptr_scheduler, task.id);
+
+    return (PROMISE_TASK_ID){.type = ERROR_CODE,
+                             .register_task_result.CODES_RESULT =
+                                 push_code == TASK_QUEUE_FULL
+                                     ? REGISTER_TASK_ARRAY_OF_TASKS_FULL
+                                     : REGISTER_TASK_GET_ID_ERROR};
   }
 
+  // wake up the serving thread if it sleeps till a later deadline
+  notify_new_deadline_in(ptr_scheduler, task.deadline_ticks);
+
+  // re-arm the scheduler's descriptor (if any) if the head moved earlier
+  rearm_scheduler_fd(ptr_scheduler, task.deadline_ticks);
+
+  // update @link{result_promise_task_id} (the handle packs the id and its'
+  // generation, so the handle gets stale once the task is removed or served)
+  result_promise_task_id =
+      (PROMISE_TASK_ID){.type = SUCCESS,
+                        .register_task_result.TASK_ID =
+                            get_id_handle(ptr_scheduler, task.id)};
+
   return result_promise_task_id;
 }
@@ -4,27 +4,29 @@
 #include "./remove_task_config.h"
 
 /**
- *  @brief Remove the task via valid id from @link{tasks_array}
+ *  @brief Remove the task via valid handle from @link{tasks_array}
  *
  *  @note ! Impure function !
- *  - mutates the outer @link{tasks_array}
- *  - mutates the outer (encapsulated) @link{id_storage_array}
- *  - mutates the outer (encapsulated) @link{is_first_call}
- *  - mutates the outer (encapsulated) @link{ptr_free_elem}
- *  - implicit dependency on @type{TASK_COUNTER}
+ *  - mutates the @link{task_count} of the @link{ptr_scheduler}
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the @link{id_storage_array} of the @link{ptr_scheduler}'s ids
+ *  - mutates the @link{is_initialized} of the @link{ptr_scheduler}'s ids
+ *  - mutates the @link{ptr_free_elem} of the @link{ptr_scheduler}'s ids
+ *  - implicit dependency on @type{TASK_HANDLE}
  *  - implicit dependency on @type{PROMISE_REMOVE_TASK}
  *  - implicit dependency on @type{Task}
  *  - implicit dependency on @type{ID_LIST_ELEM}
+ *  - implicit dependency on @callback{resolve_id_handle}
  *  - implicit dependency on @callback{free_id}
- *  - implicit dependency on @callback{sort_tasks_descending_by_delay_func}
- *  - under the hood uses @link{qsort} function from <stdlib.h> for sorting
- *    descending @link{tasks_array} via Task.delay(ms)
+ *  - implicit dependency on @callback{task_queue_remove} (the queue backend is
+ *    set up via @link{TASK_QUEUE_BACKEND})
  *
  *  @note Returns promise like structure @link{PROMISE_REMOVE_TASK}!
  *  Examine the example below how to handle it properly!
  *
- *  @param {TASK_COUNTER} id - id of the task from @link{tasks_array} that will
- *  be removed
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_HANDLE} id - handle of the task from @link{tasks_array} that
+ *  will be removed ( @see{register_task} )
  *
  *  @return {PROMISE_REMOVE_TASK} - structure of complex type
  *    @see{PROMISE_REMOVE_TASK} for details and examples below for
@@ -34,17 +36,18 @@
  *      - REMOVE_TASK_ARRAY_OF_TASKS_EMPTY - current task
  *        counter value is 0
  *      - REMOVE_TASK_TASK_ID_IS_NOT_DETERMINED - no such task
- *        with given ID
+ *        with given ID (or the handle is stale)
  *
  *  @example
  *    *** Predefined context ***
  *    PROMISE_TASK_ID log_id = register_task(some_callback, 400, 400);
- *    TASK_COUNTER task_id;
+ *    TASK_HANDLE task_id;
  *    ***
  *    task_id = 0; (first one)
  *    ***
  *    *** Usage ***
- *    PROMISE_REMOVE_TASK log_remove_task = handle_remove_task(0);
+ *    PROMISE_REMOVE_TASK log_remove_task =
+ *        handle_remove_task(&default_scheduler, 0);
  *
  *    switch (log_remove_task.type) {
  *    case SUCCESS:
@@ -68,104 +71,51 @@
  *      func_arg = 0
  *      delay = 0
  *      id = 0
- *      created_timespec = {
- *        tv_sec = 0
- *        tv_nsec = 0
- *      }
+ *      created_ticks = 0
+ *      deadline_ticks = 0
  *    }
  *
  */
-PROMISE_REMOVE_TASK handle_remove_task(TASK_COUNTER id) {
+PROMISE_REMOVE_TASK handle_remove_task(Scheduler *ptr_scheduler,
+                                       TASK_HANDLE id) {
   // check that @link{tasks_array} is not empty
-  if (task_count == 0) {
+  if (ptr_scheduler->task_count == 0) {
     return (PROMISE_REMOVE_TASK){
         .type = ERROR_CODE, .CODES_RESULT = REMOVE_TASK_ARRAY_OF_TASKS_EMPTY};
   }
 
-  // check, that @link{id} is in range [0; task_count - 1]
-  // @note task_count - 1 ? => task id ( @link{Task tasks_array[]} index) ==
-  // task_count - 1
-  // id @type{unsigned short} may not be negative! so -1 => 65536 - 1 = 65535
-  //  where 2 ** 16 (i.e. 2 * 8 i.e. 2 bytes = 16) = 65536
-  if (id >= task_count) {
+  // get the task's slot over the handle (stale handles of the removed or
+  // served tasks are rejected here, even if the slot is reused)
+  PROMISE_ID_VALUE log_id_value = resolve_id_handle(ptr_scheduler, id);
+
+  if (log_id_value.type == ERROR_CODE) {
     return (PROMISE_REMOVE_TASK){.type = ERROR_CODE,
                                  .CODES_RESULT =
                                      REMOVE_TASK_TASK_ID_IS_NOT_DETERMINED};
   }
 
-  // get the task over @link{id} and remove the task (make it 0 zero struct
-  //  i.e. to (Task){0} )
-  for (TASK_COUNTER i = 0; i < task_count; i += 1) {
-    // use bidirectional search
-    // search from the beginning
-    if (tasks_array[i].id == id) {
-      // remove the Task => swap Task to (Task){0}
-      tasks_array[i] = (Task){0};
-
-      // free the id
-      PROMISE_ID_VALUE log_id_value = free_id(id);
-
-      switch (log_id_value.type) {
-      case SUCCESS:
-        break;
-      case ERROR_CODE:
-        return (PROMISE_REMOVE_TASK){.type = ERROR_CODE,
-                                     .CODES_RESULT = REMOVE_TASK_FREE_ID_ERROR};
-      default:
-        break;
-      }
-
-      // sort @link{tasks_array} only if:
-      // - more than one task in it
-      if (task_count > 1) {
-        // sort @link{tasks_array} descending via Task.delay (ms)
-        sort_tasks_descending_by_delay(tasks_array, MAX_TASK_QUANTITY,
-                                       task_count);
-      }
-
-      // update @link{task_count}
-      task_count -= 1;
-
-      return (PROMISE_REMOVE_TASK){
-          .type = SUCCESS, .CODES_RESULT = REMOVE_TASK_DONE_SUCCESSFULLY};
-    }
-
-    // search from the end
-    if (tasks_array[task_count - 1 - i].id == id) {
-      // remove the Task => swap Task to (Task){0}
-      tasks_array[task_count - 1 - i] = (Task){0};
+  TASK_COUNTER slot = log_id_value.handle_id_result.ID_VALUE;
 
-      // free the id
-      PROMISE_ID_VALUE log_id_value = free_id(id);
-
-      switch (log_id_value.type) {
-      case SUCCESS:
-        break;
-      case ERROR_CODE:
-        return (PROMISE_REMOVE_TASK){.type = ERROR_CODE,
-                                     .CODES_RESULT = REMOVE_TASK_FREE_ID_ERROR};
-      default:
-        break;
-      }
-
-      // sort @link{tasks_array} only if:
-      // - more than one task in it
-      if (task_count > 1) {
-        // sort @link{tasks_array} descending via Task.delay (ms)
-        sort_tasks_descending_by_delay(tasks_array, MAX_TASK_QUANTITY,
-                                       task_count);
-      }
+  // get the task over the @link{slot} and remove it from the queue
+  if (task_queue_remove(ptr_scheduler, slot) != TASK_QUEUE_DONE_SUCCESSFULLY) {
+    return (PROMISE_REMOVE_TASK){.type = ERROR_CODE,
+                                 .CODES_RESULT =
+                                     REMOVE_TASK_TASK_ID_IS_NOT_DETERMINED};
+  }
 
-      // update @link{task_count}
-      task_count -= 1;
+  // free the id
+  log_id_value = free_id(ptr_scheduler, slot);
 
-      return (PROMISE_REMOVE_TASK){
-          .type = SUCCESS, .CODES_RESULT = REMOVE_TASK_DONE_SUCCESSFULLY};
-    }
+  switch (log_id_value.type) {
+  case SUCCESS:
+    break;
+  case ERROR_CODE:
+    return (PROMISE_REMOVE_TASK){.type = ERROR_CODE,
+                                 .CODES_RESULT = REMOVE_TASK_FREE_ID_ERROR};
+  default:
+    break;
   }
 
-  // handle case when no match over @link{id} happened
-  return (PROMISE_REMOVE_TASK){.type = ERROR_CODE,
-                               .CODES_RESULT =
-                                   REMOVE_TASK_TASK_ID_IS_NOT_DETERMINED};
+  return (PROMISE_REMOVE_TASK){.type = SUCCESS,
+                               .CODES_RESULT = REMOVE_TASK_DONE_SUCCESSFULLY};
 }
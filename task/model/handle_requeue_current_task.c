@@ -0,0 +1,53 @@
+#include "../environment/config.h"
+#include "../environment/global_variables.h"
+#include "./change_task_delay_config.h"
+#include "./handle_tasks.h"
+
+/**
+ *  @brief Requeue the task whose callback is being called with the new delay
+ *  (ms): the task keeps its' queue slot, id and handle, the queue backend
+ *  moves it once ( @see{task_queue_reschedule} ), so there is no get_id /
+ *  free_id and no pop + push of the self rescheduling callback
+ *
+ *  @note ! Impure function !
+ *  - mutates the Task in the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the @link{firing} of the @link{ptr_scheduler}
+ *  - implicit dependency on @callback{handle_change_task_delay}
+ *
+ *  @note Only from the callback called by the run_ready_tasks handler in the
+ *  serving thread ( @see{begin_firing_task} ). The callbacks of the tasks
+ *  given out (get_callback, get_ready_tasks) or pushed to the worker pool
+ *  are called after the task is popped, so they register the next task.
+ *  @note The periodic task is requeued once, the next periods are counted
+ *  from the new deadline.
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_DELAY} new_delay - delay (ms) from now
+ *
+ *  @return {PROMISE_CHANGE_TASK_DELAY} - structure of complex type
+ *    @see{PROMISE_CHANGE_TASK_DELAY} for details
+ *  @throw PROMISE_CHANGE_TASK_DELAY.type = ERROR_CODE
+ *    - PROMISE_CHANGE_TASK_DELAY.CODES_RESULT =>
+ *      - CHANGE_TASK_DELAY_TASK_ID_IS_NOT_DETERMINED - no callback is being
+ *        called or the callback removed its' task
+ *      the rest ones @see{handle_change_task_delay}
+ *
+ *  @example
+ *    void poll_sensor(unsigned short arg) {
+ *      ...
+ *      handle_requeue_current_task(&default_scheduler, arg);
+ *      => poll_sensor(arg) again in arg ms, the same handle
+ *    }
+ *
+ */
+PROMISE_CHANGE_TASK_DELAY
+handle_requeue_current_task(Scheduler *ptr_scheduler, TASK_DELAY new_delay) {
+  if (!ptr_scheduler->firing.is_firing) {
+    return (PROMISE_CHANGE_TASK_DELAY){
+        .type = ERROR_CODE,
+        .CODES_RESULT = CHANGE_TASK_DELAY_TASK_ID_IS_NOT_DETERMINED};
+  }
+
+  return handle_change_task_delay(ptr_scheduler, ptr_scheduler->firing.handle,
+                                  new_delay);
+}
@@ -0,0 +1,183 @@
+#include "../environment/config.h"
+#include "../environment/global_variables.h"
+#include "../utilities/utils.h"
+#include "./handle_tasks.h"
+
+/**
+ *  @brief Utility function (encapsulated) to get the priority class whose
+ *  expired head is served next: the head of the highest class for the strict
+ *  priorities (@link{aging_ticks} 0), else the head with the earliest aged
+ *  deadline i.e. deadline + priority * aging (every @link{aging_ticks} of
+ *  lateness promote the task one class, the earliest deadline first within
+ *  the same class)
+ *
+ *  @note ! Impure function !
+ *  - mutates the queue backends' indexes of the @link{classes}
+ *  - implicit dependency on @callback{task_queue_advance}
+ *  - implicit dependency on @callback{task_queue_peek}
+ *
+ *  @return {int} - the priority class, -1 => no expired tasks
+ *
+ */
+static int pick_priority_class(PriorityScheduler *ptr_priority_scheduler,
+                               TASK_TICKS now_ticks, TASK_TICKS aging_ticks) {
+  int picked_priority = -1;
+  TASK_TICKS picked_aged_ticks = LLONG_MAX;
+
+  for (int priority = 0; priority < TASK_PRIORITY_CLASSES; priority += 1) {
+    Scheduler *ptr_class = &ptr_priority_scheduler->classes[priority];
+
+    if (ptr_class->task_count == 0) {
+      continue;
+    }
+
+    // let the queue backend drain the tasks expired till now (e.g. the
+    // current slots of the timing wheel)
+    task_queue_advance(ptr_class, now_ticks);
+    Task *ptr_task = task_queue_peek(ptr_class);
+
+    if ((ptr_task == NULL) || (ptr_task->deadline_ticks > now_ticks)) {
+      continue;
+    }
+
+    // the strict priorities: the classes go from the highest one
+    if (aging_ticks == 0) {
+      return priority;
+    }
+
+    TASK_TICKS aged_ticks = ptr_task->deadline_ticks + priority * aging_ticks;
+
+    if (aged_ticks < picked_aged_ticks) {
+      picked_priority = priority;
+      picked_aged_ticks = aged_ticks;
+    }
+  }
+
+  return picked_priority;
+}
+
+/**
+ *  @brief Call the callbacks of the ready tasks of all the priority classes
+ *  within the @link{budget}: the expired tasks only, the highest class
+ *  first, the earliest deadline first within the class. With the aging (
+ *  @see{PriorityScheduler} ) every @link{aging_ms} of lateness promote the
+ *  expired task one class, so the task of the class N waits for the newer
+ *  higher classes' tasks N * @link{aging_ms} at most: the low classes can't
+ *  starve under the overload
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{classes} of the @link{ptr_priority_scheduler}
+ *  - implicit dependency on @type{PROMISE_RUN_READY_TASKS}
+ *  - implicit dependency on @type{RUN_BUDGET}
+ *  - implicit dependency on @callback{pick_priority_class}
+ *  - implicit dependency on @callback{handle_run_ready_tasks}
+ *  - implicit dependency on @callback{get_now_ticks_in}
+ *  - implicit dependency on @callback{task_queue_get_next_deadline}
+ *
+ *  @note The choice is made per task: the picked class' head is served via
+ *  @link{handle_run_ready_tasks} (one task), so the firing task's features
+ *  (requeue from the callback, periodic tasks, the worker pool) work as
+ *  usual. The readiness and the aging are checked against the clock reading
+ *  of the class 0 at the start (the cached one inside its' opened tick), so
+ *  open the ticks of all the classes (or none) to serve them against the same
+ *  moment.
+ *  @note The classes' instances have their own waiters and timerfds: sleep
+ *  till the returned NEXT_DEADLINE_TICKS (the earliest one of all the
+ *  classes) by the loop's own means or poll the classes' timerfds.
+ *
+ *  @param {PriorityScheduler *} ptr_priority_scheduler - the priority
+ *    scheduler
+ *  @param {RUN_BUDGET} budget - @see{RUN_BUDGET} (zero fields => no limits)
+ *
+ *  @return {PROMISE_RUN_READY_TASKS} - structure of complex type
+ *    @see{PROMISE_RUN_READY_TASKS} for details
+ *  @throw PROMISE_RUN_READY_TASKS.type = ERROR_CODE
+ *    - PROMISE_RUN_READY_TASKS.run_ready_tasks_result.CODES_RESULT =>
+ *      - RUN_READY_TASKS_TIMESPEC_GET_ERROR - at the moment of getting
+ *        current timestamp via get_now_ticks() monotonic clock function
+ *        problems occured
+ *      - RUN_READY_TASKS_FREE_ID_ERROR - error at the process of freeing the
+ *        id
+ *
+ *  @example
+ *    PROMISE_RUN_READY_TASKS log_run = handle_run_priority_ready_tasks(
+ *        &net_scheduler, (RUN_BUDGET){.max_tasks = 100});
+ *    => log_run.run_ready_tasks_result.REPORT {
+ *      RAN_COUNT: 100;
+ *      NEXT_DEADLINE_TICKS: 406291136;
+ *      IS_BUDGET_EXHAUSTED: true;
+ *    }
+ *
+ */
+PROMISE_RUN_READY_TASKS
+handle_run_priority_ready_tasks(PriorityScheduler *ptr_priority_scheduler,
+                                RUN_BUDGET budget) {
+  RUN_READY_TASKS_REPORT report = {.NEXT_DEADLINE_TICKS = LLONG_MAX};
+
+  PROMISE_CLOCK_TICKS log_ticks =
+      get_now_ticks_in(&ptr_priority_scheduler->classes[0]);
+
+  if (log_ticks.type == ERROR_CODE) {
+    return (PROMISE_RUN_READY_TASKS){.type = ERROR_CODE,
+                                     .run_ready_tasks_result.CODES_RESULT =
+                                         RUN_READY_TASKS_TIMESPEC_GET_ERROR};
+  }
+
+  const TASK_TICKS STARTED_TICKS = log_ticks.handle_clock_result.TICKS;
+  const TASK_TICKS AGING_TICKS =
+      (TASK_TICKS)ptr_priority_scheduler->aging_ms * RATIO_NANOSEC_MSEC;
+
+  int priority = pick_priority_class(ptr_priority_scheduler, STARTED_TICKS,
+                                     AGING_TICKS);
+
+  while (priority >= 0) {
+    if ((budget.max_tasks > 0) && (report.RAN_COUNT >= budget.max_tasks)) {
+      report.IS_BUDGET_EXHAUSTED = true;
+      break;
+    }
+
+    PROMISE_RUN_READY_TASKS log_run =
+        handle_run_ready_tasks(&ptr_priority_scheduler->classes[priority],
+                               (RUN_BUDGET){.max_tasks = 1});
+
+    if (log_run.type == ERROR_CODE) {
+      return log_run;
+    }
+
+    // the nested call from the firing callback or the full worker pool
+    if (log_run.run_ready_tasks_result.REPORT.RAN_COUNT == 0) {
+      report.IS_BUDGET_EXHAUSTED = true;
+      break;
+    }
+
+    report.RAN_COUNT += 1;
+
+    if (budget.max_time_ns > 0) {
+      log_ticks = get_now_ticks_in(&ptr_priority_scheduler->classes[0]);
+
+      if ((log_ticks.type == ERROR_CODE) ||
+          (log_ticks.handle_clock_result.TICKS - STARTED_TICKS >=
+           budget.max_time_ns)) {
+        report.IS_BUDGET_EXHAUSTED =
+            pick_priority_class(ptr_priority_scheduler, STARTED_TICKS,
+                                AGING_TICKS) >= 0;
+        break;
+      }
+    }
+
+    priority = pick_priority_class(ptr_priority_scheduler, STARTED_TICKS,
+                                   AGING_TICKS);
+  }
+
+  for (int i = 0; i < TASK_PRIORITY_CLASSES; i += 1) {
+    TASK_TICKS next_deadline_ticks =
+        task_queue_get_next_deadline(&ptr_priority_scheduler->classes[i]);
+
+    if (next_deadline_ticks < report.NEXT_DEADLINE_TICKS) {
+      report.NEXT_DEADLINE_TICKS = next_deadline_ticks;
+    }
+  }
+
+  return (PROMISE_RUN_READY_TASKS){.type = SUCCESS,
+                                   .run_ready_tasks_result.REPORT = report};
+}
@@ -0,0 +1,178 @@
+#include "../environment/config.h"
+#include "../environment/global_variables.h"
+#include "../utilities/utils.h"
+#include "./run_ready_tasks_config.h"
+
+/**
+ *  @brief Call the callbacks of the ready tasks straight from the queue (no
+ *  Task copy out, no promise per task) in the deadline order within the
+ *  @link{budget}
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{task_count} of the @link{ptr_scheduler}
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the @link{id_storage_array} of the @link{ptr_scheduler}'s ids
+ *  - implicit dependency on @type{PROMISE_RUN_READY_TASKS}
+ *  - implicit dependency on @type{RUN_BUDGET}
+ *  - implicit dependency on @callback{free_id}
+ *  - implicit dependency on @callback{reschedule_periodic_task}
+ *  - implicit dependency on @callback{begin_firing_task}
+ *  - implicit dependency on @callback{end_firing_task}
+ *  - implicit dependency on @callback{get_task_callback}
+ *  - implicit dependency on @callback{get_now_ticks_in}
+ *  - implicit dependency on @callback{task_queue_advance}
+ *  - implicit dependency on @callback{task_queue_peek}
+ *  - implicit dependency on @callback{task_queue_pop}
+ *  - implicit dependency on @callback{task_queue_get_next_deadline}
+ *  - implicit dependency on @callback{is_worker_pool_attached_in}
+ *  - implicit dependency on @callback{is_worker_pool_full}
+ *  - implicit dependency on @callback{push_worker_task}
+ *
+ *  @note The readiness is checked against the clock reading at the start, so
+ *  the tasks registered by the callbacks (even with the zero delay) wait for
+ *  the next call and can't loop it forever. The periodic task is rescheduled
+ *  before its' callback is called, the one-shot one stays in its' slot till
+ *  the callback returns and is popped after ( @see{end_firing_task} ), so
+ *  the callback may requeue its' own task in place (
+ *  @see{requeue_current_task_in} ), register / remove the tasks (its' own
+ *  one too, via its' handle). The nested call from the callback runs
+ *  nothing. The overdue periodic task with TASK_CATCH_UP_BURST is served
+ *  once per missed period in a row.
+ *  @note The clock is read after every callback only for the time budget.
+ *  @note With the started worker pool attached to the instance (
+ *  @see{attach_worker_pool_in} ) the callbacks are pushed to the workers
+ *  instead of being called here (RAN_COUNT is the quantity of the dispatched
+ *  ones), so a slow callback doesn't delay the rest. The ready tasks left
+ *  when all the workers' deques are full wait for the next call
+ *  (IS_BUDGET_EXHAUSTED).
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {RUN_BUDGET} budget - @see{RUN_BUDGET} (zero fields => no limits)
+ *
+ *  @return {PROMISE_RUN_READY_TASKS} - structure of complex type
+ *    @see{PROMISE_RUN_READY_TASKS} for details
+ *  @throw PROMISE_RUN_READY_TASKS.type = ERROR_CODE
+ *    - PROMISE_RUN_READY_TASKS.run_ready_tasks_result.CODES_RESULT =>
+ *      - RUN_READY_TASKS_TIMESPEC_GET_ERROR - at the moment of getting
+ *        current timestamp via get_now_ticks() monotonic clock function
+ *        problems occured
+ *      - RUN_READY_TASKS_FREE_ID_ERROR - error at the process of freeing the
+ *        id
+ *
+ *  @example
+ *    PROMISE_RUN_READY_TASKS log_run =
+ *        handle_run_ready_tasks(&default_scheduler,
+ *                               (RUN_BUDGET){.max_tasks = 100});
+ *    => log_run.run_ready_tasks_result.REPORT {
+ *      RAN_COUNT: 100;
+ *      NEXT_DEADLINE_TICKS: 406291136;
+ *      IS_BUDGET_EXHAUSTED: true;
+ *    }
+ *
+ */
+PROMISE_RUN_READY_TASKS handle_run_ready_tasks(Scheduler *ptr_scheduler,
+                                               RUN_BUDGET budget) {
+  RUN_READY_TASKS_REPORT report = {};
+
+  // nothing to run => no clock reading, the nested call from the firing
+  // callback runs nothing (its' task is still on top)
+  if ((ptr_scheduler->task_count == 0) || ptr_scheduler->firing.is_firing) {
+    report.NEXT_DEADLINE_TICKS = task_queue_get_next_deadline(ptr_scheduler);
+
+    return (PROMISE_RUN_READY_TASKS){.type = SUCCESS,
+                                     .run_ready_tasks_result.REPORT = report};
+  }
+
+  // get current monotonic timestamp(ns) (the cached one inside the opened
+  // tick, @see{begin_clock_tick_in})
+  PROMISE_CLOCK_TICKS log_ticks = get_now_ticks_in(ptr_scheduler);
+
+  if (log_ticks.type == ERROR_CODE) {
+    return (PROMISE_RUN_READY_TASKS){.type = ERROR_CODE,
+                                     .run_ready_tasks_result.CODES_RESULT =
+                                         RUN_READY_TASKS_TIMESPEC_GET_ERROR};
+  }
+
+  const TASK_TICKS STARTED_TICKS = log_ticks.handle_clock_result.TICKS;
+
+  // let the queue backend drain the tasks expired till now (e.g. the current
+  // slots of the timing wheel)
+  task_queue_advance(ptr_scheduler, STARTED_TICKS);
+
+  const bool IS_TO_WORKERS = is_worker_pool_attached_in(ptr_scheduler);
+  Task *ptr_task = task_queue_peek(ptr_scheduler);
+
+  while ((ptr_task != NULL) && (ptr_task->deadline_ticks <= STARTED_TICKS)) {
+    if ((budget.max_tasks > 0) && (report.RAN_COUNT >= budget.max_tasks)) {
+      report.IS_BUDGET_EXHAUSTED = true;
+      break;
+    }
+
+    // the task stays in the queue till the workers have room for it
+    if (IS_TO_WORKERS && is_worker_pool_full()) {
+      report.IS_BUDGET_EXHAUSTED = true;
+      break;
+    }
+
+    // take only the callback and its' argument, the queue slot is reused as
+    // soon as the task is popped (or moved as soon as the periodic one is
+    // rescheduled)
+    task_callback callback = get_task_callback(ptr_task);
+    unsigned short func_arg = ptr_task->func_arg;
+    TASK_COUNTER task_id = ptr_task->id;
+
+    // the periodic task stays in the queue with the next deadline
+    bool is_periodic =
+        reschedule_periodic_task(ptr_scheduler, ptr_task, STARTED_TICKS);
+
+    if (IS_TO_WORKERS) {
+      // the worker calls the callback later, the one-shot task is freed now
+      if (!is_periodic) {
+        if (free_id(ptr_scheduler, task_id).type == ERROR_CODE) {
+          return (PROMISE_RUN_READY_TASKS){
+              .type = ERROR_CODE,
+              .run_ready_tasks_result.CODES_RESULT =
+                  RUN_READY_TASKS_FREE_ID_ERROR};
+        }
+
+        task_queue_pop(ptr_scheduler);
+      }
+
+      push_worker_task(callback, func_arg);
+    } else {
+      // the one-shot task stays in its' slot till the callback returns, so
+      // the callback may requeue it in place ( @see{requeue_current_task_in}
+      // ), then it is popped and freed
+      begin_firing_task(ptr_scheduler, task_id, is_periodic);
+      callback(func_arg);
+
+      if (!end_firing_task(ptr_scheduler)) {
+        return (PROMISE_RUN_READY_TASKS){.type = ERROR_CODE,
+                                         .run_ready_tasks_result.CODES_RESULT =
+                                             RUN_READY_TASKS_FREE_ID_ERROR};
+      }
+    }
+
+    report.RAN_COUNT += 1;
+
+    if (budget.max_time_ns > 0) {
+      log_ticks = get_now_ticks_in(ptr_scheduler);
+
+      if ((log_ticks.type == ERROR_CODE) ||
+          (log_ticks.handle_clock_result.TICKS - STARTED_TICKS >=
+           budget.max_time_ns)) {
+        ptr_task = task_queue_peek(ptr_scheduler);
+        report.IS_BUDGET_EXHAUSTED =
+            (ptr_task != NULL) && (ptr_task->deadline_ticks <= STARTED_TICKS);
+        break;
+      }
+    }
+
+    ptr_task = task_queue_peek(ptr_scheduler);
+  }
+
+  report.NEXT_DEADLINE_TICKS = task_queue_get_next_deadline(ptr_scheduler);
+
+  return (PROMISE_RUN_READY_TASKS){.type = SUCCESS,
+                                   .run_ready_tasks_result.REPORT = report};
+}
@@ -0,0 +1,44 @@
+#ifndef HANDLE_TASKS_H
+#define HANDLE_TASKS_H
+
+#include "../environment/config.h"
+#include "./change_task_delay_config.h"
+#include "./get_callback_config.h"
+#include "./get_ready_tasks_config.h"
+#include "./register_task_config.h"
+#include "./run_ready_tasks_config.h"
+#include "./remove_task_config.h"
+#include "../utilities/handle_periodic_tasks_config.h"
+
+PROMISE_TASK_ID handle_register_task(Scheduler *ptr_scheduler,
+                                     task_callback func_to_call,
+                                     unsigned short arg, TASK_DELAY delay,
+                                     TASK_DELAY slack);
+PROMISE_TASK_ID handle_register_periodic_task(
+    Scheduler *ptr_scheduler, task_callback func_to_call, unsigned short arg,
+    TASK_DELAY period, TASK_DELAY phase,
+    enum Task_catch_up_policies catch_up_policy);
+PROMISE_TASK_ID
+handle_register_priority_task(PriorityScheduler *ptr_priority_scheduler,
+                              unsigned int priority,
+                              task_callback func_to_call, unsigned short arg,
+                              TASK_DELAY delay);
+bool handle_full_queue(Scheduler *ptr_scheduler, TASK_TICKS deadline_ticks);
+PROMISE_TASK handle_get_callback(Scheduler *ptr_scheduler);
+PROMISE_REMOVE_TASK handle_remove_task(Scheduler *ptr_scheduler,
+                                       TASK_HANDLE id);
+PROMISE_CHANGE_TASK_DELAY handle_change_task_delay(Scheduler *ptr_scheduler,
+                                                   TASK_HANDLE id,
+                                                   TASK_DELAY new_delay);
+PROMISE_CHANGE_TASK_DELAY
+handle_requeue_current_task(Scheduler *ptr_scheduler, TASK_DELAY new_delay);
+PROMISE_READY_TASKS handle_get_ready_tasks(Scheduler *ptr_scheduler,
+                                           Task *ready_tasks,
+                                           size_t capacity);
+PROMISE_RUN_READY_TASKS handle_run_ready_tasks(Scheduler *ptr_scheduler,
+                                               RUN_BUDGET budget);
+PROMISE_RUN_READY_TASKS
+handle_run_priority_ready_tasks(PriorityScheduler *ptr_priority_scheduler,
+                                RUN_BUDGET budget);
+
+#endif
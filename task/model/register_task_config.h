@@ -8,8 +8,17 @@
  *  - REGISTER_TASK_ARRAY_OF_TASKS_FULL - current task counter value is greater
  *    than Tasks array size
  *  - REGISTER_TASK_TIMESPEC_GET_ERROR - at the moment of getting current
- *    timestamp via timespec_get() function with TIME_UTC base problems occured
- *  - REGISTER_TASK_GET_ID_ERROR - error at the process of getting free id
+ *    timestamp via get_now_ticks() monotonic clock function problems occured
+ *  - REGISTER_TASK_GET_ID_ERROR - error at the process of getting free id (or
+ *    of nesting the task under it to the queue)
+ *  - REGISTER_TASK_CALLBACK_REGISTRY_ERROR - the callback registry is full or
+ *    the callback is NULL (the compact record, @see{get_callback_index} )
+ *  - REGISTER_TASK_INVALID_PERIOD - the period of the periodic task is 0 (
+ *    @see{register_periodic_task} )
+ *  - REGISTER_TASK_INVALID_PRIORITY - the priority class is out of
+ *    [0; TASK_PRIORITY_CLASSES) ( @see{register_priority_task_in} )
+ *  - REGISTER_TASK_ADMISSION_REJECTED - the predicted lateness is greater
+ *    than the admission limit ( @see{OVERLOAD_POLICY} )
  *
  */
 enum Register_task_errors_codes {
@@ -17,21 +26,28 @@ enum Register_task_errors_codes {
       1, /**< current task counter value is greater than Tasks array size */
   REGISTER_TASK_TIMESPEC_GET_ERROR =
       2, /**< at the moment of getting current timestamp via
-          *    timespec_get() function with TIME_UTC base problems occured */
+          *    get_now_ticks() monotonic clock function problems occured */
   REGISTER_TASK_GET_ID_ERROR =
       3, /**< error at the process of getting free id */
+  REGISTER_TASK_CALLBACK_REGISTRY_ERROR =
+      4, /**< the callback registry is full or the callback is NULL */
+  REGISTER_TASK_INVALID_PERIOD = 5, /**< the period of the periodic task is 0 */
+  REGISTER_TASK_INVALID_PRIORITY =
+      6, /**< the priority class is out of [0; TASK_PRIORITY_CLASSES) */
+  REGISTER_TASK_ADMISSION_REJECTED =
+      7, /**< the predicted lateness is greater than the admission limit */
 };
 
 /**
  *  @details
  *  Union for handling results of @link{register_task} function execution.
  *  Possible values @note only one of is possible!:
- *  - TASK_ID - registered Task ID
+ *  - TASK_ID - registered Task handle ( @see{TASK_HANDLE} )
  *  - CODES_RESULT - Error codes at the process of Task registration
  *
  */
 union Union_id {
-  unsigned short TASK_ID; /**< registered Task ID */
+  TASK_HANDLE TASK_ID; /**< registered Task handle */
   enum Register_task_errors_codes
       CODES_RESULT; /**< Error codes at the process of Task registration
                      */
@@ -42,19 +58,21 @@ union Union_id {
  *  Structure for handling results of @link{register_task} function execution.
  *  - type - (SUCCESS | ERROR_CODE)
  *  - register_task_result - union @link{union Union_id}, that is
- *    @type{unsigned short} for TASK_ID (SUCCESS, everything is OK) or
+ *    @type{TASK_HANDLE} for TASK_ID (SUCCESS, everything is OK) or
  *    one of error codes for ERROR_CODE
  *    i.e. (REGISTER_TASK_ARRAY_OF_TASKS_FULL |
- *    REGISTER_TASK_TIMESPEC_GET_ERROR | REGISTER_TASK_GET_ID_ERROR)
+ *    REGISTER_TASK_TIMESPEC_GET_ERROR | REGISTER_TASK_GET_ID_ERROR |
+ *    REGISTER_TASK_CALLBACK_REGISTRY_ERROR | REGISTER_TASK_INVALID_PERIOD |
+ *    REGISTER_TASK_INVALID_PRIORITY | REGISTER_TASK_ADMISSION_REJECTED)
  *
  *  @example
  *    PROMISE_TASK_ID log_id = register_task(some_callback, 400, 400);
- *    TASK_COUNTER task_id;
+ *    TASK_HANDLE task_id;
  *
  *    switch (log_id.type) {
  *    case SUCCESS:
  *      task_id = log_id.register_task_result.TASK_ID;
- *      printf("task_id: %hd\n", task_id);
+ *      printf("task_id: %llu\n", task_id);
  *      OUTPUT: e.g. 9 (task_id: 9)
  *      break;
  *    case ERROR_CODE:
@@ -35,7 +35,7 @@ enum Remove_task_errors_codes {
  *  @example
  *    *** Predefined context ***
  *    PROMISE_TASK_ID log_id = register_task(some_callback, 400, 400);
- *    TASK_COUNTER task_id;
+ *    TASK_HANDLE task_id;
  *    ***
  *    task_id = 0; (first one)
  *    ***
@@ -65,10 +65,8 @@ enum Remove_task_errors_codes {
  *      func_arg = 0
  *      delay = 0
  *      id = 0
- *      created_timespec = {
- *        tv_sec = 0
- *        tv_nsec = 0
- *      }
+ *      created_ticks = 0
+ *      deadline_ticks = 0
  *    }
  *
  */
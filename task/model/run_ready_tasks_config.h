@@ -0,0 +1,111 @@
+#ifndef RUN_READY_TASKS_CONFIG_H
+#define RUN_READY_TASKS_CONFIG_H
+
+#include "../environment/config.h"
+
+/**
+ *  @brief Budget of the @link{run_ready_tasks} call, so one busy tick can't
+ *  starve the rest of the loop. Zero field => no limit of this kind
+ *
+ *  @details
+ *  - max_tasks - max quantity of the callbacks to call
+ *  - max_time_ns - max time (ns) to spend, checked after every callback
+ *
+ *  @example
+ *    run_ready_tasks((RUN_BUDGET){}); => all the ready tasks
+ *    run_ready_tasks((RUN_BUDGET){.max_tasks = 100});
+ *    run_ready_tasks((RUN_BUDGET){.max_time_ns = 2 * RATIO_NANOSEC_MSEC});
+ *
+ */
+typedef struct s_Run_budget {
+  size_t max_tasks;       /**< max quantity of the callbacks, 0 => no limit */
+  TASK_TICKS max_time_ns; /**< max time (ns) to spend, 0 => no limit */
+} RUN_BUDGET;
+
+/**
+ *  @details
+ *  - RUN_READY_TASKS_DONE_SUCCESSFULLY - no errors, done successfully
+ *  - RUN_READY_TASKS_TIMESPEC_GET_ERROR - at the moment of getting current
+ *    timestamp via get_now_ticks() monotonic clock function problems occured
+ *  - RUN_READY_TASKS_FREE_ID_ERROR - error at the process of freeing the id
+ *
+ */
+enum Run_ready_tasks_errors_codes {
+  RUN_READY_TASKS_DONE_SUCCESSFULLY = 0, /**< no errors, done successfully */
+  RUN_READY_TASKS_TIMESPEC_GET_ERROR =
+      1, /**< at the moment of getting current timestamp via get_now_ticks()
+            monotonic clock function problems occured */
+  RUN_READY_TASKS_FREE_ID_ERROR =
+      2, /**< error at the process of freeing the id */
+};
+
+/**
+ *  @details
+ *  Report of the @link{run_ready_tasks} call
+ *  - RAN_COUNT - quantity of the called callbacks
+ *  - NEXT_DEADLINE_TICKS - the earliest pending deadline (monotonic ns),
+ *    LLONG_MAX if the queue is empty ( @see{task_queue_get_next_deadline} )
+ *  - IS_BUDGET_EXHAUSTED - the budget is over before all the ready tasks
+ *    were called (call it again)
+ *
+ */
+typedef struct s_Run_ready_tasks_report {
+  size_t RAN_COUNT;               /**< quantity of the called callbacks */
+  TASK_TICKS NEXT_DEADLINE_TICKS; /**< the earliest pending deadline (ns) */
+  bool IS_BUDGET_EXHAUSTED;       /**< the ready tasks are left */
+} RUN_READY_TASKS_REPORT;
+
+/**
+ *  @details
+ *  Union for handling results of @link{run_ready_tasks} function execution.
+ *  Possible values @note only one of is possible!:
+ *  - REPORT - @link{RUN_READY_TASKS_REPORT} structure
+ *  - CODES_RESULT - Error codes at the process of running the ready tasks
+ *
+ */
+union Union_run_ready_tasks {
+  RUN_READY_TASKS_REPORT REPORT; /**< report of the call */
+  enum Run_ready_tasks_errors_codes
+      CODES_RESULT; /**< Error codes at the process of running the ready
+                       tasks */
+};
+
+/**
+ *  @details
+ *  Structure for handling results of @link{run_ready_tasks} function
+ *  execution.
+ *  - type - (SUCCESS | ERROR_CODE)
+ *  - run_ready_tasks_result - union @link{union Union_run_ready_tasks}, that
+ *    is @type{RUN_READY_TASKS_REPORT} for REPORT (SUCCESS, everything is OK)
+ *    or
+ *    one of error codes for ERROR_CODE
+ *    i.e. (RUN_READY_TASKS_TIMESPEC_GET_ERROR | RUN_READY_TASKS_FREE_ID_ERROR)
+ *
+ *  @example
+ *    PROMISE_RUN_READY_TASKS log_run =
+ *        run_ready_tasks((RUN_BUDGET){.max_tasks = 100});
+ *
+ *    switch (log_run.type) {
+ *    case SUCCESS:
+ *      printf("%zu\n", log_run.run_ready_tasks_result.REPORT.RAN_COUNT);
+ *      OUTPUT: e.g. 100 (IS_BUDGET_EXHAUSTED: true => run it again)
+ *      break;
+ *    case ERROR_CODE:
+ *      printf("ERROR_CODE: %hd\n",
+ *        log_run.run_ready_tasks_result.CODES_RESULT);
+ *      OUTPUT: e.g. RUN_READY_TASKS_TIMESPEC_GET_ERROR
+ *      break;
+ *    default:
+ *      fprintf(stderr, "Error(%s() function at %d): ups... Unknown
+ *        log_run.type\n", __func__, __LINE__);
+ *      break;
+ *    }
+ *
+ */
+typedef struct s_Run_ready_tasks_result {
+  PROMISE_TYPE type; /**< SUCCESS | ERROR_CODE */
+  union Union_run_ready_tasks
+      run_ready_tasks_result; /**< REPORT | CODES_RESULT */
+} PROMISE_RUN_READY_TASKS;
+
+#endif
@@ -2,19 +2,83 @@
 #define MODULE_RUN_TASKS_AFTER_DELAY_H
 
 #include "./environment/config.h"
+#include "./environment/scheduler_config.h"
 #include "./model/change_task_delay_config.h"
 #include "./model/get_callback_config.h"
-#include "./model/handle_events_tasks_config.h"
+#include "./model/get_ready_tasks_config.h"
 #include "./model/register_task_config.h"
 #include "./model/remove_task_config.h"
+#include "./model/run_ready_tasks_config.h"
+#include "./utilities/handle_callback_registry_config.h"
+#include "./utilities/handle_clock_config.h"
+#include "./utilities/handle_command_ring_config.h"
+#include "./utilities/handle_overload_config.h"
+#include "./utilities/handle_periodic_tasks_config.h"
+#include "./utilities/handle_scheduler_fd_config.h"
+#include "./utilities/handle_shards_config.h"
+#include "./utilities/handle_timer_slack_config.h"
+#include "./utilities/handle_wait_config.h"
+#include "./utilities/handle_worker_pool_config.h"
+
+PROMISE_TASK_ID register_task_in(Scheduler *ptr_scheduler,
+                                 task_callback func_to_call,
+                                 unsigned short arg, TASK_DELAY delay);
+PROMISE_TASK_ID register_task_with_slack_in(Scheduler *ptr_scheduler,
+                                            task_callback func_to_call,
+                                            unsigned short arg,
+                                            TASK_DELAY delay,
+                                            TASK_DELAY slack);
+PROMISE_TASK_ID
+register_periodic_task_in(Scheduler *ptr_scheduler, task_callback func_to_call,
+                          unsigned short arg, TASK_DELAY period,
+                          TASK_DELAY phase,
+                          enum Task_catch_up_policies catch_up_policy);
+PROMISE_TASK_ID
+register_priority_task_in(PriorityScheduler *ptr_priority_scheduler,
+                          unsigned int priority, task_callback func_to_call,
+                          unsigned short arg, TASK_DELAY delay);
+PROMISE_TASK get_callback_in(Scheduler *ptr_scheduler);
+PROMISE_READY_TASKS get_ready_tasks_in(Scheduler *ptr_scheduler,
+                                       Task *ready_tasks, size_t capacity);
+PROMISE_RUN_READY_TASKS run_ready_tasks_in(Scheduler *ptr_scheduler,
+                                           RUN_BUDGET budget);
+PROMISE_RUN_READY_TASKS
+run_priority_ready_tasks_in(PriorityScheduler *ptr_priority_scheduler,
+                            RUN_BUDGET budget);
+PROMISE_REMOVE_TASK remove_task_in(Scheduler *ptr_scheduler, TASK_HANDLE id);
+PROMISE_CHANGE_TASK_DELAY change_task_delay_in(Scheduler *ptr_scheduler,
+                                               TASK_HANDLE id,
+                                               TASK_DELAY new_delay);
+PROMISE_CHANGE_TASK_DELAY requeue_current_task_in(Scheduler *ptr_scheduler,
+                                                  TASK_DELAY new_delay);
+PROMISE_SCHEDULER_FD scheduler_dispatch_ready_in(Scheduler *ptr_scheduler);
+TASK_COMMANDS_REPORT apply_task_commands_in(Scheduler *ptr_scheduler,
+                                            size_t max_commands);
+void set_overload_policy_in(Scheduler *ptr_scheduler, OVERLOAD_POLICY policy);
 
-PROMISE_HANDLE_EVENTS_TASKS handle_events_tasks(void);
 PROMISE_TASK_ID register_task(task_callback func_to_call, unsigned short arg,
                               unsigned short delay);
+PROMISE_TASK_ID register_task_ex(task_callback func_to_call,
+                                 unsigned short arg, TASK_DELAY delay);
+PROMISE_TASK_ID register_task_with_slack(task_callback func_to_call,
+                                         unsigned short arg, TASK_DELAY delay,
+                                         TASK_DELAY slack);
+PROMISE_TASK_ID
+register_periodic_task(task_callback func_to_call, unsigned short arg,
+                       TASK_DELAY period, TASK_DELAY phase,
+                       enum Task_catch_up_policies catch_up_policy);
 PROMISE_TASK get_callback(void);
-PROMISE_REMOVE_TASK remove_task(TASK_COUNTER id);
-PROMISE_CHANGE_TASK_DELAY change_task_delay(TASK_COUNTER id,
+PROMISE_READY_TASKS get_ready_tasks(Task *ready_tasks, size_t capacity);
+PROMISE_RUN_READY_TASKS run_ready_tasks(RUN_BUDGET budget);
+PROMISE_REMOVE_TASK remove_task(TASK_HANDLE id);
+PROMISE_CHANGE_TASK_DELAY change_task_delay(TASK_HANDLE id,
                                             unsigned short new_delay);
+PROMISE_CHANGE_TASK_DELAY change_task_delay_ex(TASK_HANDLE id,
+                                               TASK_DELAY new_delay);
+PROMISE_CHANGE_TASK_DELAY requeue_current_task(TASK_DELAY new_delay);
+PROMISE_SCHEDULER_FD scheduler_dispatch_ready(void);
+TASK_COMMANDS_REPORT apply_task_commands(size_t max_commands);
+void set_overload_policy(OVERLOAD_POLICY policy);
 void show_task_info(unsigned short arg);
 
 #endif
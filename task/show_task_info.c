@@ -6,8 +6,8 @@
  *  Just print message. @see{register_task} for more
  *
  *  @note ! Impure function !
- *  - implicit dependency on global variable @link{task_count} from
- *    "global_variables.h"
+ *  - implicit dependency on the @link{task_count} of the default scheduler
+ *    instance from "global_variables.h"
  *
  *  @param {unsigned short} arg - delay time value (ms). Used as delay value in
  *    @link{register_task} function and in the message content.
@@ -25,5 +25,6 @@
  *
  */
 void show_task_info(unsigned short arg) {
-  printf("Im task {%hd}. Create TASK with delay :{%hd} \n", task_count, arg);
+  printf("Im task {%hd}. Create TASK with delay :{%hd} \n",
+         default_scheduler.task_count, arg);
 }
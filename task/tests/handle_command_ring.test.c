@@ -0,0 +1,110 @@
+/**
+ *  @note Checks the command ring ( @see{submit_register_task} ): the full
+ *  ring, the producers' register / remove / change delay commands applied by
+ *  the dispatcher (the main thread) and the dispatcher's wake up on the
+ *  submitted commands. Link with -pthread.
+ *
+ *  Usage
+ *  copy all the code below to the @file{task/main.c}, check that #include's are
+ *  copied too
+ *
+ */
+
+// nanosleep() declaration for the strict -std=c23 builds
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+static atomic_int calls_count = 0;
+static atomic_bool is_removed_called = false;
+
+static void counting_callback(unsigned short arg) {
+  if (arg == 1) {
+    atomic_store(&is_removed_called, true);
+  }
+
+  atomic_fetch_add(&calls_count, 1);
+}
+
+/**
+ *  @brief The producer: in 100 ms registers the task 1 (2000 ms) and the
+ *  task 2 (2000 ms), removes the task 1 and changes the delay of the task 2
+ *  to 200 ms as soon as their handles are known
+ *
+ */
+static void *run_producer(void *arg) {
+  (void)arg;
+  _Atomic TASK_HANDLE removed_id = TASK_COMMAND_HANDLE_PENDING;
+  _Atomic TASK_HANDLE changed_id = TASK_COMMAND_HANDLE_PENDING;
+
+  nanosleep(&(struct timespec){.tv_nsec = 100'000'000}, NULL);
+
+  submit_register_task(counting_callback, 1, 2'000, &removed_id);
+  submit_register_task(counting_callback, 2, 2'000, &changed_id);
+
+  while (atomic_load(&changed_id) == TASK_COMMAND_HANDLE_PENDING) {
+    nanosleep(&(struct timespec){.tv_nsec = 1'000'000}, NULL);
+  }
+
+  submit_remove_task(atomic_load(&removed_id));
+  submit_change_task_delay(atomic_load(&changed_id), 200);
+
+  return NULL;
+}
+
+int main(void) {
+  /** !Test data! */
+
+  // check expect error HANDLE_COMMAND_RING_IS_FULL (expected code 1) after
+  // TASK_COMMAND_RING_CAPACITY commands
+  enum Handle_command_ring_errors_codes code =
+      HANDLE_COMMAND_RING_DONE_SUCCESSFULLY;
+  int submitted_count = 0;
+
+  while ((code = submit_remove_task(0)) ==
+         HANDLE_COMMAND_RING_DONE_SUCCESSFULLY) {
+    submitted_count += 1;
+  }
+
+  printf("submit_remove_task(): ERROR_CODE: %d, the capacity is used: %d\n",
+         code, submitted_count == TASK_COMMAND_RING_CAPACITY);
+
+  // expected all of them are applied and failed (the unknown handle)
+  TASK_COMMANDS_REPORT report = apply_task_commands(0);
+  printf("apply_task_commands(): all applied: %d, all failed: %d\n",
+         report.APPLIED_COUNT == TASK_COMMAND_RING_CAPACITY,
+         report.FAILED_COUNT == TASK_COMMAND_RING_CAPACITY);
+
+  // check happy path => the dispatcher sleeps, is woken up by the commands
+  // and serves the task 2 at ~300 ms (the task 1 is removed)
+  const TASK_TICKS STARTED_TICKS = get_now_ticks().handle_clock_result.TICKS;
+  pthread_t thread;
+
+  pthread_create(&thread, NULL, run_producer, NULL);
+
+  while (atomic_load(&calls_count) == 0) {
+    wait_next_deadline(HANDLE_WAIT_FOREVER);
+    apply_task_commands(0);
+    run_ready_tasks((RUN_BUDGET){});
+  }
+
+  pthread_join(thread, NULL);
+
+  // expected 1 call at ~300 ms, the task 1 isn't called, 0 tasks left
+  printf("callbacks called: %d at %lld ms, the removed one: %d, left: %lld\n",
+         atomic_load(&calls_count),
+         (get_now_ticks().handle_clock_result.TICKS - STARTED_TICKS) /
+             RATIO_NANOSEC_MSEC,
+         atomic_load(&is_removed_called),
+         (long long)default_scheduler.task_count);
+
+  /** !Test data! */
+
+  return 0;
+}
@@ -1,9 +1,9 @@
 /**
- *  @note In the @file{task/config.h} at @type{enum Global_variables} set
- *  MAX_TASK_QUANTITY = 3 (to test all the cases below), otherwise one'll have
+ *  @note Compile with -DTASK_CAPACITY=3 (i.e. MAX_TASK_QUANTITY = 3 in the
+ *  @file{task/config.h}) to test all the cases below, otherwise one'll have
  *  got an "segmentation fault" error (because of incorrect @param{arr_size} and
  *  @param{elems_quantity_to_sort} in the
- *  @callback{sort_tasks_descending_by_delay_func} function)
+ *  @callback{sort_tasks_descending_by_deadline_func} function)
  *
  *  Usage
  *  copy all the code below to the @file{task/main.c}, check that #include's are
@@ -19,7 +19,7 @@
 int main(void) {
   TASK_COUNTER id = -1;
 
-  PROMISE_ID_VALUE log_id_value = get_id();
+  PROMISE_ID_VALUE log_id_value = get_id(&default_scheduler);
 
   // get three (3) id's in a row
   // expected id = 0
@@ -35,7 +35,7 @@ int main(void) {
     break;
   }
 
-  log_id_value = get_id();
+  log_id_value = get_id(&default_scheduler);
   // expected id = 1
   switch (log_id_value.type) {
   case SUCCESS:
@@ -49,7 +49,7 @@ int main(void) {
     break;
   }
 
-  log_id_value = get_id();
+  log_id_value = get_id(&default_scheduler);
   // expected id = 2
   switch (log_id_value.type) {
   case SUCCESS:
@@ -63,7 +63,7 @@ int main(void) {
     break;
   }
 
-  log_id_value = get_id();
+  log_id_value = get_id(&default_scheduler);
   // expect error at getting 4th id (i.e. id = 3) HANDLE_ID_NO_FREE_ID
   // (error_code 1)
   switch (log_id_value.type) {
@@ -79,7 +79,7 @@ int main(void) {
   }
 
   // free the id
-  log_id_value = free_id(id);
+  log_id_value = free_id(&default_scheduler, id);
 
   switch (log_id_value.type) {
   case SUCCESS:
@@ -97,7 +97,7 @@ int main(void) {
   // reduce id (expected id = 2 => id = 1)
   id -= 1;
 
-  log_id_value = get_id();
+  log_id_value = get_id(&default_scheduler);
   // get the id, expected id = 2
   switch (log_id_value.type) {
   case SUCCESS:
@@ -112,7 +112,7 @@ int main(void) {
   }
 
   // free the id
-  log_id_value = free_id(id);
+  log_id_value = free_id(&default_scheduler, id);
 
   switch (log_id_value.type) {
   case SUCCESS:
@@ -132,7 +132,7 @@ int main(void) {
   id -= 1;
 
   // free the id
-  log_id_value = free_id(id);
+  log_id_value = free_id(&default_scheduler, id);
 
   switch (log_id_value.type) {
   case SUCCESS:
@@ -152,7 +152,7 @@ int main(void) {
   id -= 1;
 
   // free the id
-  log_id_value = free_id(id);
+  log_id_value = free_id(&default_scheduler, id);
 
   switch (log_id_value.type) {
   case SUCCESS:
@@ -173,7 +173,7 @@ int main(void) {
 
   // free the id
   // expected error: HANDLE_ID_UNKNOWN_ID (error_code 2)
-  log_id_value = free_id(id);
+  log_id_value = free_id(&default_scheduler, id);
 
   switch (log_id_value.type) {
   case SUCCESS:
@@ -189,5 +189,52 @@ int main(void) {
     break;
   }
 
+  // check the generation-tagged handles
+  // get the id and its' handle, free the id and get it again =>
+  // the old handle is stale
+  id = get_id(&default_scheduler).handle_id_result.ID_VALUE;
+  TASK_HANDLE handle = get_id_handle(&default_scheduler, id);
+
+  free_id(&default_scheduler, id);
+  get_id(&default_scheduler);
+
+  // expected error: HANDLE_ID_UNKNOWN_ID (error_code 2) even though the id is
+  // in use again
+  log_id_value = resolve_id_handle(&default_scheduler, handle);
+
+  switch (log_id_value.type) {
+  case SUCCESS:
+    printf("resolve_id_handle(): ID: %hd\n",
+           log_id_value.handle_id_result.ID_VALUE);
+    break;
+  case ERROR_CODE:
+    printf("ERROR_CODE: %hd\n", log_id_value.handle_id_result.CODES_RESULT);
+    break;
+  default:
+    fprintf(stderr,
+            "Error(%s() function at %d): ups... Unknown log_id_value.type\n",
+            __func__, __LINE__);
+    break;
+  }
+
+  // expected the fresh handle is resolved to the same id
+  log_id_value = resolve_id_handle(&default_scheduler,
+                                   get_id_handle(&default_scheduler, id));
+
+  switch (log_id_value.type) {
+  case SUCCESS:
+    printf("resolve_id_handle(): ID: %hd\n",
+           log_id_value.handle_id_result.ID_VALUE);
+    break;
+  case ERROR_CODE:
+    printf("ERROR_CODE: %hd\n", log_id_value.handle_id_result.CODES_RESULT);
+    break;
+  default:
+    fprintf(stderr,
+            "Error(%s() function at %d): ups... Unknown log_id_value.type\n",
+            __func__, __LINE__);
+    break;
+  }
+
   return 0;
 }
@@ -0,0 +1,90 @@
+/**
+ *  @note Checks the thread-safe bitmap id allocator ( @see{
+ *  TASK_ID_ALLOCATOR} ): two threads get the only id, resolve its' handle
+ *  and free the id in a loop, so the id is reclaimed by the other thread
+ *  right after it's freed. The handle of the live id must always resolve (the
+ *  generation is bumped before the id is released, @see{free_id} ). Compile
+ *  with -DTASK_ID_ALLOCATOR=TASK_ID_ALLOCATOR_ATOMIC_BITMAP -DTASK_CAPACITY=1
+ *  and link with -pthread.
+ *
+ *  Usage
+ *  copy all the code below to the @file{task/main.c}, check that #include's are
+ *  copied too
+ *
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+enum Test_id_atomic_bitmap_variables {
+  TEST_THREADS = 2,            /**< threads quantity */
+  TEST_ITERATIONS = 1'000'000, /**< get / resolve / free rounds per thread */
+};
+
+static atomic_int claimed_count = 0;
+static atomic_int stale_count = 0;
+
+/**
+ *  @brief The thread: gets the id, resolves the fresh handle of the id and
+ *  frees the id @link{TEST_ITERATIONS} times. The handle that isn't resolved
+ *  to the owned id is counted as stale
+ *
+ */
+static void *run_free_get_resolve(void *arg) {
+  (void)arg;
+
+  for (int i = 0; i < TEST_ITERATIONS; i += 1) {
+    PROMISE_ID_VALUE log_id_value = get_id(&default_scheduler);
+
+    if (log_id_value.type != SUCCESS) {
+      continue;
+    }
+
+    TASK_COUNTER id = log_id_value.handle_id_result.ID_VALUE;
+    TASK_HANDLE handle = get_id_handle(&default_scheduler, id);
+
+    log_id_value = resolve_id_handle(&default_scheduler, handle);
+
+    if ((log_id_value.type != SUCCESS) ||
+        (log_id_value.handle_id_result.ID_VALUE != id)) {
+      atomic_fetch_add(&stale_count, 1);
+    }
+
+    atomic_fetch_add(&claimed_count, 1);
+    free_id(&default_scheduler, id);
+  }
+
+  return NULL;
+}
+
+int main(void) {
+  /** !Test data! */
+  pthread_t threads[TEST_THREADS];
+
+  for (int i = 0; i < TEST_THREADS; i += 1) {
+    pthread_create(&threads[i], NULL, run_free_get_resolve, NULL);
+  }
+
+  for (int i = 0; i < TEST_THREADS; i += 1) {
+    pthread_join(threads[i], NULL);
+  }
+
+  // expected 1 (the ids were claimed at all)
+  printf("ids claimed: %d\n", atomic_load(&claimed_count) > 0);
+
+  // expected 0, the live id's handle is never stale
+  printf("stale handles of the live ids: %d\n", atomic_load(&stale_count));
+
+  // expected the id is free again: 0
+  printf("get_id(): ID: %hd\n",
+         get_id(&default_scheduler).handle_id_result.ID_VALUE);
+
+  /** !Test data! */
+
+  return 0;
+}
@@ -0,0 +1,109 @@
+/**
+ *  @note Checks the scheduler's file descriptor ( @see{get_scheduler_fd} ) in
+ *  the epoll loop: re-arm on the earlier registered task, readiness at the
+ *  deadlines, no readiness for the empty queue. Linux only.
+ *
+ *  Usage
+ *  copy all the code below to the @file{task/main.c}, check that #include's are
+ *  copied too
+ *
+ */
+
+#include <sys/epoll.h>
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+/**
+ *  @brief Utility function (encapsulated) to get the time (ms) gone since the
+ *  @link{started_ticks}
+ *
+ */
+static long long get_elapsed_ms(TASK_TICKS started_ticks) {
+  return (get_now_ticks().handle_clock_result.TICKS - started_ticks) /
+         RATIO_NANOSEC_MSEC;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to wait for the readiness (or
+ *  @link{timeout_ms}) and dispatch the ready tasks till at least one is
+ *  served, the dispatches with nothing served are counted as spurious
+ *
+ *  @note The timing wheel arms the descriptor at the slot's start (lower bound
+ *  of the deadline), so the spurious dispatches are expected for it
+ *
+ */
+static void wait_and_dispatch(int epoll_fd, int timeout_ms,
+                              TASK_TICKS started_ticks) {
+  int spurious_count = 0;
+
+  while (true) {
+    struct epoll_event event = {};
+
+    if (epoll_wait(epoll_fd, &event, 1, timeout_ms) == 0) {
+      printf("epoll_wait(): timeout at %lld ms\n",
+             get_elapsed_ms(started_ticks));
+      return;
+    }
+
+    PROMISE_SCHEDULER_FD log_dispatch = scheduler_dispatch_ready();
+
+    if ((log_dispatch.type != SUCCESS) ||
+        (log_dispatch.scheduler_fd_result.DISPATCHED_COUNT > 0)) {
+      printf("scheduler_dispatch_ready(): %d, %llu tasks at %lld ms (%d "
+             "spurious)\n",
+             log_dispatch.type,
+             log_dispatch.scheduler_fd_result.DISPATCHED_COUNT,
+             get_elapsed_ms(started_ticks), spurious_count);
+      return;
+    }
+
+    spurious_count += 1;
+  }
+}
+
+int main(void) {
+  /** !Test data! */
+  const TASK_TICKS STARTED_TICKS = get_now_ticks().handle_clock_result.TICKS;
+
+  register_task(show_task_info, 1, 300);
+
+  PROMISE_SCHEDULER_FD log_fd = get_scheduler_fd();
+
+  if (log_fd.type != SUCCESS) {
+    printf("get_scheduler_fd(): ERROR_CODE %d\n",
+           log_fd.scheduler_fd_result.CODES_RESULT);
+    return 1;
+  }
+
+  int epoll_fd = epoll_create1(0);
+  epoll_ctl(epoll_fd, EPOLL_CTL_ADD, log_fd.scheduler_fd_result.FD,
+            &(struct epoll_event){.events = EPOLLIN});
+
+  // expected re-arm at the earlier deadline (100 ms, not 300 ms)
+  register_task(show_task_info, 2, 100);
+
+  // expected the task 2 at ~100 ms, then the task 1 at ~300 ms
+  wait_and_dispatch(epoll_fd, -1, STARTED_TICKS);
+  wait_and_dispatch(epoll_fd, -1, STARTED_TICKS);
+
+  // expected timeout at ~400 ms (the queue is empty => disarmed)
+  wait_and_dispatch(epoll_fd, 100, STARTED_TICKS);
+
+  // expected the removed head fires early (1+ spurious at ~500 ms), the task
+  // 4 at ~600 ms
+  PROMISE_TASK_ID log_id = register_task(show_task_info, 3, 100);
+  register_task(show_task_info, 4, 200);
+  remove_task(log_id.register_task_result.TASK_ID);
+
+  wait_and_dispatch(epoll_fd, -1, STARTED_TICKS);
+
+  close(epoll_fd);
+  close_scheduler_fd();
+
+  /** !Test data! */
+
+  return 0;
+}
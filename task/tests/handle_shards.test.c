@@ -0,0 +1,131 @@
+/**
+ *  @note Checks the sharded mode ( @see{TASK_SHARDED} ): every thread
+ *  registers and runs the tasks of its' own shard without locks, the global
+ *  view ( @see{get_earliest_shard} ) merges the shards' heads. Compile with
+ *  -DTASK_SHARDED=1 and link with -pthread.
+ *
+ *  Usage
+ *  copy all the code below to the @file{task/main.c}, check that #include's are
+ *  copied too
+ *
+ */
+
+// pthread_barrier_t declaration for the strict -std=c23 builds
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+enum Test_shards_variables {
+  TEST_THREADS = 4,           /**< shards (threads) quantity */
+  TEST_TASKS_PER_THREAD = 10, /**< tasks of each shard */
+};
+
+static pthread_barrier_t registered_barrier;
+static pthread_barrier_t checked_barrier;
+static atomic_int calls_count = 0;
+static int shard_indexes[TEST_THREADS] = {};
+
+static void counting_callback(unsigned short arg) {
+  (void)arg;
+  atomic_fetch_add(&calls_count, 1);
+}
+
+/**
+ *  @brief The shard's thread: registers the tasks (the thread N with the
+ *  delay (N + 1) * 100 ms), waits for the global view check and runs them
+ *
+ */
+static void *run_shard(void *arg) {
+  int thread_number = *(int *)arg;
+
+  for (int i = 0; i < TEST_TASKS_PER_THREAD; i += 1) {
+    register_task(counting_callback, 0, (thread_number + 1) * 100);
+  }
+
+  shard_indexes[thread_number] =
+      claim_shard().shards_result.SHARD_INDEX;
+
+  // expected only the own tasks at the local shard
+  if (default_scheduler.task_count != TEST_TASKS_PER_THREAD) {
+    printf("thread %d: %lld tasks at the shard\n", thread_number,
+           (long long)default_scheduler.task_count);
+  }
+
+  pthread_barrier_wait(&registered_barrier);
+  pthread_barrier_wait(&checked_barrier);
+
+  while (default_scheduler.task_count > 0) {
+    wait_next_deadline(HANDLE_WAIT_FOREVER);
+    run_ready_tasks((RUN_BUDGET){});
+  }
+
+  release_shard();
+
+  return NULL;
+}
+
+int main(void) {
+  /** !Test data! */
+  pthread_t threads[TEST_THREADS];
+  int thread_numbers[TEST_THREADS];
+
+  pthread_barrier_init(&registered_barrier, NULL, TEST_THREADS + 1);
+  pthread_barrier_init(&checked_barrier, NULL, TEST_THREADS + 1);
+
+  for (int i = 0; i < TEST_THREADS; i += 1) {
+    thread_numbers[i] = i;
+    pthread_create(&threads[i], NULL, run_shard, &thread_numbers[i]);
+  }
+
+  pthread_barrier_wait(&registered_barrier);
+
+  // expected the shard of the thread 0 (the earliest deadline, 100 ms)
+  PROMISE_SHARD log_shard = get_earliest_shard();
+
+  switch (log_shard.type) {
+  case SUCCESS:
+    printf("get_earliest_shard(): the shard of the thread 0: %d\n",
+           log_shard.shards_result.HEAD.SHARD_INDEX == shard_indexes[0]);
+    break;
+  case ERROR_CODE:
+    printf("get_earliest_shard(): ERROR_CODE: %hd\n",
+           log_shard.shards_result.CODES_RESULT);
+    break;
+  default:
+    fprintf(stderr,
+            "Error(%s() function at %d): ups... Unknown log_shard.type\n",
+            __func__, __LINE__);
+    break;
+  }
+
+  // expected 0 tasks at the main thread's shard (the threads own theirs)
+  printf("main thread: %lld tasks at the shard\n",
+         (long long)default_scheduler.task_count);
+
+  pthread_barrier_wait(&checked_barrier);
+
+  for (int i = 0; i < TEST_THREADS; i += 1) {
+    pthread_join(threads[i], NULL);
+  }
+
+  // expected 40 (4 threads * 10 tasks)
+  printf("callbacks called: %d\n", atomic_load(&calls_count));
+
+  // expected HANDLE_SHARDS_ARE_EMPTY (code 2), the shards are released
+  log_shard = get_earliest_shard();
+  printf("get_earliest_shard(): ERROR_CODE: %hd\n",
+         log_shard.shards_result.CODES_RESULT);
+
+  pthread_barrier_destroy(&registered_barrier);
+  pthread_barrier_destroy(&checked_barrier);
+
+  /** !Test data! */
+
+  return 0;
+}
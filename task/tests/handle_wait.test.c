@@ -0,0 +1,98 @@
+/**
+ *  @note Checks the blocking wait ( @see{wait_next_deadline} ): the early wake
+ *  up via the earlier deadline registered by the other thread, the wake up at
+ *  the deadline, the timeout and the refused wait inside the opened clock
+ *  tick. The queue is guarded by the @link{queue_mutex}, the waiter releases
+ *  it while sleeping ( @see{wait_next_deadline_locked} ). Link with -pthread.
+ *
+ *  Usage
+ *  copy all the code below to the @file{task/main.c}, check that #include's are
+ *  copied too
+ *
+ */
+
+// nanosleep() declaration for the strict -std=c23 builds
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+static pthread_mutex_t queue_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ *  @brief Utility function (encapsulated) to get the time (ms) gone since the
+ *  @link{started_ticks}
+ *
+ */
+static long long get_elapsed_ms(TASK_TICKS started_ticks) {
+  return (get_now_ticks().handle_clock_result.TICKS - started_ticks) /
+         RATIO_NANOSEC_MSEC;
+}
+
+/**
+ *  @brief The other thread: registers the earlier task (200 ms) in 100 ms
+ *
+ */
+static void *register_earlier_task(void *arg) {
+  (void)arg;
+  nanosleep(&(struct timespec){.tv_nsec = 100'000'000}, NULL);
+
+  pthread_mutex_lock(&queue_mutex);
+  register_task(show_task_info, 2, 200);
+  pthread_mutex_unlock(&queue_mutex);
+
+  return NULL;
+}
+
+int main(void) {
+  /** !Test data! */
+  const TASK_TICKS STARTED_TICKS = get_now_ticks().handle_clock_result.TICKS;
+  pthread_t thread;
+
+  pthread_mutex_lock(&queue_mutex);
+  register_task(show_task_info, 1, 2'000);
+  pthread_create(&thread, NULL, register_earlier_task, NULL);
+
+  // expected HANDLE_WAIT_NOTIFIED (code 1) in ~100 ms (not in 2000 ms)
+  PROMISE_WAIT log_wait =
+      wait_next_deadline_locked(&queue_mutex, HANDLE_WAIT_FOREVER);
+  printf("wait_next_deadline_locked(): %d at %lld ms\n", log_wait.CODES_RESULT,
+         get_elapsed_ms(STARTED_TICKS));
+
+  // expected HANDLE_WAIT_DONE_SUCCESSFULLY (code 0) in ~300 ms
+  log_wait = wait_next_deadline_locked(&queue_mutex, HANDLE_WAIT_FOREVER);
+  printf("wait_next_deadline_locked(): %d at %lld ms\n", log_wait.CODES_RESULT,
+         get_elapsed_ms(STARTED_TICKS));
+
+  // expected the task 2 is served
+  PROMISE_TASK log_task = get_callback();
+
+  if (log_task.type == SUCCESS) {
+    get_task_callback(&log_task.get_callback_result.TASK)(
+        log_task.get_callback_result.TASK.func_arg);
+  }
+
+  // expected HANDLE_WAIT_TIMEOUT (code 2) in ~400 ms (the task 1 is pending)
+  log_wait = wait_next_deadline_locked(&queue_mutex, 100);
+  printf("wait_next_deadline_locked(): %d at %lld ms\n", log_wait.CODES_RESULT,
+         get_elapsed_ms(STARTED_TICKS));
+
+  // expected ERROR_CODE HANDLE_WAIT_TICK_OPENED (code 4) at once: the cached
+  // timestamp of the opened tick never reaches the deadline
+  begin_clock_tick();
+  log_wait = wait_next_deadline_locked(&queue_mutex, HANDLE_WAIT_FOREVER);
+  end_clock_tick();
+  printf("wait_next_deadline_locked(): type %d, %d at %lld ms\n",
+         log_wait.type, log_wait.CODES_RESULT, get_elapsed_ms(STARTED_TICKS));
+
+  pthread_mutex_unlock(&queue_mutex);
+  pthread_join(thread, NULL);
+
+  /** !Test data! */
+
+  return 0;
+}
@@ -0,0 +1,112 @@
+/**
+ *  @note Checks the worker pool ( @see{start_worker_pool} ): the starting
+ *  and attaching errors (one dispatcher instance, @see{attach_worker_pool_in})
+ *  and the slow callback that doesn't delay the rest of the expired
+ *  ones (they are stolen by the idle workers). Link with -pthread.
+ *
+ *  Usage
+ *  copy all the code below to the @file{task/main.c}, check that #include's are
+ *  copied too
+ *
+ */
+
+// nanosleep(), clock_gettime() declarations for the strict -std=c23 builds
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdatomic.h>
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+enum Test_worker_pool_variables {
+  FAST_TASKS_QUANTITY = 8, /**< the fast callbacks at the same deadline */
+  SLOW_CALLBACK_MS = 300,  /**< duration of the slow callback */
+};
+
+static Scheduler other_scheduler = SCHEDULER_INITIALIZER;
+static atomic_int fast_calls_count = 0;
+static atomic_bool is_slow_called = false;
+static _Atomic TASK_TICKS fast_done_ticks = 0;
+
+/**
+ *  @brief Utility function (encapsulated) to get the monotonic timestamp (ns)
+ *  on the worker (the scheduler's clock tick belongs to the dispatcher)
+ *
+ */
+static TASK_TICKS get_test_ticks(void) {
+  struct timespec ts = {};
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return (TASK_TICKS)ts.tv_sec * RATIO_SEC_NANOSEC + ts.tv_nsec;
+}
+
+static void slow_callback(unsigned short arg) {
+  (void)arg;
+  nanosleep(&(struct timespec){.tv_nsec = SLOW_CALLBACK_MS * 1'000'000L},
+            NULL);
+  atomic_store(&is_slow_called, true);
+}
+
+static void fast_callback(unsigned short arg) {
+  (void)arg;
+
+  if (atomic_fetch_add(&fast_calls_count, 1) + 1 == FAST_TASKS_QUANTITY) {
+    atomic_store(&fast_done_ticks, get_test_ticks());
+  }
+}
+
+int main(void) {
+  /** !Test data! */
+
+  // check expect errors HANDLE_WORKER_POOL_INVALID_WORKERS_COUNT (expected
+  // code 1) and HANDLE_WORKER_POOL_IS_STARTED (expected code 2)
+  printf("start_worker_pool(0): ERROR_CODE: %d\n", start_worker_pool(0));
+  enum Handle_worker_pool_errors_codes code = start_worker_pool(4);
+  printf("start_worker_pool(4): %d, started: %d\n", code,
+         is_worker_pool_started());
+  printf("start_worker_pool(4): ERROR_CODE: %d\n", start_worker_pool(4));
+
+  // check the one dispatcher => the default instance is attached (expected
+  // code 0), the other one isn't (HANDLE_WORKER_POOL_IS_ATTACHED, code 5)
+  printf("attach_worker_pool(): %d\n", attach_worker_pool());
+  printf("attach_worker_pool_in(other): ERROR_CODE: %d\n",
+         attach_worker_pool_in(&other_scheduler));
+
+  // check happy path => the slow callback is the first one of the same
+  // deadline, the fast ones are called by the other workers meanwhile
+  const TASK_TICKS STARTED_TICKS = get_test_ticks();
+
+  register_task_ex(slow_callback, 0, 100);
+
+  for (int i = 1; i <= FAST_TASKS_QUANTITY; i += 1) {
+    register_task_ex(fast_callback, i, 100);
+  }
+
+  while (default_scheduler.task_count > 0) {
+    wait_next_deadline(HANDLE_WAIT_FOREVER);
+    run_ready_tasks((RUN_BUDGET){});
+  }
+
+  // expected the slow one is still running, the fast ones are done at ~100 ms
+  while (atomic_load(&fast_calls_count) < FAST_TASKS_QUANTITY) {
+    nanosleep(&(struct timespec){.tv_nsec = 1'000'000}, NULL);
+  }
+
+  printf("fast callbacks: %d at %lld ms, the slow one is called: %d\n",
+         atomic_load(&fast_calls_count),
+         (atomic_load(&fast_done_ticks) - STARTED_TICKS) / RATIO_NANOSEC_MSEC,
+         atomic_load(&is_slow_called));
+
+  // expected the slow one is done by the stopping (~400 ms)
+  stop_worker_pool();
+  printf("stopped at %lld ms, the slow one is called: %d, started: %d\n",
+         (get_test_ticks() - STARTED_TICKS) /
+             RATIO_NANOSEC_MSEC,
+         atomic_load(&is_slow_called), is_worker_pool_started());
+
+  /** !Test data! */
+
+  return 0;
+}
@@ -1,9 +1,9 @@
 /**
- *  @note In the @file{task/config.h} at @type{enum Global_variables} set
- *  MAX_TASK_QUANTITY = 3 (to test all the cases below), otherwise one'll have
+ *  @note Compile with -DTASK_CAPACITY=3 (i.e. MAX_TASK_QUANTITY = 3 in the
+ *  @file{task/config.h}) to test all the cases below, otherwise one'll have
  *  got an "segmentation fault" error (because of incorrect @param{arr_size} and
  *  @param{elems_quantity_to_sort} in the
- *  @callback{sort_tasks_descending_by_delay_func} function)
+ *  @callback{sort_tasks_descending_by_deadline_func} function)
  *
  *  Usage
  *  copy all the code below to the @file{task/main.c}, check that #include's are
@@ -24,11 +24,11 @@ int main(void) {
   // check expect error REGISTER_TASK_ARRAY_OF_TASKS_FULL
   //  (expected error_code 1)
   // setup test data
-  TASK_COUNTER task_count_temp = task_count;
-  task_count = MAX_TASK_QUANTITY;
+  TASK_COUNTER task_count_temp = default_scheduler.task_count;
+  default_scheduler.task_count = MAX_TASK_QUANTITY;
 
   PROMISE_TASK_ID log_id = {};
-  TASK_COUNTER task_id;
+  TASK_HANDLE task_id;
 
   log_id = register_task(show_task_info, 5, 400);
 
@@ -36,8 +36,8 @@ int main(void) {
   case SUCCESS:
     task_id = log_id.register_task_result.TASK_ID;
     printf("register_task(): task was registered successfully\n");
-    printf("ID: %hd\n", log_id.register_task_result.TASK_ID);
-    printf("task_id: %hd\n", task_id);
+    printf("ID: %llu\n", log_id.register_task_result.TASK_ID);
+    printf("task_id: %llu\n", task_id);
     break;
   case ERROR_CODE:
     printf("register_task(): ERROR_CODE: %hd\n",
@@ -49,7 +49,7 @@ int main(void) {
   }
 
   // teardown => restore task_count value
-  task_count = task_count_temp;
+  default_scheduler.task_count = task_count_temp;
 
   // check happy path => tasks registered correctly (@type{unsigned short}
   // TASK_ID as the result)
@@ -59,8 +59,8 @@ int main(void) {
   case SUCCESS:
     task_id = log_id.register_task_result.TASK_ID;
     printf("register_task(): task was registered successfully\n");
-    printf("ID: %hd\n", log_id.register_task_result.TASK_ID);
-    printf("task_id: %hd\n", task_id);
+    printf("ID: %llu\n", log_id.register_task_result.TASK_ID);
+    printf("task_id: %llu\n", task_id);
     break;
   case ERROR_CODE:
     printf("register_task(): ERROR_CODE: %hd\n",
@@ -77,8 +77,8 @@ int main(void) {
   case SUCCESS:
     task_id = log_id.register_task_result.TASK_ID;
     printf("register_task(): task was registered successfully\n");
-    printf("ID: %hd\n", log_id.register_task_result.TASK_ID);
-    printf("task_id: %hd\n", task_id);
+    printf("ID: %llu\n", log_id.register_task_result.TASK_ID);
+    printf("task_id: %llu\n", task_id);
     break;
   case ERROR_CODE:
     printf("register_task(): ERROR_CODE: %hd\n",
@@ -95,8 +95,8 @@ int main(void) {
   case SUCCESS:
     task_id = log_id.register_task_result.TASK_ID;
     printf("register_task(): task was registered successfully\n");
-    printf("ID: %hd\n", log_id.register_task_result.TASK_ID);
-    printf("task_id: %hd\n", task_id);
+    printf("ID: %llu\n", log_id.register_task_result.TASK_ID);
+    printf("task_id: %llu\n", task_id);
     break;
   case ERROR_CODE:
     printf("register_task(): ERROR_CODE: %hd\n",
@@ -116,8 +116,8 @@ int main(void) {
   case SUCCESS:
     task_id = log_id.register_task_result.TASK_ID;
     printf("register_task(): task was registered successfully\n");
-    printf("ID: %hd\n", log_id.register_task_result.TASK_ID);
-    printf("task_id: %hd\n", task_id);
+    printf("ID: %llu\n", log_id.register_task_result.TASK_ID);
+    printf("task_id: %llu\n", task_id);
     break;
   case ERROR_CODE:
     printf("register_task(): ERROR_CODE: %hd\n",
@@ -128,28 +128,31 @@ int main(void) {
     break;
   }
 
-  // manual zero the Task (do not do that anymore! use proper methods instead!)
-  tasks_array[0] = (Task){0};
-  task_count -= 1;
-  PROMISE_ID_VALUE log_id_value = free_id(task_id);
+  // remove the last registered Task via its' handle (the queue backend
+  // unlinks it, the id is freed for the next one)
+  PROMISE_REMOVE_TASK log_remove_task = remove_task(task_id);
 
-  switch (log_id_value.type) {
+  switch (log_remove_task.type) {
   case SUCCESS:
-    task_id -= 1;
-    printf("free_id(): id value was freed successfully\n");
+    printf("remove_task(): the task was removed successfully\n");
     break;
   case ERROR_CODE:
-    printf("ERROR_CODE: %hd\n", log_id_value.handle_id_result.CODES_RESULT);
+    printf("remove_task(): ERROR_CODE: %hd\n", log_remove_task.CODES_RESULT);
+    break;
   default:
     fprintf(stderr,
-            "Error(%s() function at %d): ups... Unknown log_id_value.type\n",
+            "Error(%s() function at %d): ups... Unknown log_remove_task.type\n",
             __func__, __LINE__);
     break;
   }
 
+#if TASK_QUEUE_BACKEND == TASK_QUEUE_BACKEND_SORTED_ARRAY
   // @note ! Can cause "segmentation fault" error! Check
   // @link{MAX_TASK_QUANTITY} and @param{elems_quantity_to_sort} (currently = 3)
-  sort_tasks_descending_by_delay(tasks_array, MAX_TASK_QUANTITY, 3);
+  // @note the rest backends keep their own order of the arena, don't sort it
+  sort_tasks_descending_by_deadline(default_scheduler.tasks_array,
+                                    MAX_TASK_QUANTITY, 3);
+#endif
 
   log_id = register_task(show_task_info, 96, 400);
 
@@ -157,8 +160,8 @@ int main(void) {
   case SUCCESS:
     task_id = log_id.register_task_result.TASK_ID;
     printf("register_task(): task was registered successfully\n");
-    printf("ID: %hd\n", log_id.register_task_result.TASK_ID);
-    printf("task_id: %hd\n", task_id);
+    printf("ID: %llu\n", log_id.register_task_result.TASK_ID);
+    printf("task_id: %llu\n", task_id);
     break;
   case ERROR_CODE:
     printf("register_task(): ERROR_CODE: %hd\n",
@@ -173,8 +176,8 @@ int main(void) {
 
   // check expect error "GET_CALLBACK_ARRAY_OF_TASKS_EMPTY"
   //  (expected error_code 1)
-  task_count_temp = task_count;
-  task_count = 0;
+  task_count_temp = default_scheduler.task_count;
+  default_scheduler.task_count = 0;
 
   PROMISE_TASK log_task = get_callback();
   Task task = {};
@@ -196,7 +199,7 @@ int main(void) {
   }
 
   // restore task_count value
-  task_count = task_count_temp;
+  default_scheduler.task_count = task_count_temp;
 
   // check expect error "GET_CALLBACK_PENDING"
   //  (expected error_code 3)
@@ -241,8 +244,10 @@ int main(void) {
     break;
   }
 
-  // run the Task{...} with Task.func_arg
-  task.callback(task.func_arg);
+  // run the Task{...} with Task.func_arg (only the got one)
+  if (log_task.type == SUCCESS) {
+    get_task_callback(&task)(task.func_arg);
+  }
 
   // add new Task{...}
   log_id = register_task(show_task_info, 960, 960);
@@ -251,8 +256,8 @@ int main(void) {
   case SUCCESS:
     task_id = log_id.register_task_result.TASK_ID;
     printf("register_task(): task was registered successfully\n");
-    printf("ID: %hd\n", log_id.register_task_result.TASK_ID);
-    printf("task_id: %hd\n", task_id);
+    printf("ID: %llu\n", log_id.register_task_result.TASK_ID);
+    printf("task_id: %llu\n", task_id);
     break;
   case ERROR_CODE:
     printf("register_task(): ERROR_CODE: %hd\n",
@@ -267,8 +272,8 @@ int main(void) {
 
   // check expect error GET_CALLBACK_ARRAY_OF_TASKS_EMPTY
   //  (expected error_code 1)
-  task_count_temp = task_count;
-  task_count = 0;
+  task_count_temp = default_scheduler.task_count;
+  default_scheduler.task_count = 0;
 
   PROMISE_CHANGE_TASK_DELAY log_change_task_delay = change_task_delay(0, 1600);
 
@@ -289,7 +294,7 @@ int main(void) {
   }
 
   // restore task_count value
-  task_count = task_count_temp;
+  default_scheduler.task_count = task_count_temp;
 
   // check expect error CHANGE_TASK_DELAY_TASK_ID_IS_NOT_DETERMINED
   //  (expected error_code 2)
@@ -314,7 +319,7 @@ int main(void) {
 
   // check happy path => CHANGE_TASK_DELAY_DONE_SUCCESSFULLY
 
-  log_change_task_delay = change_task_delay(0, 1600);
+  log_change_task_delay = change_task_delay(task_id, 1600);
 
   switch (log_change_task_delay.type) {
   case SUCCESS:
@@ -336,10 +341,10 @@ int main(void) {
 
   // check expect error REMOVE_TASK_ARRAY_OF_TASKS_EMPTY
   //  (expected error_code 1)
-  task_count_temp = task_count;
-  task_count = 0;
+  task_count_temp = default_scheduler.task_count;
+  default_scheduler.task_count = 0;
 
-  PROMISE_REMOVE_TASK log_remove_task = remove_task(0);
+  log_remove_task = remove_task(0);
 
   switch (log_remove_task.type) {
   case SUCCESS:
@@ -358,7 +363,7 @@ int main(void) {
   }
 
   // restore task_count value
-  task_count = task_count_temp;
+  default_scheduler.task_count = task_count_temp;
 
   // check expect error REMOVE_TASK_TASK_ID_IS_NOT_DETERMINED
   //  (expected error_code 2)
@@ -382,7 +387,29 @@ int main(void) {
   }
 
   // check happy path => REMOVE_TASK_DONE_SUCCESSFULLY
-  log_remove_task = remove_task(0);
+  log_remove_task = remove_task(task_id);
+
+  switch (log_remove_task.type) {
+  case SUCCESS:
+    printf("log_remove_task(): REMOVE_TASK_DONE_SUCCESSFULLY\n");
+    break;
+  case ERROR_CODE:
+    printf("log_remove_task(): ERROR_CODE: %hd\n",
+           log_remove_task.CODES_RESULT);
+
+    break;
+  default:
+    fprintf(stderr,
+            "Error(%s() function at %d): ups... Unknown log_remove_task.type\n",
+            __func__, __LINE__);
+    break;
+  }
+
+  // check expect error REMOVE_TASK_TASK_ID_IS_NOT_DETERMINED for the stale
+  // handle (expected error_code 2): the next task reuses the freed id, but
+  // the handle of the removed task is stale
+  register_task(show_task_info, 7, 400);
+  log_remove_task = remove_task(task_id);
 
   switch (log_remove_task.type) {
   case SUCCESS:
@@ -400,6 +427,98 @@ int main(void) {
     break;
   }
 
+  // test @callback{get_ready_tasks} function
+
+  // check expect error GET_READY_TASKS_INVALID_BUFFER
+  //  (expected error_code 1)
+  Task ready_tasks[MAX_TASK_QUANTITY] = {};
+  PROMISE_READY_TASKS log_ready = get_ready_tasks(NULL, MAX_TASK_QUANTITY);
+
+  switch (log_ready.type) {
+  case SUCCESS:
+    printf("get_ready_tasks(): %zu tasks\n",
+           log_ready.get_ready_tasks_result.READY_COUNT);
+    break;
+  case ERROR_CODE:
+    printf("get_ready_tasks(): ERROR_CODE: %hd\n",
+           log_ready.get_ready_tasks_result.CODES_RESULT);
+    break;
+  default:
+    fprintf(stderr,
+            "Error(%s() function at %d): ups... Unknown log_ready.type\n",
+            __func__, __LINE__);
+    break;
+  }
+
+  // add sleep of the stream (@note it blocks the stream!)
+  sleep(1);
+
+  // check happy path => the expired tasks in the deadline order, the buffer
+  // for 2 tasks only (the rest is drained via the next call, then 0 tasks)
+  for (int call = 0; call < 3; call += 1) {
+    log_ready = get_ready_tasks(ready_tasks, call == 0 ? 2 : MAX_TASK_QUANTITY);
+
+    switch (log_ready.type) {
+    case SUCCESS:
+      printf("get_ready_tasks(): %zu tasks\n",
+             log_ready.get_ready_tasks_result.READY_COUNT);
+
+      for (size_t i = 0; i < log_ready.get_ready_tasks_result.READY_COUNT;
+           i += 1) {
+        get_task_callback(&ready_tasks[i])(ready_tasks[i].func_arg);
+      }
+      break;
+    case ERROR_CODE:
+      printf("get_ready_tasks(): ERROR_CODE: %hd\n",
+             log_ready.get_ready_tasks_result.CODES_RESULT);
+      break;
+    default:
+      fprintf(stderr,
+              "Error(%s() function at %d): ups... Unknown log_ready.type\n",
+              __func__, __LINE__);
+      break;
+    }
+  }
+
+  // test @callback{run_ready_tasks} function
+
+  // check happy path => the budget of 1 task (IS_BUDGET_EXHAUSTED: 1 at the
+  // first call), the rest at the second call (the queue is empty => next: 0),
+  // then 0 tasks and the pending deadline of the 1000 ms task (next: 1)
+  register_task(show_task_info, 8, 0);
+  register_task(show_task_info, 9, 0);
+
+  // add sleep of the stream (@note it blocks the stream!)
+  sleep(1);
+
+  for (int call = 0; call < 3; call += 1) {
+    if (call == 2) {
+      register_task(show_task_info, 10, 1000);
+    }
+
+    PROMISE_RUN_READY_TASKS log_run =
+        run_ready_tasks((RUN_BUDGET){.max_tasks = call == 0 ? 1 : 0});
+
+    switch (log_run.type) {
+    case SUCCESS:
+      printf("run_ready_tasks(): %zu tasks, exhausted: %d, next: %d\n",
+             log_run.run_ready_tasks_result.REPORT.RAN_COUNT,
+             log_run.run_ready_tasks_result.REPORT.IS_BUDGET_EXHAUSTED,
+             log_run.run_ready_tasks_result.REPORT.NEXT_DEADLINE_TICKS !=
+                 LLONG_MAX);
+      break;
+    case ERROR_CODE:
+      printf("run_ready_tasks(): ERROR_CODE: %hd\n",
+             log_run.run_ready_tasks_result.CODES_RESULT);
+      break;
+    default:
+      fprintf(stderr,
+              "Error(%s() function at %d): ups... Unknown log_run.type\n",
+              __func__, __LINE__);
+      break;
+    }
+  }
+
   /** !Test data! */
 
   return 0;
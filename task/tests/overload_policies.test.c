@@ -0,0 +1,220 @@
+/**
+ *  @note Checks the overload policies ( @see{set_overload_policy_in} ): the
+ *  full queue is rejected (default), evicted from (the task with the latest
+ *  deadline, the notification) or blocked on (the expired tasks are served
+ *  in the registering thread, the timeout, rejected at once inside the
+ *  callback or while the other thread waits on the instance), the admission
+ *  control refuses the tasks while the loop is late. The simulated clock (the
+ *  opened clock tick) except of the blocking with the timeout.
+ *
+ *  Usage
+ *  copy all the code below to the @file{task/main.c}, check that #include's are
+ *  copied too
+ *
+ */
+
+#include <limits.h>
+#include <stdatomic.h>
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+static Scheduler test_scheduler = SCHEDULER_INITIALIZER;
+
+static void print_call(unsigned short arg) {
+  printf("  called %u\n", arg);
+}
+
+static void print_evicted(TASK_HANDLE handle, unsigned short arg) {
+  (void)handle;
+  printf("  evicted %u\n", arg);
+}
+
+/**
+ *  @brief Move the simulated clock of the @link{test_scheduler} to
+ *  @link{now_ticks} (ns)
+ *
+ */
+static void set_test_now(TASK_TICKS now_ticks) {
+  test_scheduler.clock =
+      (CLOCK_TICK){.cached_now_ticks = now_ticks, .is_tick_opened = true};
+}
+
+/**
+ *  @brief Fill the queue of the @link{test_scheduler} up: the task i is due
+ *  in 10 + i ms, its' argument is i
+ *
+ */
+static void fill_test_queue(void) {
+  for (int i = 0; i < MAX_TASK_QUANTITY; i += 1) {
+    register_task_in(&test_scheduler, print_call, (unsigned short)i, 10 + i);
+  }
+}
+
+/**
+ *  @brief Register the task due in @link{delay} ms, print the result
+ *
+ */
+static void register_test_task(unsigned short arg, TASK_DELAY delay) {
+  PROMISE_TASK_ID log_id =
+      register_task_in(&test_scheduler, print_call, arg, delay);
+
+  printf("  register %u in %llu ms: type %d", arg, delay, log_id.type);
+
+  if (log_id.type == ERROR_CODE) {
+    printf(", error_code %d", log_id.register_task_result.CODES_RESULT);
+  }
+
+  printf(", task_count %d\n", (int)test_scheduler.task_count);
+}
+
+/**
+ *  @brief Test callback: registers the task to the full queue of the
+ *  @link{test_scheduler} (the policy is TASK_FULL_QUEUE_BLOCK)
+ *
+ */
+static void register_in_callback(unsigned short arg) {
+  register_test_task(arg, 1'000);
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get current timestamp (ns)
+ *
+ */
+static long long get_test_timestamp_ns(void) {
+  struct timespec ts = {};
+  timespec_get(&ts, TIME_UTC);
+
+  return (long long)ts.tv_sec * RATIO_SEC_NANOSEC + ts.tv_nsec;
+}
+
+int main(void) {
+  /** !Test data! */
+
+  // reject (default): expected REGISTER_TASK_ARRAY_OF_TASKS_FULL (error_code
+  // 1), rejected_count 1
+  set_test_now(0);
+  fill_test_queue();
+  printf("reject:\n");
+  register_test_task(100, 5);
+  printf("  rejected_count: %llu\n", test_scheduler.overload.rejected_count);
+
+  // evict: expected "evicted <MAX_TASK_QUANTITY - 1>" (the latest deadline)
+  // and type 0, then the new latest task (MAX_TASK_QUANTITY - 2) is evicted
+  // for the task due in 11 ms, then the task later than all is rejected
+  set_overload_policy_in(
+      &test_scheduler,
+      (OVERLOAD_POLICY){.full_queue_policy = TASK_FULL_QUEUE_EVICT_FURTHEST,
+                        .on_evicted = print_evicted});
+  printf("evict:\n");
+  register_test_task(101, 5);
+  register_test_task(102, 11);
+  register_test_task(103, 10'000);
+  printf("  evicted_count: %llu\n", test_scheduler.overload.evicted_count);
+
+  // block inside the opened tick at 5 ms: expected "called 101" (the only
+  // expired task, its' slot is freed) and type 0, then with no expired task
+  // left => error_code 1 at once (the cached clock doesn't move)
+  set_overload_policy_in(
+      &test_scheduler,
+      (OVERLOAD_POLICY){.full_queue_policy = TASK_FULL_QUEUE_BLOCK,
+                        .block_timeout_ms = HANDLE_WAIT_FOREVER});
+  set_test_now(5'000'000);
+  printf("block (opened tick):\n");
+  register_test_task(104, 1'000);
+  register_test_task(105, 1'000);
+
+  // the zero timeout at 10 ms: expected "called 0" (the task due at 10 ms)
+  // and type 0, the freed slot is taken although the timeout is over
+  set_overload_policy_in(
+      &test_scheduler,
+      (OVERLOAD_POLICY){.full_queue_policy = TASK_FULL_QUEUE_BLOCK});
+  set_test_now(10'000'000);
+  printf("block (zero timeout):\n");
+  register_test_task(111, 1'000);
+
+  // block while the other thread waits on the instance (simulated: its'
+  // waiter reads the queue) at 20 ms: the expired tasks are its' ones =>
+  // expected no calls, error_code 1 at once
+  atomic_store(&test_scheduler.wait.waited_deadline_ticks, LLONG_MAX);
+  set_test_now(20'000'000);
+  printf("block (shared instance):\n");
+  register_test_task(113, 1'000);
+  atomic_store(&test_scheduler.wait.waited_deadline_ticks, LLONG_MIN);
+
+  // block inside the callback: its' own task holds the top, nothing can be
+  // served => expected error_code 1 at once, task_count <MAX_TASK_QUANTITY>
+  init_scheduler(&test_scheduler);
+  set_overload_policy_in(
+      &test_scheduler,
+      (OVERLOAD_POLICY){.full_queue_policy = TASK_FULL_QUEUE_BLOCK,
+                        .block_timeout_ms = HANDLE_WAIT_FOREVER});
+  set_test_now(0);
+  register_task_in(&test_scheduler, register_in_callback, 110, 0);
+  for (int i = 1; i < MAX_TASK_QUANTITY; i += 1) {
+    register_task_in(&test_scheduler, print_call, (unsigned short)i, 1'000);
+  }
+  printf("block (callback):\n");
+  run_ready_tasks_in(&test_scheduler, (RUN_BUDGET){});
+
+  // admission: 30 ms late (the task 0 due at 10 ms) with the limit 20 ms =>
+  // the task due in 5 ms (predicted 25 ms late) expected
+  // REGISTER_TASK_ADMISSION_REJECTED (error_code 7), the task due in 10 s
+  // (the loop catches up before it) is admitted, then the loop catches up
+  // (serves the tasks due till 40 ms) => admitted
+  init_scheduler(&test_scheduler);
+  set_overload_policy_in(&test_scheduler,
+                         (OVERLOAD_POLICY){.max_lateness_ms = 20});
+  set_test_now(0);
+  register_task_in(&test_scheduler, print_call, 0, 10);
+  set_test_now(40'000'000);
+  printf("admission:\n");
+  register_test_task(106, 5);
+  register_test_task(112, 10'000);
+  run_ready_tasks_in(&test_scheduler, (RUN_BUDGET){});
+  register_test_task(107, 5);
+
+  // block on the monotonic clock: the full queue of the tasks due in 20 ms,
+  // the timeout 100 ms => expected "called 0" and type 0 after ~20 ms (the
+  // new task is due in 1'000 ms after the block, not after the call), then
+  // with the tasks due in 1 s and the timeout 5 ms => error_code 1 after
+  // ~5 ms
+  init_scheduler(&test_scheduler);
+  set_overload_policy_in(
+      &test_scheduler,
+      (OVERLOAD_POLICY){.full_queue_policy = TASK_FULL_QUEUE_BLOCK,
+                        .block_timeout_ms = 100});
+  for (int i = 0; i < MAX_TASK_QUANTITY; i += 1) {
+    register_task_in(&test_scheduler, print_call, (unsigned short)i,
+                     i == 0 ? 20 : 1'000);
+  }
+  printf("block (timeout 100 ms):\n");
+  long long started_ns = get_test_timestamp_ns();
+  TASK_TICKS started_ticks =
+      get_now_ticks_in(&test_scheduler).handle_clock_result.TICKS;
+  register_test_task(108, 1'000);
+  long long blocked_ms =
+      (get_test_timestamp_ns() - started_ns) / RATIO_NANOSEC_MSEC;
+  printf("  blocked for 15+ ms: %d\n", blocked_ms >= 15);
+  printf("  due in 1'015+ ms after the call: %d\n",
+         task_queue_peek_furthest(&test_scheduler)->deadline_ticks -
+                 started_ticks >=
+             1'015 * RATIO_NANOSEC_MSEC);
+
+  set_overload_policy_in(
+      &test_scheduler,
+      (OVERLOAD_POLICY){.full_queue_policy = TASK_FULL_QUEUE_BLOCK,
+                        .block_timeout_ms = 5});
+  printf("block (timeout 5 ms):\n");
+  started_ns = get_test_timestamp_ns();
+  register_test_task(109, 1'000);
+  blocked_ms = (get_test_timestamp_ns() - started_ns) / RATIO_NANOSEC_MSEC;
+  printf("  blocked for [5; 100) ms: %d\n",
+         (blocked_ms >= 5) && (blocked_ms < 100));
+
+  /** !Test data! */
+
+  return 0;
+}
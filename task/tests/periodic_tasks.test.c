@@ -0,0 +1,123 @@
+/**
+ *  @note Checks the periodic tasks ( @see{register_periodic_task_in} ) on
+ *  the simulated clock (the opened clock tick): the served task keeps its'
+ *  handle, the next deadline is counted from the previous one, the missed
+ *  periods are skipped or served in a row per catch-up policy, the removed
+ *  task stops. The deadlines are read from the task record, so the output is
+ *  the same for every @link{TASK_QUEUE_BACKEND}.
+ *
+ *  Usage
+ *  copy all the code below to the @file{task/main.c}, check that #include's are
+ *  copied too
+ *
+ */
+
+#include <limits.h>
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+static Scheduler test_scheduler = SCHEDULER_INITIALIZER;
+static int called_count = 0;
+
+/**
+ *  @brief Test callback: counts the calls
+ *
+ */
+static void count_call(unsigned short arg) {
+  (void)arg;
+  called_count += 1;
+}
+
+/**
+ *  @brief Move the simulated clock of the @link{test_scheduler} to
+ *  @link{now_ms} (ms)
+ *
+ */
+static void set_test_now_ms(long long now_ms) {
+  test_scheduler.clock = (CLOCK_TICK){
+      .cached_now_ticks = now_ms * RATIO_NANOSEC_MSEC, .is_tick_opened = true};
+}
+
+/**
+ *  @brief Get the exact deadline (ms) of the task of the
+ *  @link{test_scheduler} (the only one) from its' record, LLONG_MAX ns (
+ *  "never") if there is no task. The timing wheel's next deadline (
+ *  @see{task_queue_get_next_deadline} ) is the start of the slot only
+ *
+ */
+static long long get_test_deadline_ms(void) {
+  Task *ptr_task = task_queue_peek_furthest(&test_scheduler);
+
+  return (ptr_task == NULL ? LLONG_MAX : ptr_task->deadline_ticks) /
+         RATIO_NANOSEC_MSEC;
+}
+
+int main(void) {
+  /** !Test data! */
+  set_test_now_ms(1'000);
+
+  // expected REGISTER_TASK_INVALID_PERIOD (error_code 5)
+  printf("register_periodic_task_in(): %d\n",
+         register_periodic_task_in(&test_scheduler, count_call, 0, 0, 10,
+                                   TASK_CATCH_UP_SKIP)
+             .register_task_result.CODES_RESULT);
+
+  // every 100 ms starting at 1'010 ms
+  TASK_HANDLE skip_handle =
+      register_periodic_task_in(&test_scheduler, count_call, 1, 100, 10,
+                                TASK_CATCH_UP_SKIP)
+          .register_task_result.TASK_ID;
+
+  // served 30 ms late => expected calls: 1, the next deadline: 1'110 ms (not
+  // 1'140 ms)
+  set_test_now_ms(1'040);
+  run_ready_tasks_in(&test_scheduler, (RUN_BUDGET){});
+  printf("calls: %d next deadline: %lld ms task_count: %d\n", called_count,
+         get_test_deadline_ms(), (int)test_scheduler.task_count);
+
+  // stalled till 1'450 ms (1'110 ... 1'410 are missed) => expected calls: 2,
+  // the next deadline: 1'510 ms
+  set_test_now_ms(1'450);
+  run_ready_tasks_in(&test_scheduler, (RUN_BUDGET){});
+  printf("calls: %d next deadline: %lld ms\n", called_count,
+         get_test_deadline_ms());
+
+  // the handle is valid after the calls => expected remove: 0 (done), then
+  // no calls
+  printf("remove_task_in(): %d\n",
+         remove_task_in(&test_scheduler, skip_handle).type);
+  set_test_now_ms(2'000);
+  run_ready_tasks_in(&test_scheduler, (RUN_BUDGET){});
+  printf("calls: %d task_count: %d\n", called_count,
+         (int)test_scheduler.task_count);
+
+  // every 100 ms starting at 2'100 ms, stalled till 2'450 ms => expected
+  // calls: 2 + 4 (2'100 ... 2'400), the next deadline: 2'500 ms
+  TASK_HANDLE burst_handle =
+      register_periodic_task_in(&test_scheduler, count_call, 2, 100, 100,
+                                TASK_CATCH_UP_BURST)
+          .register_task_result.TASK_ID;
+  set_test_now_ms(2'450);
+  run_ready_tasks_in(&test_scheduler, (RUN_BUDGET){});
+  printf("calls: %d next deadline: %lld ms\n", called_count,
+         get_test_deadline_ms());
+
+  // served via get_callback_in => expected the same handle, the next
+  // deadline: 2'600 ms
+  set_test_now_ms(2'500);
+  PROMISE_TASK log_task = get_callback_in(&test_scheduler);
+  printf("get_callback_in(): %d same handle: %d next deadline: %lld ms\n",
+         log_task.type,
+         get_id_handle(&test_scheduler, log_task.get_callback_result.TASK.id) ==
+             burst_handle,
+         get_test_deadline_ms());
+
+  remove_task_in(&test_scheduler, burst_handle);
+
+  /** !Test data! */
+
+  return 0;
+}
@@ -0,0 +1,130 @@
+/**
+ *  @note Checks the priority classes ( @see{run_priority_ready_tasks_in} ) on
+ *  the simulated clock (the opened clock ticks of all the classes): the
+ *  highest class first whatever the deadlines, the earliest deadline first
+ *  within the class, the late task of the low class promoted by the aging,
+ *  the budget, the earliest next deadline of all the classes and the requeue
+ *  from the callback.
+ *
+ *  Usage
+ *  copy all the code below to the @file{task/main.c}, check that #include's are
+ *  copied too
+ *
+ */
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+static PriorityScheduler test_scheduler;
+static int requeued_count = 0;
+
+/**
+ *  @brief Print the argument i.e. the serving order
+ *
+ */
+static void print_call(unsigned short arg) {
+  printf("  called %u\n", arg);
+}
+
+/**
+ *  @brief Print the argument and requeue the task in its' class (class 1)
+ *  once
+ *
+ */
+static void requeue_call(unsigned short arg) {
+  printf("  called %u\n", arg);
+
+  if (requeued_count == 0) {
+    requeued_count += 1;
+    requeue_current_task_in(&test_scheduler.classes[1], 5);
+  }
+}
+
+/**
+ *  @brief Move the simulated clock of all the classes of the
+ *  @link{test_scheduler} to @link{now_ticks} (ns)
+ *
+ */
+static void set_test_now(TASK_TICKS now_ticks) {
+  for (int i = 0; i < TASK_PRIORITY_CLASSES; i += 1) {
+    test_scheduler.classes[i].clock =
+        (CLOCK_TICK){.cached_now_ticks = now_ticks, .is_tick_opened = true};
+  }
+}
+
+/**
+ *  @brief Run the ready tasks and print the report
+ *
+ */
+static void run_test_tasks(RUN_BUDGET budget) {
+  RUN_READY_TASKS_REPORT report =
+      run_priority_ready_tasks_in(&test_scheduler, budget)
+          .run_ready_tasks_result.REPORT;
+
+  printf("  RAN_COUNT: %zu, IS_BUDGET_EXHAUSTED: %d, NEXT_DEADLINE_TICKS: "
+         "%lld\n",
+         report.RAN_COUNT, report.IS_BUDGET_EXHAUSTED,
+         report.NEXT_DEADLINE_TICKS);
+}
+
+int main(void) {
+  /** !Test data! */
+
+  init_priority_scheduler(&test_scheduler, 0);
+  set_test_now(0);
+
+  // expected REGISTER_TASK_INVALID_PRIORITY (error_code 6)
+  PROMISE_TASK_ID log_id = register_priority_task_in(
+      &test_scheduler, TASK_PRIORITY_CLASSES, print_call, 0, 1);
+  printf("invalid priority: type %d, error_code %d\n", log_id.type,
+         log_id.register_task_result.CODES_RESULT);
+
+  // strict priorities: expected 0, 1, 2 (the class order) then 21 (the
+  // earliest deadline within the class 2) then 22, RAN_COUNT: 5,
+  // NEXT_DEADLINE_TICKS: 100000000 (the timing wheel: 64000000, its' slot)
+  register_priority_task_in(&test_scheduler, 2, print_call, 22, 3);
+  register_priority_task_in(&test_scheduler, 2, print_call, 2, 1);
+  register_priority_task_in(&test_scheduler, 2, print_call, 21, 2);
+  register_priority_task_in(&test_scheduler, 1, print_call, 1, 4);
+  register_priority_task_in(&test_scheduler, 0, print_call, 0, 5);
+  register_priority_task_in(&test_scheduler, 1, print_call, 100, 100);
+  set_test_now(10'000'000);
+  printf("strict priorities:\n");
+  run_test_tasks((RUN_BUDGET){.max_tasks = 5});
+
+  // the budget: expected 0 only, IS_BUDGET_EXHAUSTED: 1, then 2
+  init_priority_scheduler(&test_scheduler, 0);
+  set_test_now(0);
+  register_priority_task_in(&test_scheduler, 2, print_call, 2, 1);
+  register_priority_task_in(&test_scheduler, 0, print_call, 0, 1);
+  set_test_now(10'000'000);
+  printf("budget:\n");
+  run_test_tasks((RUN_BUDGET){.max_tasks = 1});
+  run_test_tasks((RUN_BUDGET){});
+
+  // aging 3 ms at 10 ms, the aged deadlines: class 2 - 1 + 2 * 3 = 7 ms,
+  // class 1 - 7 + 3 = 10 ms, class 0 - 9 ms => expected 2 (9 ms late), 0
+  // and 1
+  init_priority_scheduler(&test_scheduler, 3);
+  set_test_now(0);
+  register_priority_task_in(&test_scheduler, 2, print_call, 2, 1);
+  register_priority_task_in(&test_scheduler, 1, print_call, 1, 7);
+  register_priority_task_in(&test_scheduler, 0, print_call, 0, 9);
+  set_test_now(10'000'000);
+  printf("aging:\n");
+  run_test_tasks((RUN_BUDGET){});
+
+  // the requeue from the callback within the class: expected 1 once,
+  // NEXT_DEADLINE_TICKS: 15000000, then 1 again at 15 ms
+  register_priority_task_in(&test_scheduler, 1, requeue_call, 1, 0);
+  printf("requeue:\n");
+  run_test_tasks((RUN_BUDGET){});
+  set_test_now(15'000'000);
+  run_test_tasks((RUN_BUDGET){});
+
+  /** !Test data! */
+
+  return 0;
+}
@@ -0,0 +1,147 @@
+/**
+ *  @note Checks the requeue of the firing task ( @see{requeue_current_task_in}
+ *  ) on the simulated clock (the opened clock tick): the requeued task keeps
+ *  its' handle and slot, the one-shot task that isn't requeued is freed after
+ *  its' callback, the callback may remove its' own task, the nested
+ *  run_ready_tasks_in / get_ready_tasks_in / get_callback_in serve nothing,
+ *  no requeue outside of the callback. The deadlines are read from the task
+ *  record, so the output is the same for every @link{TASK_QUEUE_BACKEND}.
+ *
+ *  Usage
+ *  copy all the code below to the @file{task/main.c}, check that #include's are
+ *  copied too
+ *
+ */
+
+#include <limits.h>
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+static Scheduler test_scheduler = SCHEDULER_INITIALIZER;
+static TASK_HANDLE test_handle = 0;
+static int called_count = 0;
+
+/**
+ *  @brief Move the simulated clock of the @link{test_scheduler} to
+ *  @link{now_ms} (ms)
+ *
+ */
+static void set_test_now_ms(long long now_ms) {
+  test_scheduler.clock = (CLOCK_TICK){
+      .cached_now_ticks = now_ms * RATIO_NANOSEC_MSEC, .is_tick_opened = true};
+}
+
+/**
+ *  @brief Get the exact deadline (ms) of the task of the
+ *  @link{test_scheduler} (the only one) from its' record, LLONG_MAX ns (
+ *  "never") if there is no task. The timing wheel's next deadline (
+ *  @see{task_queue_get_next_deadline} ) is the start of the slot only
+ *
+ */
+static long long get_test_deadline_ms(void) {
+  Task *ptr_task = task_queue_peek_furthest(&test_scheduler);
+
+  return (ptr_task == NULL ? LLONG_MAX : ptr_task->deadline_ticks) /
+         RATIO_NANOSEC_MSEC;
+}
+
+/**
+ *  @brief Test callback: requeues its' task @link{arg} times with 100 ms
+ *  delay, checks that the handle is the same one
+ *
+ */
+static void requeue_call(unsigned short arg) {
+  called_count += 1;
+
+  if (called_count <= arg) {
+    PROMISE_CHANGE_TASK_DELAY log_requeue =
+        requeue_current_task_in(&test_scheduler, 100);
+    printf("  requeue: %d same handle: %d task_count: %d\n",
+           log_requeue.type,
+           test_scheduler.firing.handle == test_handle,
+           (int)test_scheduler.task_count);
+  }
+}
+
+/**
+ *  @brief Test callback: removes its' own task, then tries to requeue it
+ *
+ */
+static void remove_itself_call(unsigned short arg) {
+  (void)arg;
+  called_count += 1;
+  PROMISE_REMOVE_TASK log_remove = remove_task_in(&test_scheduler, test_handle);
+  printf("  remove_task_in(): %d requeue: %d\n", log_remove.type,
+         requeue_current_task_in(&test_scheduler, 100).CODES_RESULT);
+}
+
+/**
+ *  @brief Test callback: registers the task with the zero delay and calls
+ *  run_ready_tasks_in nested
+ *
+ */
+static void nested_call(unsigned short arg) {
+  (void)arg;
+  called_count += 1;
+  register_task_in(&test_scheduler, requeue_call, 0, 0);
+  printf("  nested RAN_COUNT: %d\n",
+         (int)run_ready_tasks_in(&test_scheduler, (RUN_BUDGET){})
+             .run_ready_tasks_result.REPORT.RAN_COUNT);
+
+  Task ready_tasks[4];
+  printf("  nested READY_COUNT: %d get_callback_in(): %d\n",
+         (int)get_ready_tasks_in(&test_scheduler, ready_tasks, 4)
+             .get_ready_tasks_result.READY_COUNT,
+         get_callback_in(&test_scheduler).get_callback_result.CODES_RESULT);
+}
+
+int main(void) {
+  /** !Test data! */
+  set_test_now_ms(1'000);
+
+  // no firing task => expected CHANGE_TASK_DELAY_TASK_ID_IS_NOT_DETERMINED
+  // (error_code 2)
+  printf("requeue_current_task_in(): %d\n",
+         requeue_current_task_in(&test_scheduler, 100).CODES_RESULT);
+
+  // requeued 2 times => expected requeue: 0 same handle: 1 task_count: 1,
+  // then calls: 3, task_count: 0
+  test_handle = register_task_in(&test_scheduler, requeue_call, 2, 10)
+                    .register_task_result.TASK_ID;
+
+  for (long long now_ms = 1'010; now_ms <= 1'210; now_ms += 100) {
+    set_test_now_ms(now_ms);
+    run_ready_tasks_in(&test_scheduler, (RUN_BUDGET){});
+    printf("calls: %d next deadline: %lld ms task_count: %d\n", called_count,
+           get_test_deadline_ms(), (int)test_scheduler.task_count);
+  }
+
+  // removed by its' callback => expected remove: 0, requeue: 1
+  // (CHANGE_TASK_DELAY_ARRAY_OF_TASKS_EMPTY), then run: 0, task_count: 0
+  called_count = 0;
+  test_handle = register_task_in(&test_scheduler, remove_itself_call, 0, 10)
+                    .register_task_result.TASK_ID;
+  set_test_now_ms(1'300);
+  PROMISE_RUN_READY_TASKS log_run =
+      run_ready_tasks_in(&test_scheduler, (RUN_BUDGET){});
+  printf("run_ready_tasks_in(): %d task_count: %d\n", log_run.type,
+         (int)test_scheduler.task_count);
+
+  // the nested call runs nothing, the task registered with the same deadline
+  // (the clock tick is opened) is served by the outer call after the firing
+  // one is popped => expected nested RAN_COUNT: 0, READY_COUNT: 0,
+  // get_callback_in(): 5 (GET_CALLBACK_TASK_FIRING), RAN_COUNT: 2,
+  // task_count: 0
+  register_task_in(&test_scheduler, nested_call, 0, 0);
+  log_run = run_ready_tasks_in(&test_scheduler, (RUN_BUDGET){});
+  printf("RAN_COUNT: %d task_count: %d\n",
+         (int)log_run.run_ready_tasks_result.REPORT.RAN_COUNT,
+         (int)test_scheduler.task_count);
+
+  /** !Test data! */
+
+  return 0;
+}
@@ -0,0 +1,126 @@
+/**
+ *  @note Checks the independent scheduler instances ( @see{Scheduler} ): the
+ *  tasks and the handles of one instance are not seen by the other ones, and
+ *  the threads serve their own instances without any locks. Link with
+ *  -pthread.
+ *
+ *  @note The worker pool ( @see{start_worker_pool} ) is process-wide and its'
+ *  deques have one owner: only the instance attached via
+ *  @link{attach_worker_pool_in} pushes its' callbacks to the workers, the
+ *  rest instances (served by the other threads) call them inline and can't
+ *  attach till it is detached.
+ *
+ *  Usage
+ *  copy all the code below to the @file{task/main.c}, check that #include's are
+ *  copied too
+ *
+ */
+
+#include <pthread.h>
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+#define TEST_THREADS_QUANTITY 4
+#define TEST_TASKS_PER_THREAD 10
+
+static Scheduler io_scheduler = SCHEDULER_INITIALIZER;
+static Scheduler thread_schedulers[TEST_THREADS_QUANTITY];
+static _Atomic int called_count = 0;
+static _Atomic int attach_refused_count = 0;
+
+/**
+ *  @brief Test callback: counts the calls
+ *
+ */
+static void count_call(unsigned short arg) {
+  (void)arg;
+  called_count += 1;
+}
+
+/**
+ *  @brief The thread: serves its' own instance (no locks, no shards)
+ *
+ */
+static void *serve_own_scheduler(void *arg) {
+  Scheduler *ptr_scheduler = arg;
+
+  // the io instance owns the pool => the callbacks of this one run inline
+  if (attach_worker_pool_in(ptr_scheduler) == HANDLE_WORKER_POOL_IS_ATTACHED) {
+    attach_refused_count += 1;
+  }
+
+  for (unsigned short i = 0; i < TEST_TASKS_PER_THREAD; i += 1) {
+    register_task_in(ptr_scheduler, count_call, i, i * 10);
+  }
+
+  while (ptr_scheduler->task_count > 0) {
+    wait_next_deadline_in(ptr_scheduler, HANDLE_WAIT_FOREVER);
+    run_ready_tasks_in(ptr_scheduler, (RUN_BUDGET){});
+  }
+
+  return NULL;
+}
+
+int main(void) {
+  /** !Test data! */
+  pthread_t threads[TEST_THREADS_QUANTITY];
+
+  PROMISE_TASK_ID log_default_id = register_task(show_task_info, 1, 0);
+  PROMISE_TASK_ID log_io_id = register_task_in(&io_scheduler, show_task_info,
+                                               2, 0);
+
+  // expected 1 task per instance
+  printf("default: %lld tasks, io: %lld tasks\n",
+         (long long)default_scheduler.task_count,
+         (long long)io_scheduler.task_count);
+
+  // expected ERROR_CODE: the io instance's handle means nothing to the default
+  // one (its' own task under the same slot is removed already)
+  remove_task(log_default_id.register_task_result.TASK_ID);
+  PROMISE_REMOVE_TASK log_remove =
+      remove_task(log_io_id.register_task_result.TASK_ID);
+  printf("remove_task(io handle): %s\n",
+         log_remove.type == ERROR_CODE ? "ERROR_CODE" : "SUCCESS");
+
+  // expected "Im task {0}. Create TASK with delay :{2}": the io task is served
+  // by its' own instance (show_task_info prints the default one's task_count).
+  // Served till its' deadline is gone: the timing wheel serves the delay 0
+  // task at the next ms only
+  size_t io_ran_count = 0;
+
+  while (io_scheduler.task_count > 0) {
+    wait_next_deadline_in(&io_scheduler, HANDLE_WAIT_FOREVER);
+    io_ran_count += run_ready_tasks_in(&io_scheduler, (RUN_BUDGET){})
+                        .run_ready_tasks_result.REPORT.RAN_COUNT;
+  }
+
+  printf("run_ready_tasks_in(io): %zu tasks, io: %lld tasks\n", io_ran_count,
+         (long long)io_scheduler.task_count);
+
+  // the io instance is the only dispatcher of the pool
+  start_worker_pool(2);
+  attach_worker_pool_in(&io_scheduler);
+
+  for (int i = 0; i < TEST_THREADS_QUANTITY; i += 1) {
+    init_scheduler(&thread_schedulers[i]);
+    pthread_create(&threads[i], NULL, serve_own_scheduler,
+                   &thread_schedulers[i]);
+  }
+
+  for (int i = 0; i < TEST_THREADS_QUANTITY; i += 1) {
+    pthread_join(threads[i], NULL);
+  }
+
+  stop_worker_pool();
+
+  // expected 40 (inline), 4 refused attaches
+  printf("callbacks called: %d, attaches refused: %d\n", called_count,
+         attach_refused_count);
+
+  /** !Test data! */
+
+  return EXIT_SUCCESS;
+}
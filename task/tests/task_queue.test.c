@@ -0,0 +1,67 @@
+/**
+ *  @note Checks the order of the tasks of the queue backend
+ *  ( @see{TASK_QUEUE_BACKEND} ): the task with the least deadline is expected
+ *  on top regardless of the registration order.
+ *
+ *  Usage
+ *  copy all the code below to the @file{task/main.c}, check that #include's are
+ *  copied too
+ *
+ */
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+int main(void) {
+  /** !Test data! */
+  const TASK_TICKS CREATED_TICKS = get_now_ticks().handle_clock_result.TICKS;
+
+  // the last one is a far-future task (10 days, i.e. > 65535 ms)
+  const TASK_DELAY DELAYS[] = {1400, 400, 4200, 960, 50, 864'000'000};
+
+  for (TASK_COUNTER i = 0; i < sizeof(DELAYS) / sizeof(DELAYS[0]); i += 1) {
+    Task task = {.func_arg = i, .id = i};
+
+    set_task_callback(&task, show_task_info);
+    set_task_delay(&task, DELAYS[i], 0, CREATED_TICKS);
+    task_queue_push(&default_scheduler, task);
+  }
+
+  // reschedule id 2 (delay 4200 => 10) => expected on top
+  task_queue_reschedule(&default_scheduler, 2, 10, CREATED_TICKS);
+  // remove id 4 (delay 50)
+  task_queue_remove(&default_scheduler, 4);
+
+  // let the queue know that 5s are gone (i.e. all the tasks except of the
+  // far-future one are expired)
+  task_queue_advance(&default_scheduler,
+                     CREATED_TICKS + 5'000LL * RATIO_NANOSEC_MSEC);
+
+  // expected order of the delays: 10 400 960 1400 (the far-future task is
+  // pending)
+  while (task_queue_peek(&default_scheduler) != NULL &&
+         task_queue_peek(&default_scheduler)->deadline_ticks <=
+             CREATED_TICKS + 5'000LL * RATIO_NANOSEC_MSEC) {
+    const Task *ptr_task = task_queue_peek(&default_scheduler);
+
+    printf("id: %hd delay: %llu\n", ptr_task->id,
+           (ptr_task->deadline_ticks - CREATED_TICKS) / RATIO_NANOSEC_MSEC);
+    task_queue_pop(&default_scheduler);
+  }
+
+  // expected task_count: 1
+  printf("task_count: %hd\n", default_scheduler.task_count);
+
+  // expected remove of the far-future task (id 5) => task_count: 0
+  task_queue_remove(&default_scheduler, 5);
+  printf("task_count: %hd\n", default_scheduler.task_count);
+
+  // expected TASK_QUEUE_EMPTY (error_code 2)
+  printf("task_queue_pop(): %d\n", task_queue_pop(&default_scheduler));
+
+  /** !Test data! */
+
+  return 0;
+}
@@ -0,0 +1,94 @@
+/**
+ *  @note Checks the timer slack ( @see{register_task_with_slack_in} ) on the
+ *  simulated clock (the opened clock tick): the deadlines are in the window
+ *  [delay; delay + slack], the nearby ones are coalesced to one moment (one
+ *  wakeup), the slack is kept for the reschedules, 0 => exact deadline.
+ *  The deadlines are read from the task records ( @see{
+ *  task_queue_peek_furthest} ), the timing wheel's next deadline is the
+ *  start of the slot only, so the output is the same for every
+ *  @link{TASK_QUEUE_BACKEND}.
+ *
+ *  Usage
+ *  copy all the code below to the @file{task/main.c}, check that #include's are
+ *  copied too
+ *
+ */
+
+#include "./environment/global_variables.h"
+#include "./module_run_tasks_after_delay.h"
+
+#include "./utilities/utils.h"
+
+static Scheduler test_scheduler = SCHEDULER_INITIALIZER;
+static int called_count = 0;
+
+static void count_call(unsigned short arg) {
+  (void)arg;
+  called_count += 1;
+}
+
+/**
+ *  @brief Move the simulated clock of the @link{test_scheduler} to
+ *  @link{now_ticks} (ns)
+ *
+ */
+static void set_test_now(TASK_TICKS now_ticks) {
+  test_scheduler.clock =
+      (CLOCK_TICK){.cached_now_ticks = now_ticks, .is_tick_opened = true};
+}
+
+/**
+ *  @brief Get the exact deadline (ns) of the latest task of the
+ *  @link{test_scheduler} (the tasks below share one deadline or are alone)
+ *
+ */
+static TASK_TICKS get_test_deadline(void) {
+  return task_queue_peek_furthest(&test_scheduler)->deadline_ticks;
+}
+
+int main(void) {
+  /** !Test data! */
+
+  // expected 1006632960 (0x3C000000) and 1000000000 (no slack)
+  printf("get_coalesced_deadline_ticks(): %lld %lld\n",
+         get_coalesced_deadline_ticks(1'000'000'000, 10),
+         get_coalesced_deadline_ticks(1'000'000'000, 0));
+
+  // 3 tasks due at 1'000.0, 1'001.3 and 1'004.7 ms with 10 ms slack =>
+  // expected one deadline: 1006.632960 ms, one wakeup serves all of them
+  const TASK_TICKS CREATED_TICKS[] = {0, 1'300'000, 4'700'000};
+  TASK_HANDLE last_handle = 0;
+
+  for (int i = 0; i < 3; i += 1) {
+    set_test_now(CREATED_TICKS[i]);
+    last_handle = register_task_with_slack_in(&test_scheduler, count_call,
+                                              (unsigned short)i, 1'000, 10)
+                      .register_task_result.TASK_ID;
+    printf("task %d deadline: %lld ns\n", i, get_test_deadline());
+  }
+
+  // 1 ms past the deadline: the timing wheel serves the slot of the
+  // deadline's ms at the next ms only
+  set_test_now(get_test_deadline() + RATIO_NANOSEC_MSEC);
+  printf("RAN_COUNT: %d\n", (int)run_ready_tasks_in(&test_scheduler,
+                                                    (RUN_BUDGET){})
+                                .run_ready_tasks_result.REPORT.RAN_COUNT);
+
+  // the slack is kept by change_task_delay_in => expected 2004877312
+  // (0x77800000, the window [2'000; 2'010] ms), then without the slack =>
+  // expected 2000000000
+  last_handle = register_task_with_slack_in(&test_scheduler, count_call, 0,
+                                            1'000, 10)
+                    .register_task_result.TASK_ID;
+  set_test_now(1'000'000'000);
+  change_task_delay_in(&test_scheduler, last_handle, 1'000);
+  printf("change_task_delay_in(): %lld ns\n", get_test_deadline());
+  remove_task_in(&test_scheduler, last_handle);
+
+  register_task_in(&test_scheduler, count_call, 0, 1'000);
+  printf("register_task_in(): %lld ns\n", get_test_deadline());
+
+  /** !Test data! */
+
+  return 0;
+}
@@ -0,0 +1,75 @@
+#include <limits.h>
+
+#include "./utils.h"
+
+/**
+ *  @brief Count the absolute deadline (monotonic ns) of the task i.e. the
+ *  moment, when the task's delay is gone
+ *
+ *  @note Count it once (at the registration or delay changing) and save to the
+ *  @link{Task.deadline_ticks}. Compare that field instead of recounting.
+ *  @note The deadline is saturated at LLONG_MAX (i.e. "never"), so the huge
+ *  64-bit delays don't overflow.
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on global variable @link{RATIO_NANOSEC_MSEC}
+ *  - implicit dependency on @link{LLONG_MAX} of <limits.h>
+ *
+ *  @param {TASK_TICKS} created_ticks - creation monotonic timestamp (ns)
+ *  @param {TASK_DELAY} delay - delay time (ms)
+ *
+ *  @return {TASK_TICKS} - absolute deadline (ns)
+ *
+ *  @example
+ *    get_task_deadline_ticks(2006291136, 400) => 2406291136 (2006291136 +
+ *    400 * 10 ** 6)
+ *
+ */
+TASK_TICKS get_task_deadline_ticks(TASK_TICKS created_ticks,
+                                   TASK_DELAY delay) {
+  // the delay (ms) the deadline (ns) still fits @type{TASK_TICKS} with
+  TASK_DELAY max_delay_ms =
+      (TASK_DELAY)(LLONG_MAX - created_ticks) / RATIO_NANOSEC_MSEC;
+
+  if (delay > max_delay_ms) {
+    return LLONG_MAX;
+  }
+
+  return created_ticks + (TASK_TICKS)delay * RATIO_NANOSEC_MSEC;
+}
+
+/**
+ *  @brief Set up the delay (ms) of the task for both records ( @see{
+ *  TASK_COMPACT_TASKS} ): the deadline and (the full record) the delay and
+ *  the creation timestamp
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{ptr_task}
+ *  - implicit dependency on @callback{get_task_deadline_ticks}
+ *  - implicit dependency on @callback{get_coalesced_deadline_ticks}
+ *
+ *  @note The deadline of the task with the @link{slack} is coalesced, i.e.
+ *  up to @link{slack} ms later than created_ticks + delay
+ *
+ *  @param {Task *} ptr_task - pointer to the task
+ *  @param {TASK_DELAY} delay - delay time (ms)
+ *  @param {TASK_DELAY} slack - slack (ms) of the task, 0 => exact deadline
+ *  @param {TASK_TICKS} created_ticks - creation monotonic timestamp (ns)
+ *
+ *  @example
+ *    set_task_delay(&task, 400, 0, 2006291136) => task {
+ *      delay = 400 (the full record)
+ *      created_ticks = 2006291136 (the full record)
+ *      deadline_ticks = 2406291136
+ *    }
+ *
+ */
+void set_task_delay(Task *ptr_task, TASK_DELAY delay, TASK_DELAY slack,
+                    TASK_TICKS created_ticks) {
+#if !TASK_COMPACT_TASKS
+  ptr_task->delay = delay;
+  ptr_task->created_ticks = created_ticks;
+#endif
+  ptr_task->deadline_ticks = get_coalesced_deadline_ticks(
+      get_task_deadline_ticks(created_ticks, delay), slack);
+}
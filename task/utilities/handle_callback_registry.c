@@ -0,0 +1,161 @@
+#include <stdatomic.h>
+
+#include "../environment/config.h"
+#include "./handle_callback_registry_config.h"
+
+/**
+ *  @brief The callback registry: index => callback. Process-wide (the
+ *  callbacks are the code addresses, the same for all the scheduler
+ *  instances and threads), filled from the index 0 without gaps and never
+ *  shrinks
+ *
+ */
+static _Atomic(task_callback) registered_callbacks[TASK_CALLBACKS_MAX] = {};
+
+/**
+ *  @brief Get the index of the callback in the registry, register the
+ *  callback (the next free index) if it's not registered yet. O(quantity of
+ *  the registered callbacks), i.e. for the handful of the distinct ones
+ *
+ *  @note Lock-free: the free index is claimed via compare-and-swap, so the
+ *  threads (shards) may register the callbacks concurrently. The same
+ *  callback always gets the same index.
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer (encapsulated in the module)
+ *    @link{registered_callbacks}
+ *  - implicit dependency on global variable @link{TASK_CALLBACKS_MAX}
+ *
+ *  @param {task_callback} func_to_call - the callback
+ *
+ *  @return {PROMISE_CALLBACK_INDEX} - structure of complex type
+ *    @see{PROMISE_CALLBACK_INDEX} for details
+ *  @throw PROMISE_CALLBACK_INDEX.type = ERROR_CODE
+ *    - PROMISE_CALLBACK_INDEX.callback_registry_result.CODES_RESULT =>
+ *      - HANDLE_CALLBACK_REGISTRY_FULL - no free space for the extra callback
+ *      - HANDLE_CALLBACK_REGISTRY_NULL_CALLBACK - NULL callback is given
+ *
+ *  @example
+ *    get_callback_index(show_task_info) => {.type = SUCCESS,
+ *      .callback_registry_result.CALLBACK_INDEX = 0}
+ *    get_callback_index(show_task_info) => the same index 0
+ *
+ */
+PROMISE_CALLBACK_INDEX get_callback_index(task_callback func_to_call) {
+  if (func_to_call == NULL) {
+    return (PROMISE_CALLBACK_INDEX){.type = ERROR_CODE,
+                                    .callback_registry_result.CODES_RESULT =
+                                        HANDLE_CALLBACK_REGISTRY_NULL_CALLBACK};
+  }
+
+  for (size_t i = 0; i < TASK_CALLBACKS_MAX; i += 1) {
+    task_callback registered = atomic_load_explicit(&registered_callbacks[i],
+                                                    memory_order_acquire);
+
+    // the first gap => not registered yet, claim it (the other thread may
+    // claim it first, then check its' callback)
+    if ((registered == NULL) &&
+        atomic_compare_exchange_strong_explicit(
+            &registered_callbacks[i], &registered, func_to_call,
+            memory_order_acq_rel, memory_order_acquire)) {
+      registered = func_to_call;
+    }
+
+    if (registered == func_to_call) {
+      return (PROMISE_CALLBACK_INDEX){
+          .type = SUCCESS,
+          .callback_registry_result.CALLBACK_INDEX = (TASK_CALLBACK_INDEX)i};
+    }
+  }
+
+  return (PROMISE_CALLBACK_INDEX){.type = ERROR_CODE,
+                                  .callback_registry_result.CODES_RESULT =
+                                      HANDLE_CALLBACK_REGISTRY_FULL};
+}
+
+/**
+ *  @brief Get the callback via its' index in the registry
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the outer (encapsulated in the module)
+ *    @link{registered_callbacks}
+ *
+ *  @param {TASK_CALLBACK_INDEX} callback_index - index of the callback (
+ *    @see{get_callback_index} )
+ *
+ *  @return {task_callback} - the callback or NULL if the index is not
+ *  registered
+ *
+ */
+task_callback get_registered_callback(TASK_CALLBACK_INDEX callback_index) {
+  if (callback_index >= TASK_CALLBACKS_MAX) {
+    return NULL;
+  }
+
+  return atomic_load_explicit(&registered_callbacks[callback_index],
+                              memory_order_acquire);
+}
+
+/**
+ *  @brief Get the callback of the task for both records ( @see{
+ *  TASK_COMPACT_TASKS} ): the pointer itself or the registered one via
+ *  Task.callback_index
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on @callback{get_registered_callback} (the compact
+ *    record)
+ *
+ *  @param {const Task *} ptr_task - pointer to the task
+ *
+ *  @return {task_callback} - the callback of the task
+ *
+ *  @example
+ *    PROMISE_TASK log_task = get_callback();
+ *    get_task_callback(&log_task.get_callback_result.TASK)(
+ *        log_task.get_callback_result.TASK.func_arg);
+ *
+ */
+task_callback get_task_callback(const Task *ptr_task) {
+#if TASK_COMPACT_TASKS
+  return get_registered_callback(ptr_task->callback_index);
+#else
+  return ptr_task->callback;
+#endif
+}
+
+/**
+ *  @brief Set up the callback of the task for both records ( @see{
+ *  TASK_COMPACT_TASKS} ): the pointer itself or its' registry index
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{ptr_task}
+ *  - implicit dependency on @callback{get_callback_index} (the compact
+ *    record)
+ *
+ *  @param {Task *} ptr_task - pointer to the task
+ *  @param {task_callback} func_to_call - the callback
+ *
+ *  @return {enum Handle_callback_registry_errors_codes} -
+ *  HANDLE_CALLBACK_REGISTRY_DONE_SUCCESSFULLY
+ *  @throw HANDLE_CALLBACK_REGISTRY_FULL - no free space for the extra
+ *  callback (the compact record)
+ *  @throw HANDLE_CALLBACK_REGISTRY_NULL_CALLBACK - NULL callback is given (the
+ *  compact record)
+ *
+ */
+enum Handle_callback_registry_errors_codes
+set_task_callback(Task *ptr_task, task_callback func_to_call) {
+#if TASK_COMPACT_TASKS
+  PROMISE_CALLBACK_INDEX log_index = get_callback_index(func_to_call);
+
+  if (log_index.type == ERROR_CODE) {
+    return log_index.callback_registry_result.CODES_RESULT;
+  }
+
+  ptr_task->callback_index = log_index.callback_registry_result.CALLBACK_INDEX;
+#else
+  ptr_task->callback = func_to_call;
+#endif
+
+  return HANDLE_CALLBACK_REGISTRY_DONE_SUCCESSFULLY;
+}
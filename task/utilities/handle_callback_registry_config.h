@@ -0,0 +1,76 @@
+#ifndef HANDLE_CALLBACK_REGISTRY_H
+#define HANDLE_CALLBACK_REGISTRY_H
+
+#include "../environment/config.h"
+
+/**
+ *  @details
+ *  - HANDLE_CALLBACK_REGISTRY_DONE_SUCCESSFULLY - no errors, done
+ *    successfully
+ *  - HANDLE_CALLBACK_REGISTRY_FULL - no free space for the extra callback (
+ *    @see{TASK_CALLBACKS_MAX} )
+ *  - HANDLE_CALLBACK_REGISTRY_NULL_CALLBACK - NULL callback is given
+ *
+ */
+enum Handle_callback_registry_errors_codes {
+  HANDLE_CALLBACK_REGISTRY_DONE_SUCCESSFULLY =
+      0, /**< no errors, done successfully */
+  HANDLE_CALLBACK_REGISTRY_FULL =
+      1, /**< no free space for the extra callback */
+  HANDLE_CALLBACK_REGISTRY_NULL_CALLBACK = 2, /**< NULL callback is given */
+};
+
+/**
+ *  @details
+ *  Union for handling results of @link{get_callback_index} function
+ *  execution. Possible values @note only one of is possible!:
+ *  - CALLBACK_INDEX - index of the callback in the registry
+ *  - CODES_RESULT - Error codes at the process of the callback registering
+ *
+ */
+union Union_callback_index {
+  TASK_CALLBACK_INDEX CALLBACK_INDEX; /**< index of the callback */
+  enum Handle_callback_registry_errors_codes
+      CODES_RESULT; /**< Error codes at the process of the registering */
+};
+
+/**
+ *  @details
+ *  Structure for handling results of @link{get_callback_index} function
+ *  execution.
+ *  - type - (SUCCESS | ERROR_CODE)
+ *  - callback_registry_result - union @link{union Union_callback_index},
+ *    that is @type{TASK_CALLBACK_INDEX} for CALLBACK_INDEX (SUCCESS,
+ *    everything is OK) or one of error codes for ERROR_CODE
+ *
+ *  @example
+ *    PROMISE_CALLBACK_INDEX log_index = get_callback_index(show_task_info);
+ *
+ *    switch (log_index.type) {
+ *    case SUCCESS:
+ *      printf("%hu\n", log_index.callback_registry_result.CALLBACK_INDEX);
+ *      OUTPUT: e.g. 0 (the first registered callback)
+ *      break;
+ *    case ERROR_CODE:
+ *      printf("ERROR_CODE: %hd\n",
+ *        log_index.callback_registry_result.CODES_RESULT);
+ *      OUTPUT: e.g. HANDLE_CALLBACK_REGISTRY_FULL
+ *      break;
+ *    default:
+ *      break;
+ *    }
+ *
+ */
+typedef struct s_Callback_registry_result {
+  PROMISE_TYPE type; /**< SUCCESS | ERROR_CODE */
+  union Union_callback_index
+      callback_registry_result; /**< CALLBACK_INDEX | CODES_RESULT */
+} PROMISE_CALLBACK_INDEX;
+
+PROMISE_CALLBACK_INDEX get_callback_index(task_callback func_to_call);
+task_callback get_registered_callback(TASK_CALLBACK_INDEX callback_index);
+task_callback get_task_callback(const Task *ptr_task);
+enum Handle_callback_registry_errors_codes
+set_task_callback(Task *ptr_task, task_callback func_to_call);
+
+#endif
@@ -0,0 +1,221 @@
+// POSIX declarations (clock_gettime, CLOCK_MONOTONIC) for the strict
+// -std=c23 builds, otherwise the wall-clock fallback is compiled in
+#define _POSIX_C_SOURCE 200809L
+
+#include "../environment/config.h"
+#include "../environment/global_variables.h"
+#include "./handle_clock_config.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+#if defined(_WIN32)
+static TASK_SHARD_LOCAL long long counter_frequency =
+    0; /**< QueryPerformanceFrequency */
+#endif
+
+/**
+ *  @brief Utility function (encapsulated) to read the monotonic clock
+ *
+ *  @note The monotonic clock doesn't jump on the wall-clock (NTP, manual)
+ *  corrections, so the deadlines are never moved. Sources by priority:
+ *  - QueryPerformanceCounter (Windows, TSC based, the frequency is read once)
+ *  - clock_gettime(CLOCK_MONOTONIC) (POSIX, vDSO => no syscall on Linux)
+ *  - timespec_get(TIME_MONOTONIC) (C23, optional)
+ *  - timespec_get(TIME_UTC) (fallback, wall-clock)
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer (encapsulated in the module) @link{counter_frequency}
+ *    (Windows only)
+ *
+ *  @param {TASK_TICKS *} ptr_ticks - pointer to save the timestamp (ns) to
+ *
+ *  @return {bool} - true if the clock was read successfully
+ *
+ */
+static bool read_monotonic_clock(TASK_TICKS *ptr_ticks) {
+#if defined(_WIN32)
+  LARGE_INTEGER counter = {};
+
+  if (counter_frequency == 0) {
+    LARGE_INTEGER frequency = {};
+
+    if (!QueryPerformanceFrequency(&frequency)) {
+      return false;
+    }
+    counter_frequency = frequency.QuadPart;
+  }
+
+  if (!QueryPerformanceCounter(&counter)) {
+    return false;
+  }
+
+  // split to prevent the overflow of (counter * 10 ** 9)
+  *ptr_ticks =
+      counter.QuadPart / counter_frequency * RATIO_SEC_NANOSEC +
+      counter.QuadPart % counter_frequency * RATIO_SEC_NANOSEC /
+          counter_frequency;
+
+  return true;
+#else
+  struct timespec ts = {};
+
+#if defined(CLOCK_MONOTONIC)
+  if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0) {
+    return false;
+  }
+#elif defined(TIME_MONOTONIC)
+  if (timespec_get(&ts, TIME_MONOTONIC) == 0) {
+    return false;
+  }
+#else
+  if (timespec_get(&ts, TIME_UTC) == 0) {
+    return false;
+  }
+#endif
+
+  // integer arithmetic only (no float round())
+  *ptr_ticks = (TASK_TICKS)ts.tv_sec * RATIO_SEC_NANOSEC + ts.tv_nsec;
+
+  return true;
+#endif
+}
+
+/**
+ *  @brief Get the current monotonic timestamp (ns). Inside the opened tick
+ *  of the scheduler ( @see{begin_clock_tick_in} ) returns the cached value
+ *  without the clock reading
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{clock} of the @link{ptr_scheduler} (
+ *    @see{CLOCK_TICK} )
+ *
+ *  @param {const Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {PROMISE_CLOCK_TICKS} - structure of complex type
+ *    @see{PROMISE_CLOCK_TICKS} for details
+ *  @throw PROMISE_CLOCK_TICKS.type = ERROR_CODE
+ *    - PROMISE_CLOCK_TICKS.handle_clock_result.CODES_RESULT =>
+ *      HANDLE_CLOCK_GET_ERROR - problems occured at the clock reading
+ *
+ */
+PROMISE_CLOCK_TICKS get_now_ticks_in(const Scheduler *ptr_scheduler) {
+  if (ptr_scheduler->clock.is_tick_opened) {
+    return (PROMISE_CLOCK_TICKS){.type = SUCCESS,
+                                 .handle_clock_result.TICKS =
+                                     ptr_scheduler->clock.cached_now_ticks};
+  }
+
+  TASK_TICKS now_ticks = 0;
+
+  if (!read_monotonic_clock(&now_ticks)) {
+    return (PROMISE_CLOCK_TICKS){.type = ERROR_CODE,
+                                 .handle_clock_result.CODES_RESULT =
+                                     HANDLE_CLOCK_GET_ERROR};
+  }
+
+  return (PROMISE_CLOCK_TICKS){.type = SUCCESS,
+                               .handle_clock_result.TICKS = now_ticks};
+}
+
+/**
+ *  @brief Get the current monotonic timestamp (ns) of the default scheduler
+ *  instance ( @see{get_now_ticks_in} )
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{get_now_ticks_in} ones
+ *
+ *  @param {void} - no params expected
+ *
+ *  @return {PROMISE_CLOCK_TICKS} - the same as @link{get_now_ticks_in} one
+ *
+ */
+PROMISE_CLOCK_TICKS get_now_ticks(void) {
+  return get_now_ticks_in(&default_scheduler);
+}
+
+/**
+ *  @brief Open the tick of the scheduler: read the clock once and serve the
+ *  cached value to all its' operations till @link{end_clock_tick_in}, so a
+ *  batch of operations costs one clock reading
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{clock} of the @link{ptr_scheduler} (
+ *    @see{CLOCK_TICK} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {PROMISE_CLOCK_TICKS} - structure of complex type (the cached
+ *    timestamp) @see{PROMISE_CLOCK_TICKS} for details
+ *  @throw PROMISE_CLOCK_TICKS.type = ERROR_CODE
+ *    - PROMISE_CLOCK_TICKS.handle_clock_result.CODES_RESULT =>
+ *      HANDLE_CLOCK_GET_ERROR - problems occured at the clock reading (the
+ *      tick is not opened)
+ *
+ *  @example
+ *    begin_clock_tick();
+ *    register_task(show_task_info, 1, 400); => no clock reading
+ *    register_task(show_task_info, 2, 400); => no clock reading
+ *    end_clock_tick();
+ *
+ */
+PROMISE_CLOCK_TICKS begin_clock_tick_in(Scheduler *ptr_scheduler) {
+  // reopen => refresh the cached value
+  ptr_scheduler->clock.is_tick_opened = false;
+
+  PROMISE_CLOCK_TICKS log_ticks = get_now_ticks_in(ptr_scheduler);
+
+  if (log_ticks.type == SUCCESS) {
+    ptr_scheduler->clock.cached_now_ticks =
+        log_ticks.handle_clock_result.TICKS;
+    ptr_scheduler->clock.is_tick_opened = true;
+  }
+
+  return log_ticks;
+}
+
+/**
+ *  @brief Open the tick of the default scheduler instance (
+ *  @see{begin_clock_tick_in} )
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{begin_clock_tick_in} ones
+ *
+ *  @param {void} - no params expected
+ *
+ *  @return {PROMISE_CLOCK_TICKS} - the same as @link{begin_clock_tick_in} one
+ *
+ */
+PROMISE_CLOCK_TICKS begin_clock_tick(void) {
+  return begin_clock_tick_in(&default_scheduler);
+}
+
+/**
+ *  @brief Close the tick of the scheduler: the next @link{get_now_ticks_in}
+ *  calls read the clock again
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{clock} of the @link{ptr_scheduler} (
+ *    @see{CLOCK_TICK} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ */
+void end_clock_tick_in(Scheduler *ptr_scheduler) {
+  ptr_scheduler->clock.is_tick_opened = false;
+}
+
+/**
+ *  @brief Close the tick of the default scheduler instance (
+ *  @see{end_clock_tick_in} )
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{end_clock_tick_in} ones
+ *
+ *  @param {void} - no params expected
+ *
+ */
+void end_clock_tick(void) {
+  end_clock_tick_in(&default_scheduler);
+}
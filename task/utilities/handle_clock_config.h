@@ -0,0 +1,89 @@
+#ifndef HANDLE_CLOCK_H
+#define HANDLE_CLOCK_H
+
+#include "../environment/config.h"
+
+/**
+ *  @details
+ *  - HANDLE_CLOCK_DONE_SUCCESSFULLY - no errors, done successfully
+ *  - HANDLE_CLOCK_GET_ERROR - problems occured at the monotonic clock reading
+ *
+ */
+enum Handle_clock_errors_codes {
+  HANDLE_CLOCK_DONE_SUCCESSFULLY = 0, /**< no errors, done successfully */
+  HANDLE_CLOCK_GET_ERROR = 1, /**< problems occured at the clock reading */
+};
+
+/**
+ *  @details
+ *  Union for handling results of @link{get_now_ticks} or
+ *  @link{begin_clock_tick} functions execution. Possible values
+ *  @note only one of is possible!:
+ *  - TICKS - current monotonic timestamp (ns)
+ *  - CODES_RESULT - Error codes at the process of clock reading
+ *
+ */
+union Union_clock_ticks {
+  TASK_TICKS TICKS; /**< current monotonic timestamp (ns) */
+  enum Handle_clock_errors_codes
+      CODES_RESULT; /**< Error codes at the process of clock reading */
+};
+
+/**
+ *  @details
+ *  Structure for handling results of @link{get_now_ticks} or
+ *  @link{begin_clock_tick} function execution.
+ *  - type - (SUCCESS | ERROR_CODE)
+ *  - handle_clock_result - union @link{union Union_clock_ticks}, that is
+ *    @type{TASK_TICKS} for TICKS (SUCCESS, everything is OK)
+ *    or
+ *    HANDLE_CLOCK_GET_ERROR for ERROR_CODE
+ *
+ *  @example
+ *    PROMISE_CLOCK_TICKS log_ticks = get_now_ticks();
+ *    TASK_TICKS now = 0;
+ *
+ *    switch (log_ticks.type) {
+ *    case SUCCESS:
+ *      now = log_ticks.handle_clock_result.TICKS;
+ *      OUTPUT: e.g. 5025004081 (~5 s since the system boot)
+ *      break;
+ *    case ERROR_CODE:
+ *      printf("ERROR_CODE: %hd\n",
+ *        log_ticks.handle_clock_result.CODES_RESULT);
+ *      OUTPUT: e.g. HANDLE_CLOCK_GET_ERROR
+ *      break;
+ *    default:
+ *      fprintf(stderr, "Error(%s() function at %d): ups... Unknown
+ *        log_ticks.type\n", __func__, __LINE__);
+ *      break;
+ *    }
+ *
+ */
+typedef struct s_Handle_clock_result {
+  PROMISE_TYPE type;                          /**< SUCCESS | ERROR_CODE */
+  union Union_clock_ticks handle_clock_result; /**< TICKS | CODES_RESULT */
+} PROMISE_CLOCK_TICKS;
+
+/**
+ *  @details
+ *  The clock tick of the scheduler instance ( @see{Scheduler},
+ *  @see{begin_clock_tick} )
+ *  - TASK_TICKS cached_now_ticks - the timestamp (ns) read at the tick's
+ *    opening
+ *  - bool is_tick_opened - the operations use @link{cached_now_ticks}
+ *
+ */
+typedef struct s_Clock_tick {
+  TASK_TICKS cached_now_ticks; /**< the timestamp (ns) of the opened tick */
+  bool is_tick_opened;         /**< the cached timestamp is used */
+} CLOCK_TICK;
+
+PROMISE_CLOCK_TICKS get_now_ticks_in(const Scheduler *ptr_scheduler);
+PROMISE_CLOCK_TICKS get_now_ticks(void);
+PROMISE_CLOCK_TICKS begin_clock_tick_in(Scheduler *ptr_scheduler);
+PROMISE_CLOCK_TICKS begin_clock_tick(void);
+void end_clock_tick_in(Scheduler *ptr_scheduler);
+void end_clock_tick(void);
+
+#endif
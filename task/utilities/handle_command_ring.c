@@ -0,0 +1,313 @@
+#include <limits.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+#include "../environment/config.h"
+#include "../environment/global_variables.h"
+#include "./handle_command_ring_config.h"
+#include "./handle_wait_config.h"
+
+enum Handle_command_ring_variables {
+  COMMAND_RING_MASK = TASK_COMMAND_RING_CAPACITY - 1, /**< pos => cell */
+};
+
+/**
+ *  @brief Utility function (encapsulated) to push the command to the ring of
+ *  the scheduler (lock-free, multi-producer) and wake up its' dispatcher if
+ *  the ring was empty ( @see{notify_new_deadline_in} )
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{ring_tail} and @link{command_cells} of the
+ *    @link{ptr_scheduler}'s ring ( @see{COMMAND_RING} )
+ *  - implicit dependency on the @link{ring_head} of the ring
+ *  - implicit dependency on @callback{notify_new_deadline_in}
+ *
+ *  @note One CAS per claim (retried only under the producers' contention),
+ *  the cell is published via its' sequence, so the consumer never reads a
+ *  half written command. The dispatcher is woken up only for the first
+ *  command of the batch (the rest are applied within the same wake up)
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COMMAND} command - the command to submit
+ *
+ *  @return {enum Handle_command_ring_errors_codes} -
+ *  HANDLE_COMMAND_RING_DONE_SUCCESSFULLY
+ *  @throw HANDLE_COMMAND_RING_IS_FULL - no free cells
+ *
+ */
+static enum Handle_command_ring_errors_codes
+push_task_command(Scheduler *ptr_scheduler, TASK_COMMAND command) {
+  COMMAND_RING *ptr_ring = &ptr_scheduler->commands;
+  size_t pos = atomic_load_explicit(&ptr_ring->ring_tail, memory_order_relaxed);
+  COMMAND_CELL *ptr_cell = NULL;
+
+  while (true) {
+    ptr_cell = &ptr_ring->command_cells[pos & COMMAND_RING_MASK];
+    size_t sequence =
+        atomic_load_explicit(&ptr_cell->sequence, memory_order_acquire);
+    intptr_t difference =
+        (intptr_t)sequence - (intptr_t)(pos & ~(size_t)COMMAND_RING_MASK);
+
+    if (difference == 0) {
+      // the cell is free => claim the pos (pos is reloaded on failure)
+      if (atomic_compare_exchange_weak_explicit(
+              &ptr_ring->ring_tail, &pos, pos + 1, memory_order_relaxed,
+              memory_order_relaxed)) {
+        break;
+      }
+    } else if (difference < 0) {
+      // the cell of the previous lap isn't applied yet => the ring is full
+      notify_new_deadline_in(ptr_scheduler, LLONG_MIN + 1);
+
+      return HANDLE_COMMAND_RING_IS_FULL;
+    } else {
+      // the other producer has claimed the pos
+      pos = atomic_load_explicit(&ptr_ring->ring_tail, memory_order_relaxed);
+    }
+  }
+
+  ptr_cell->command = command;
+  atomic_store_explicit(&ptr_cell->sequence,
+                        (pos & ~(size_t)COMMAND_RING_MASK) + 1,
+                        memory_order_release);
+
+  // publish before checking the dispatcher's state (pairs with the check of
+  // @link{is_task_command_pending} in @link{wait_next_deadline_in})
+  atomic_thread_fence(memory_order_seq_cst);
+
+  if (atomic_load_explicit(&ptr_ring->ring_head, memory_order_relaxed) ==
+      pos) {
+    notify_new_deadline_in(ptr_scheduler, LLONG_MIN + 1);
+  }
+
+  return HANDLE_COMMAND_RING_DONE_SUCCESSFULLY;
+}
+
+/**
+ *  @brief Submit the task registering to the dispatcher thread of the
+ *  scheduler (the one that owns the queue and calls
+ *  @link{apply_task_commands_in}) from any thread without locks
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on @callback{push_task_command}
+ *
+ *  @note The handle is known only after the dispatcher applies the command:
+ *  it stores it to @link{ptr_handle} (TASK_COMMAND_HANDLE_PENDING till then,
+ *  TASK_COMMAND_HANDLE_FAILED if register_task fails). The commands of one
+ *  thread are applied in the submitting order.
+ *  @note Every scheduler instance has its' own ring, so the command wakes up
+ *  the waiter of the given instance only. In the sharded mode (
+ *  @see{TASK_SHARDED} ) submit to the dispatcher's shard via its' pointer
+ *  (e.g. &default_scheduler taken on the dispatcher thread).
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {task_callback} func_to_call - callback to call after delay time
+ *  @param {unsigned short} arg - argument of the @link{func_to_call}
+ *  @param {TASK_DELAY} delay - delay time (ms)
+ *  @param {_Atomic TASK_HANDLE *} ptr_handle - where to store the handle,
+ *    NULL => not needed
+ *
+ *  @return {enum Handle_command_ring_errors_codes} -
+ *  HANDLE_COMMAND_RING_DONE_SUCCESSFULLY
+ *  @throw HANDLE_COMMAND_RING_IS_FULL - no free cells (submit it again later)
+ *
+ *  @example
+ *    _Atomic TASK_HANDLE task_id = TASK_COMMAND_HANDLE_PENDING;
+ *
+ *    if (submit_register_task_in(&scheduler, show_task_info, 1, 400,
+ *                                &task_id) == HANDLE_COMMAND_RING_IS_FULL) {
+ *      ...retry later...
+ *    }
+ *    ...
+ *    if (atomic_load(&task_id) < TASK_COMMAND_HANDLE_FAILED) {
+ *      submit_remove_task_in(&scheduler, atomic_load(&task_id));
+ *    }
+ *
+ */
+enum Handle_command_ring_errors_codes
+submit_register_task_in(Scheduler *ptr_scheduler, task_callback func_to_call,
+                        unsigned short arg, TASK_DELAY delay,
+                        _Atomic TASK_HANDLE *ptr_handle) {
+  if (ptr_handle != NULL) {
+    atomic_store_explicit(ptr_handle, TASK_COMMAND_HANDLE_PENDING,
+                          memory_order_relaxed);
+  }
+
+  return push_task_command(ptr_scheduler,
+                           (TASK_COMMAND){.type = TASK_COMMAND_REGISTER,
+                                          .callback = func_to_call,
+                                          .func_arg = arg,
+                                          .delay = delay,
+                                          .ptr_handle = ptr_handle});
+}
+
+/**
+ *  @brief Submit the task registering to the default scheduler instance (
+ *  @see{submit_register_task_in} )
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{submit_register_task_in} ones
+ *
+ *  @param {task_callback} func_to_call - callback to call after delay time
+ *  @param {unsigned short} arg - argument of the @link{func_to_call}
+ *  @param {TASK_DELAY} delay - delay time (ms)
+ *  @param {_Atomic TASK_HANDLE *} ptr_handle - where to store the handle,
+ *    NULL => not needed
+ *
+ *  @return {enum Handle_command_ring_errors_codes} - the same as
+ *  @link{submit_register_task_in} one
+ *
+ */
+enum Handle_command_ring_errors_codes
+submit_register_task(task_callback func_to_call, unsigned short arg,
+                     TASK_DELAY delay, _Atomic TASK_HANDLE *ptr_handle) {
+  return submit_register_task_in(&default_scheduler, func_to_call, arg, delay,
+                                 ptr_handle);
+}
+
+/**
+ *  @brief Submit the task removing to the dispatcher thread of the scheduler
+ *  from any thread without locks ( @see{submit_register_task_in} )
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on @callback{push_task_command}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_HANDLE} id - handle of the task to remove
+ *
+ *  @return {enum Handle_command_ring_errors_codes} -
+ *  HANDLE_COMMAND_RING_DONE_SUCCESSFULLY
+ *  @throw HANDLE_COMMAND_RING_IS_FULL - no free cells (submit it again later)
+ *
+ */
+enum Handle_command_ring_errors_codes
+submit_remove_task_in(Scheduler *ptr_scheduler, TASK_HANDLE id) {
+  return push_task_command(
+      ptr_scheduler, (TASK_COMMAND){.type = TASK_COMMAND_REMOVE, .id = id});
+}
+
+/**
+ *  @brief Submit the task removing to the default scheduler instance (
+ *  @see{submit_remove_task_in} )
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{submit_remove_task_in} ones
+ *
+ *  @param {TASK_HANDLE} id - handle of the task to remove
+ *
+ *  @return {enum Handle_command_ring_errors_codes} - the same as
+ *  @link{submit_remove_task_in} one
+ *
+ */
+enum Handle_command_ring_errors_codes submit_remove_task(TASK_HANDLE id) {
+  return submit_remove_task_in(&default_scheduler, id);
+}
+
+/**
+ *  @brief Submit the task's delay changing to the dispatcher thread of the
+ *  scheduler from any thread without locks ( @see{submit_register_task_in} )
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on @callback{push_task_command}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_HANDLE} id - handle of the task
+ *  @param {TASK_DELAY} new_delay - new delay time (ms) since the task's
+ *    creating
+ *
+ *  @return {enum Handle_command_ring_errors_codes} -
+ *  HANDLE_COMMAND_RING_DONE_SUCCESSFULLY
+ *  @throw HANDLE_COMMAND_RING_IS_FULL - no free cells (submit it again later)
+ *
+ */
+enum Handle_command_ring_errors_codes
+submit_change_task_delay_in(Scheduler *ptr_scheduler, TASK_HANDLE id,
+                            TASK_DELAY new_delay) {
+  return push_task_command(ptr_scheduler,
+                           (TASK_COMMAND){.type = TASK_COMMAND_CHANGE_DELAY,
+                                          .id = id,
+                                          .delay = new_delay});
+}
+
+/**
+ *  @brief Submit the task's delay changing to the default scheduler instance
+ *  ( @see{submit_change_task_delay_in} )
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{submit_change_task_delay_in} ones
+ *
+ *  @param {TASK_HANDLE} id - handle of the task
+ *  @param {TASK_DELAY} new_delay - new delay time (ms) since the task's
+ *    creating
+ *
+ *  @return {enum Handle_command_ring_errors_codes} - the same as
+ *  @link{submit_change_task_delay_in} one
+ *
+ */
+enum Handle_command_ring_errors_codes
+submit_change_task_delay(TASK_HANDLE id, TASK_DELAY new_delay) {
+  return submit_change_task_delay_in(&default_scheduler, id, new_delay);
+}
+
+/**
+ *  @brief Pop the oldest submitted command of the scheduler. The dispatcher
+ *  thread only (the single consumer), @see{apply_task_commands_in}
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{ring_head} and @link{command_cells} of the
+ *    @link{ptr_scheduler}'s ring ( @see{COMMAND_RING} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COMMAND *} ptr_command - where to copy the command
+ *
+ *  @return {enum Handle_command_ring_errors_codes} -
+ *  HANDLE_COMMAND_RING_DONE_SUCCESSFULLY
+ *  @throw HANDLE_COMMAND_RING_IS_EMPTY - no commands (or the oldest one is
+ *    claimed but not written yet)
+ *
+ */
+enum Handle_command_ring_errors_codes
+pop_task_command(Scheduler *ptr_scheduler, TASK_COMMAND *ptr_command) {
+  COMMAND_RING *ptr_ring = &ptr_scheduler->commands;
+  size_t pos = atomic_load_explicit(&ptr_ring->ring_head, memory_order_relaxed);
+  COMMAND_CELL *ptr_cell = &ptr_ring->command_cells[pos & COMMAND_RING_MASK];
+  size_t lap = pos & ~(size_t)COMMAND_RING_MASK;
+
+  if (atomic_load_explicit(&ptr_cell->sequence, memory_order_acquire) !=
+      lap + 1) {
+    return HANDLE_COMMAND_RING_IS_EMPTY;
+  }
+
+  *ptr_command = ptr_cell->command;
+
+  // free the cell for the producer of the next lap
+  atomic_store_explicit(&ptr_cell->sequence, lap + TASK_COMMAND_RING_CAPACITY,
+                        memory_order_release);
+  atomic_store_explicit(&ptr_ring->ring_head, pos + 1, memory_order_relaxed);
+
+  return HANDLE_COMMAND_RING_DONE_SUCCESSFULLY;
+}
+
+/**
+ *  @brief Check (the dispatcher thread only) if there are the submitted
+ *  commands of the scheduler to apply, e.g. before the sleep (
+ *  @see{wait_next_deadline_in} )
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{ring_head} and @link{command_cells} of
+ *    the @link{ptr_scheduler}'s ring ( @see{COMMAND_RING} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {bool} - true => the oldest command is published
+ *
+ */
+bool is_task_command_pending(Scheduler *ptr_scheduler) {
+  COMMAND_RING *ptr_ring = &ptr_scheduler->commands;
+  size_t pos = atomic_load_explicit(&ptr_ring->ring_head, memory_order_relaxed);
+  size_t lap = pos & ~(size_t)COMMAND_RING_MASK;
+
+  return atomic_load(
+             &ptr_ring->command_cells[pos & COMMAND_RING_MASK].sequence) ==
+         lap + 1;
+}
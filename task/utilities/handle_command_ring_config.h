@@ -0,0 +1,132 @@
+#ifndef HANDLE_COMMAND_RING_CONFIG_H
+#define HANDLE_COMMAND_RING_CONFIG_H
+
+#include "../environment/config.h"
+
+/**
+ *  @details
+ *  Sentinel values of the handle the dispatcher stores for the submitted
+ *  register command ( @see{submit_register_task_in} )
+ *  - TASK_COMMAND_HANDLE_PENDING - the command isn't applied yet
+ *  - TASK_COMMAND_HANDLE_FAILED - register_task failed at the dispatcher
+ *    (e.g. the queue is full)
+ *
+ */
+#define TASK_COMMAND_HANDLE_PENDING 0xFFFF'FFFF'FFFF'FFFFULL
+#define TASK_COMMAND_HANDLE_FAILED 0xFFFF'FFFF'FFFF'FFFEULL
+
+/**
+ *  @details
+ *  - HANDLE_COMMAND_RING_DONE_SUCCESSFULLY - no errors, done successfully
+ *  - HANDLE_COMMAND_RING_IS_FULL - no free cells, the dispatcher is woken up
+ *    to drain the ring (submit the command again later)
+ *  - HANDLE_COMMAND_RING_IS_EMPTY - no commands to apply
+ *
+ */
+enum Handle_command_ring_errors_codes {
+  HANDLE_COMMAND_RING_DONE_SUCCESSFULLY = 0, /**< no errors */
+  HANDLE_COMMAND_RING_IS_FULL = 1,           /**< no free cells */
+  HANDLE_COMMAND_RING_IS_EMPTY = 2,          /**< no commands to apply */
+};
+
+/**
+ *  @details
+ *  Types of the commands
+ *  - TASK_COMMAND_REGISTER - @see{register_task_ex}
+ *  - TASK_COMMAND_REMOVE - @see{remove_task}
+ *  - TASK_COMMAND_CHANGE_DELAY - @see{change_task_delay_ex}
+ *
+ */
+typedef enum {
+  TASK_COMMAND_REGISTER = 0,     /**< register_task_ex */
+  TASK_COMMAND_REMOVE = 1,       /**< remove_task */
+  TASK_COMMAND_CHANGE_DELAY = 2, /**< change_task_delay_ex */
+} TASK_COMMAND_TYPE;
+
+/**
+ *  @details
+ *  The command submitted to the dispatcher thread
+ *  - type - @see{TASK_COMMAND_TYPE}
+ *  - callback - callback of the registered task (REGISTER)
+ *  - func_arg - argument of the @link{callback} (REGISTER)
+ *  - delay - delay (ms) of the registered task or the new delay (REGISTER,
+ *    CHANGE_DELAY)
+ *  - id - handle of the task (REMOVE, CHANGE_DELAY)
+ *  - ptr_handle - where to store the handle of the registered task, NULL =>
+ *    not needed (REGISTER)
+ *
+ */
+typedef struct s_Task_command {
+  TASK_COMMAND_TYPE type;          /**< REGISTER | REMOVE | CHANGE_DELAY */
+  unsigned short func_arg;         /**< argument of the @link{callback} */
+  task_callback callback;          /**< callback of the registered task */
+  TASK_DELAY delay;                /**< delay (ms) or the new delay */
+  TASK_HANDLE id;                  /**< handle of the task */
+  _Atomic TASK_HANDLE *ptr_handle; /**< the registered task's handle */
+} TASK_COMMAND;
+
+/**
+ *  @details
+ *  Report of the @link{apply_task_commands_in} call
+ *  - APPLIED_COUNT - quantity of the applied commands
+ *  - FAILED_COUNT - quantity of the applied commands that failed (e.g. the
+ *    stale handle of the remove / change delay command, the full queue)
+ *
+ */
+typedef struct s_Task_commands_report {
+  size_t APPLIED_COUNT; /**< quantity of the applied commands */
+  size_t FAILED_COUNT;  /**< quantity of the failed ones */
+} TASK_COMMANDS_REPORT;
+
+/**
+ *  @details
+ *  The cell of the ring
+ *  - sequence - lap of the cell's position (pos & ~COMMAND_RING_MASK) when
+ *    the cell is free for the producer of the pos, + 1 when the command of
+ *    the pos is published for the consumer (zero initialized => all the cells
+ *    are free for the first lap)
+ *  - command - @see{TASK_COMMAND}
+ *
+ */
+typedef struct s_Command_cell {
+  _Atomic size_t sequence; /**< lap of the pos (+ 1 => published) */
+  TASK_COMMAND command;    /**< the submitted command */
+} COMMAND_CELL;
+
+/**
+ *  @details
+ *  The command ring of the scheduler instance ( @see{Scheduler},
+ *  @see{submit_register_task_in} ), zero initialized => empty
+ *  - ring_tail - next pos to claim (the producers)
+ *  - ring_head - next pos to apply (the consumer)
+ *  - command_cells - the cells of the ring
+ *
+ *  @note the producers and the consumer indexes on the separate cache lines
+ *
+ */
+typedef struct s_Command_ring {
+  _Alignas(64) _Atomic size_t ring_tail; /**< next pos to claim */
+  _Alignas(64) _Atomic size_t ring_head; /**< next pos to apply */
+  COMMAND_CELL command_cells[TASK_COMMAND_RING_CAPACITY]; /**< the cells */
+} COMMAND_RING;
+
+enum Handle_command_ring_errors_codes
+submit_register_task_in(Scheduler *ptr_scheduler, task_callback func_to_call,
+                        unsigned short arg, TASK_DELAY delay,
+                        _Atomic TASK_HANDLE *ptr_handle);
+enum Handle_command_ring_errors_codes
+submit_register_task(task_callback func_to_call, unsigned short arg,
+                     TASK_DELAY delay, _Atomic TASK_HANDLE *ptr_handle);
+enum Handle_command_ring_errors_codes
+submit_remove_task_in(Scheduler *ptr_scheduler, TASK_HANDLE id);
+enum Handle_command_ring_errors_codes submit_remove_task(TASK_HANDLE id);
+enum Handle_command_ring_errors_codes
+submit_change_task_delay_in(Scheduler *ptr_scheduler, TASK_HANDLE id,
+                            TASK_DELAY new_delay);
+enum Handle_command_ring_errors_codes
+submit_change_task_delay(TASK_HANDLE id, TASK_DELAY new_delay);
+enum Handle_command_ring_errors_codes
+pop_task_command(Scheduler *ptr_scheduler, TASK_COMMAND *ptr_command);
+bool is_task_command_pending(Scheduler *ptr_scheduler);
+
+#endif
@@ -1,26 +1,26 @@
 #include "../environment/config.h"
-#include "./handle_id_config.h"
 
-static ID_LIST_ELEM id_storage_array[MAX_TASK_QUANTITY] = {0};
-static bool is_first_call = true;
-ID_LIST_ELEM *ptr_free_elem = NULL;
+#if TASK_ID_ALLOCATOR == TASK_ID_ALLOCATOR_FREE_LIST
+
+#include "../environment/scheduler_config.h"
+#include "./handle_id_config.h"
 
 /**
  *  @brief Utility function (encapsiulated) to initialize the Pointer-Based
  *  Linked List (array based)
  *
  *  @note ! Impure function !
- *  - mutates the outer (encapsulated in the module) @link{id_storage_array}
- *  - mutates the outer (encapsulated in the module) @link{is_first_call}
- *  - mutates the outer (encapsulated in the module) @link{ptr_free_elem}
+ *  - mutates the outer @link{id_storage_array} of the @link{ptr_ids}
+ *  - mutates the outer @link{is_initialized} of the @link{ptr_ids}
+ *  - mutates the outer @link{ptr_free_elem} of the @link{ptr_ids}
  *
- *  @param {void} - no params expected
+ *  @param {ID_STORAGE *} ptr_ids - the id storage of the scheduler
  *
  *  @example
  *    *** predefined ***
  *    MAX_TASK_QUANTITY = 3
  *    *** usage ***
- *    just run init_id_storage_array() => void
+ *    just run init_id_storage_array(ptr_ids) => void
  *    id_storage_array[]{
  *      ID_LIST_ELEM{
  *        id = 0
@@ -46,17 +46,19 @@ ID_LIST_ELEM *ptr_free_elem = NULL;
  *        next->NULL
  *      },
  *    }
- *    is_first_call = false
+ *    is_initialized = true
  *    ptr_free_elem = &id_storage_array[0]
  *
  */
-static void init_id_storage_array(void) {
+static void init_id_storage_array(ID_STORAGE *ptr_ids) {
   // prevent multiple initializing
   // not first call ? => return
-  if (!is_first_call) {
+  if (ptr_ids->is_initialized) {
     return;
   }
 
+  ID_LIST_ELEM *id_storage_array = ptr_ids->id_storage_array;
+
   // handle from [0; MAX_TASK_QUANTITY - 1) =>
   // i.e till the penaltimate one (@note will have handle last elem after this)
   for (int i = 0; i < MAX_TASK_QUANTITY - 1; i += 1) {
@@ -73,25 +75,24 @@ static void init_id_storage_array(void) {
   id_storage_array[MAX_TASK_QUANTITY - 1].next = NULL;
 
   // set up @link{ptr_free_elem}
-  ptr_free_elem = &id_storage_array[0];
+  ptr_ids->ptr_free_elem = &id_storage_array[0];
 
   // set up calling flag
-  is_first_call = false;
+  ptr_ids->is_initialized = true;
 }
 
 /**
  *  @brief Get the free id from the @link{id_storage_array}
  *
  *  @note ! Impure function !
- *  - mutates the outer (encapsulated in the module) @link{id_storage_array}
- *  - mutates the outer (encapsulated in the module) @link{is_first_call}
- *  - mutates the outer (encapsulated in the module) @link{ptr_free_elem}
+ *  - mutates the outer @link{ids} of the @link{ptr_scheduler} (
+ *    @see{ID_STORAGE} )
  *  - mutates the outer (encapsulated in the module) @type{PROMISE_ID_VALUE}
  *
  *  @note Returns promise like structure @link{PROMISE_ID_VALUE}! Examine the
  *  example below how to handle it properly!
  *
- *  @param {void} - no params expected
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
  *
  *  @return {PROMISE_ID_VALUE} - structure of complex type
  *    @see{PROMISE_ID_VALUE} for details and examples below for clarification
@@ -106,7 +107,7 @@ static void init_id_storage_array(void) {
  *    ID_LIST_ELEM *ptr_head_elem = NULL;
  *    TASK_COUNTER id;
  *    *** Usage ***
- *    PROMISE_ID_VALUE log_id_value = get_id();
+ *    PROMISE_ID_VALUE log_id_value = get_id(&default_scheduler);
  *
  *    switch (log_id_value.type) {
  *    case SUCCESS:
@@ -133,19 +134,21 @@ static void init_id_storage_array(void) {
  *    }
  *
  */
-PROMISE_ID_VALUE get_id(void) {
+PROMISE_ID_VALUE get_id(Scheduler *ptr_scheduler) {
+  ID_STORAGE *ptr_ids = &ptr_scheduler->ids;
+
   // init @link{id_storage_array} if it wasn't yet
-  init_id_storage_array();
+  init_id_storage_array(ptr_ids);
 
   // check the free node of @link{id_storage_array} with id exist
-  if (ptr_free_elem == NULL) {
+  if (ptr_ids->ptr_free_elem == NULL) {
     return (PROMISE_ID_VALUE){.type = ERROR_CODE,
                               .handle_id_result.CODES_RESULT =
                                   HANDLE_ID_NO_FREE_ID};
   }
 
-  ID_LIST_ELEM *current_node = ptr_free_elem;
-  ptr_free_elem = ptr_free_elem->next;
+  ID_LIST_ELEM *current_node = ptr_ids->ptr_free_elem;
+  ptr_ids->ptr_free_elem = current_node->next;
   current_node->is_free = false;
 
   return (PROMISE_ID_VALUE){.type = SUCCESS,
@@ -157,15 +160,18 @@ PROMISE_ID_VALUE get_id(void) {
  *  @link{id_storage_array}
  *
  *  @note ! Impure function !
- *  - mutates the outer (encapsulated in the module) @link{id_storage_array}
- *  - mutates the outer (encapsulated in the module) @link{is_first_call}
- *  - mutates the outer (encapsulated in the module) @link{ptr_free_elem}
+ *  - mutates the outer @link{ids} of the @link{ptr_scheduler} (
+ *    @see{ID_STORAGE} )
  *  - mutates the outer (encapsulated in the module) @type{PROMISE_ID_VALUE}
  *  - mutates the outer (encapsulated in the module) @type{TASK_COUNTER}
  *
+ *  @note The generation of the id is bumped, so the handles given out for
+ *  the id ( @see{get_id_handle} ) become stale
+ *
  *  @note Returns promise like structure @link{PROMISE_ID_VALUE}! Examine the
  *  example below how to handle it properly!
  *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
  *  @param {TASK_COUNTER} id - id (number) to free
  *
  *  @return {PROMISE_ID_VALUE} - structure of complex type
@@ -185,9 +191,9 @@ PROMISE_ID_VALUE get_id(void) {
  *    ID_LIST_ELEM *ptr_head_elem = NULL;
  *    TASK_COUNTER id;
  *    *** Usage ***
- *    PROMISE_ID_VALUE log_id_value = get_id();
+ *    PROMISE_ID_VALUE log_id_value = get_id(&default_scheduler);
  *    ***
- *    PROMISE_ID_VALUE log_id_value = free_id(TASK_COUNTER id);
+ *    PROMISE_ID_VALUE log_id_value = free_id(&default_scheduler, id);
  *
  *    switch (log_id_value.type) {
  *    case SUCCESS:
@@ -205,9 +211,11 @@ PROMISE_ID_VALUE get_id(void) {
  *    }
  *
  */
-PROMISE_ID_VALUE free_id(TASK_COUNTER id) {
+PROMISE_ID_VALUE free_id(Scheduler *ptr_scheduler, TASK_COUNTER id) {
+  ID_STORAGE *ptr_ids = &ptr_scheduler->ids;
+
   // init @link{id_storage_array} if it wasn't yet
-  init_id_storage_array();
+  init_id_storage_array(ptr_ids);
 
   // check that @link{id} in range
   if (id < 0 || id >= MAX_TASK_QUANTITY) {
@@ -217,7 +225,7 @@ PROMISE_ID_VALUE free_id(TASK_COUNTER id) {
   }
 
   // get current node via given @link{id}
-  ID_LIST_ELEM *current_node = &id_storage_array[id];
+  ID_LIST_ELEM *current_node = &ptr_ids->id_storage_array[id];
 
   // prevent unnecessary multiple freeing
   if (current_node->is_free) {
@@ -227,12 +235,93 @@ PROMISE_ID_VALUE free_id(TASK_COUNTER id) {
   }
 
   // free the id and update @link{ptr_free_elem}
-  current_node->next = ptr_free_elem;
-  ptr_free_elem = current_node;
+  current_node->next = ptr_ids->ptr_free_elem;
+  ptr_ids->ptr_free_elem = current_node;
   current_node->is_free = true;
 
+  // invalidate all the handles given out for the id (ABA protection)
+  current_node->generation += 1;
+
   // return happy path data
   return (PROMISE_ID_VALUE){.type = SUCCESS,
                             .handle_id_result.CODES_RESULT =
                                 HANDLE_ID_DONE_SUCCESSFULLY};
 }
+
+/**
+ *  @brief Get the handle of the given @link{id} i.e. the id (low
+ *  @link{TASK_HANDLE_SLOT_BITS} bits) packed with the current generation of
+ *  the id (high bits)
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{ids} of the @link{ptr_scheduler}
+ *
+ *  @param {const Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} id - id (number) in range [0; MAX_TASK_QUANTITY - 1]
+ *
+ *  @return {TASK_HANDLE} - handle of the id
+ *
+ *  @example
+ *    *** Predefined context ***
+ *    id 2 was freed 3 times
+ *    *** Usage ***
+ *    get_id_handle(&default_scheduler, 2) => (3ULL << 32) | 2 i.e. 12884901890
+ *
+ */
+TASK_HANDLE get_id_handle(const Scheduler *ptr_scheduler, TASK_COUNTER id) {
+  return (TASK_HANDLE)ptr_scheduler->ids.id_storage_array[id].generation
+             << TASK_HANDLE_SLOT_BITS |
+         id;
+}
+
+/**
+ *  @brief Get the id of the given @link{handle}. The handle is valid only if
+ *  the id is in use and the generation of the id wasn't bumped since the
+ *  handle was given out ( @see{free_id} )
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{ids} of the @link{ptr_scheduler} (
+ *    @see{ID_STORAGE} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_HANDLE} handle - handle of the id @see{get_id_handle}
+ *
+ *  @return {PROMISE_ID_VALUE} - structure of complex type
+ *    @see{PROMISE_ID_VALUE} for details
+ *  @throw PROMISE_ID_VALUE.type = ERROR_CODE
+ *    - PROMISE_ID_VALUE.handle_id_result.CODES_RESULT =>
+ *      - HANDLE_ID_UNKNOWN_ID - the id is out of range, free or the handle is
+ *        stale
+ *
+ *  @example
+ *    TASK_HANDLE handle = get_id_handle(ptr_scheduler, 2);
+ *    resolve_id_handle(ptr_scheduler, handle) => SUCCESS, ID_VALUE = 2
+ *    free_id(ptr_scheduler, 2);
+ *    get_id(ptr_scheduler); => 2 again
+ *    resolve_id_handle(ptr_scheduler, handle) => ERROR_CODE,
+ *      HANDLE_ID_UNKNOWN_ID
+ *
+ */
+PROMISE_ID_VALUE resolve_id_handle(Scheduler *ptr_scheduler,
+                                   TASK_HANDLE handle) {
+  ID_STORAGE *ptr_ids = &ptr_scheduler->ids;
+
+  // init @link{id_storage_array} if it wasn't yet
+  init_id_storage_array(ptr_ids);
+
+  TASK_HANDLE id = handle & ((1ULL << TASK_HANDLE_SLOT_BITS) - 1);
+
+  // @note the id is the direct @link{id_storage_array} offset
+  if ((id >= MAX_TASK_QUANTITY) || ptr_ids->id_storage_array[id].is_free ||
+      (ptr_ids->id_storage_array[id].generation !=
+       (unsigned int)(handle >> TASK_HANDLE_SLOT_BITS))) {
+    return (PROMISE_ID_VALUE){.type = ERROR_CODE,
+                              .handle_id_result.CODES_RESULT =
+                                  HANDLE_ID_UNKNOWN_ID};
+  }
+
+  return (PROMISE_ID_VALUE){.type = SUCCESS,
+                            .handle_id_result.ID_VALUE = (TASK_COUNTER)id};
+}
+
+#endif
@@ -0,0 +1,414 @@
+#include "../environment/config.h"
+
+#if TASK_ID_ALLOCATOR == TASK_ID_ALLOCATOR_BITMAP ||                          \
+    TASK_ID_ALLOCATOR == TASK_ID_ALLOCATOR_ATOMIC_BITMAP
+
+#include <stdatomic.h>
+
+#include "../environment/scheduler_config.h"
+#include "./handle_id_config.h"
+
+/**
+ *  @brief Utility function (encapsulated) to load the word of the bitmap (
+ *  @see{ID_BITMAP_WORD} )
+ *
+ */
+static inline uint64_t load_bitmap_word(const ID_BITMAP_WORD *ptr_word) {
+#if TASK_ID_ALLOCATOR == TASK_ID_ALLOCATOR_ATOMIC_BITMAP
+  return atomic_load_explicit(ptr_word, memory_order_acquire);
+#else
+  return *ptr_word;
+#endif
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get the mask of the bits of the
+ *  word @link{word_index} that stand for the existing items (the tail of the
+ *  last word is out of the @link{items_quantity})
+ *
+ *  @param {size_t} word_index - index of the word
+ *  @param {size_t} items_quantity - quantity of the items (bits) of all the
+ *    words
+ *
+ *  @return {uint64_t} - the mask of the existing items
+ *
+ *  @example
+ *    get_valid_bits(0, 3) => 0b111
+ *    get_valid_bits(0, 100) => 0xFFFFFFFFFFFFFFFF
+ *    get_valid_bits(1, 100) => 0xFFFFFFFFF (36 bits)
+ *
+ */
+static inline uint64_t get_valid_bits(size_t word_index,
+                                      size_t items_quantity) {
+  size_t first_item = word_index * 64;
+
+  return items_quantity - first_item >= 64
+             ? UINT64_MAX
+             : (1ULL << (items_quantity - first_item)) - 1;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to claim the free bit of the word
+ *  of the @link{used_ids}
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{ptr_word}
+ *  - mutates the outer @link{ptr_word_value}
+ *
+ *  @param {ID_BITMAP_WORD *} ptr_word - the word of the @link{used_ids}
+ *  @param {uint64_t *} ptr_word_value - the loaded value of the word. The
+ *    new value (claimed) or the current one (the atomic bitmap, the other
+ *    thread changed the word) after the call
+ *  @param {uint64_t} bit - the bit to claim
+ *
+ *  @return {bool} - true => the bit is claimed, false => retry with the
+ *    current value
+ *
+ */
+static inline bool claim_bitmap_bit(ID_BITMAP_WORD *ptr_word,
+                                    uint64_t *ptr_word_value, uint64_t bit) {
+#if TASK_ID_ALLOCATOR == TASK_ID_ALLOCATOR_ATOMIC_BITMAP
+  if (!atomic_compare_exchange_weak_explicit(
+          ptr_word, ptr_word_value, *ptr_word_value | bit,
+          memory_order_acq_rel, memory_order_acquire)) {
+    return false;
+  }
+#else
+  *ptr_word = *ptr_word_value | bit;
+#endif
+
+  *ptr_word_value |= bit;
+
+  return true;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to mark the word of the
+ *  @link{used_ids} as full in the summary
+ *
+ *  @note The atomic bitmap re-checks the word after the marking: the other
+ *  thread may free the id of the word before the summary bit is set, so the
+ *  mark is revoked if the word isn't full anymore (the summary never hides
+ *  the free id for long)
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{full_words} of the @link{ptr_ids}
+ *
+ *  @param {ID_STORAGE *} ptr_ids - the id storage of the scheduler
+ *  @param {size_t} word_index - index of the full word
+ *
+ */
+static inline void mark_bitmap_word_full(ID_STORAGE *ptr_ids,
+                                         size_t word_index) {
+  uint64_t summary_bit = 1ULL << (word_index % 64);
+
+#if TASK_ID_ALLOCATOR == TASK_ID_ALLOCATOR_ATOMIC_BITMAP
+  // seq_cst: the marking is ordered before the re-check (the free_id
+  // clears the word before the summary bit)
+  atomic_fetch_or(&ptr_ids->full_words[word_index / 64], summary_bit);
+
+  if ((~atomic_load(&ptr_ids->used_ids[word_index]) &
+       get_valid_bits(word_index, MAX_TASK_QUANTITY)) != 0) {
+    atomic_fetch_and(&ptr_ids->full_words[word_index / 64], ~summary_bit);
+  }
+#else
+  ptr_ids->full_words[word_index / 64] |= summary_bit;
+#endif
+}
+
+/**
+ *  @brief Utility function (encapsulated) to find and claim the lowest free
+ *  id of the summary words [@link{summary_from}; @link{summary_to})
+ *
+ *  @note Two tzcnt's per id: the first non-full word via the summary, the
+ *  first free id via the word
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{used_ids}, @link{full_words} and
+ *    @link{summary_hint} of the @link{ptr_ids}
+ *  - mutates the outer @link{ptr_id}
+ *
+ *  @param {ID_STORAGE *} ptr_ids - the id storage of the scheduler
+ *  @param {size_t} summary_from - the first summary word to check
+ *  @param {size_t} summary_to - the summary word to stop at
+ *  @param {TASK_COUNTER *} ptr_id - the claimed id
+ *
+ *  @return {bool} - true => the id is claimed, false => no free id in range
+ *
+ */
+static bool claim_free_id(ID_STORAGE *ptr_ids, size_t summary_from,
+                          size_t summary_to, TASK_COUNTER *ptr_id) {
+  for (size_t s = summary_from; s < summary_to; s += 1) {
+    uint64_t non_full_words = ~load_bitmap_word(&ptr_ids->full_words[s]) &
+                              get_valid_bits(s, ID_BITMAP_WORDS);
+
+    while (non_full_words != 0) {
+      size_t w = s * 64 + (size_t)__builtin_ctzll(non_full_words);
+      uint64_t valid_bits = get_valid_bits(w, MAX_TASK_QUANTITY);
+      uint64_t word = load_bitmap_word(&ptr_ids->used_ids[w]);
+      uint64_t free_bits = 0;
+
+      while ((free_bits = ~word & valid_bits) != 0) {
+        uint64_t bit = free_bits & -free_bits;
+
+        if (!claim_bitmap_bit(&ptr_ids->used_ids[w], &word, bit)) {
+          continue;
+        }
+
+        if ((~word & valid_bits) == 0) {
+          mark_bitmap_word_full(ptr_ids, w);
+        }
+
+#if TASK_ID_ALLOCATOR == TASK_ID_ALLOCATOR_ATOMIC_BITMAP
+        atomic_store_explicit(&ptr_ids->summary_hint, s, memory_order_relaxed);
+#else
+        ptr_ids->summary_hint = s;
+#endif
+
+        *ptr_id = (TASK_COUNTER)(w * 64 + (size_t)__builtin_ctzll(bit));
+        return true;
+      }
+
+      // the word is full (marked by the other thread or stale summary)
+      non_full_words &= non_full_words - 1;
+    }
+  }
+
+  return false;
+}
+
+/**
+ *  @brief Get the free id (the lowest one) from the bitmap of the
+ *  @link{ptr_scheduler}'s ids
+ *
+ *  @note The storage is constant-initialised (zeroed => all the ids are
+ *  free), so there is no initializing call. Thread-safe for the
+ *  TASK_ID_ALLOCATOR_ATOMIC_BITMAP ( @see{TASK_ID_ALLOCATOR} )
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{ids} of the @link{ptr_scheduler} (
+ *    @see{ID_STORAGE} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {PROMISE_ID_VALUE} - structure of complex type
+ *    @see{PROMISE_ID_VALUE} for details
+ *  @throw PROMISE_ID_VALUE.type = ERROR_CODE
+ *    - PROMISE_ID_VALUE.handle_id_result.CODES_RESULT =>
+ *      - HANDLE_ID_NO_FREE_ID - no free id is avaliable
+ *
+ *  @example
+ *    *** Predefined context ***
+ *    ids 0, 1 and 3 are in use
+ *    *** Usage ***
+ *    get_id(&default_scheduler) => {.type = SUCCESS,
+ *      .handle_id_result.ID_VALUE = 2}
+ *    get_id(&default_scheduler) => 4
+ *
+ */
+PROMISE_ID_VALUE get_id(Scheduler *ptr_scheduler) {
+  ID_STORAGE *ptr_ids = &ptr_scheduler->ids;
+  TASK_COUNTER id = 0;
+
+#if TASK_ID_ALLOCATOR == TASK_ID_ALLOCATOR_ATOMIC_BITMAP
+  size_t summary_hint =
+      atomic_load_explicit(&ptr_ids->summary_hint, memory_order_relaxed);
+#else
+  size_t summary_hint = ptr_ids->summary_hint;
+#endif
+
+  // from the hint to the end, then the words before the hint (the atomic
+  // hint may be ahead of the freed ids)
+  if (!claim_free_id(ptr_ids, summary_hint, ID_BITMAP_SUMMARY_WORDS, &id) &&
+      !claim_free_id(ptr_ids, 0, summary_hint, &id)) {
+    return (PROMISE_ID_VALUE){.type = ERROR_CODE,
+                              .handle_id_result.CODES_RESULT =
+                                  HANDLE_ID_NO_FREE_ID};
+  }
+
+  return (PROMISE_ID_VALUE){.type = SUCCESS,
+                            .handle_id_result.ID_VALUE = id};
+}
+
+/**
+ *  @brief Free the given @link{id} for further usage
+ *
+ *  @note The generation of the id is bumped when the id is freed, so the
+ *  handles given out for the id ( @see{get_id_handle} ) become stale. The
+ *  atomic bitmap bumps it before the id's bit is cleared, so the handle of
+ *  the next owner always carries the new generation (freeing the id one
+ *  doesn't own, e.g. the racing double free, is still the caller's bug).
+ *  Thread-safe for the TASK_ID_ALLOCATOR_ATOMIC_BITMAP ( @see{
+ *  TASK_ID_ALLOCATOR} )
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{ids} of the @link{ptr_scheduler} (
+ *    @see{ID_STORAGE} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} id - id (number) to free
+ *
+ *  @return {PROMISE_ID_VALUE} - structure of complex type
+ *    @see{PROMISE_ID_VALUE} for details
+ *    @note This's only for unification! PROMISE_ID_VALUE.type = SUCCESS
+ *    - PROMISE_ID_VALUE.handle_id_result.CODES_RESULT =>
+ *      HANDLE_ID_DONE_SUCCESSFULLY - no errors, done successfully (the free
+ *      id is freed again too)
+ *
+ *  @throw PROMISE_ID_VALUE.type = ERROR_CODE
+ *    - PROMISE_ID_VALUE.handle_id_result.CODES_RESULT =>
+ *      - HANDLE_ID_UNKNOWN_ID - the id is out of range
+ *
+ *  @example
+ *    free_id(&default_scheduler, 2) => {.type = SUCCESS,
+ *      .handle_id_result.CODES_RESULT = HANDLE_ID_DONE_SUCCESSFULLY}
+ *    get_id(&default_scheduler) => 2 (if ids 0 and 1 are in use)
+ *
+ */
+PROMISE_ID_VALUE free_id(Scheduler *ptr_scheduler, TASK_COUNTER id) {
+  ID_STORAGE *ptr_ids = &ptr_scheduler->ids;
+
+  if (id >= MAX_TASK_QUANTITY) {
+    return (PROMISE_ID_VALUE){.type = ERROR_CODE,
+                              .handle_id_result.CODES_RESULT =
+                                  HANDLE_ID_UNKNOWN_ID};
+  }
+
+  size_t w = id / 64;
+  size_t s = w / 64;
+  uint64_t bit = 1ULL << (id % 64);
+
+#if TASK_ID_ALLOCATOR == TASK_ID_ALLOCATOR_ATOMIC_BITMAP
+  // prevent unnecessary multiple freeing
+  if ((load_bitmap_word(&ptr_ids->used_ids[w]) & bit) == 0) {
+    return (PROMISE_ID_VALUE){.type = SUCCESS,
+                              .handle_id_result.CODES_RESULT =
+                                  HANDLE_ID_DONE_SUCCESSFULLY};
+  }
+
+  // invalidate all the handles given out for the id (ABA protection) before
+  // the id is released: the get_id that claims the id (acq_rel CAS on the
+  // cleared word) sees the new generation, so the late bump can't make the
+  // new owner's handle stale
+  atomic_fetch_add_explicit(&ptr_ids->generations[id], 1,
+                            memory_order_release);
+
+  // seq_cst: the word is cleared before the summary bit (
+  // @see{mark_bitmap_word_full} ). The concurrent call for the same id that
+  // sees the bit cleared already changes nothing else
+  if ((atomic_fetch_and(&ptr_ids->used_ids[w], ~bit) & bit) == 0) {
+    return (PROMISE_ID_VALUE){.type = SUCCESS,
+                              .handle_id_result.CODES_RESULT =
+                                  HANDLE_ID_DONE_SUCCESSFULLY};
+  }
+
+  atomic_fetch_and(&ptr_ids->full_words[s], ~(1ULL << (w % 64)));
+
+  size_t summary_hint =
+      atomic_load_explicit(&ptr_ids->summary_hint, memory_order_relaxed);
+  while ((s < summary_hint) &&
+         !atomic_compare_exchange_weak_explicit(&ptr_ids->summary_hint,
+                                                &summary_hint, s,
+                                                memory_order_relaxed,
+                                                memory_order_relaxed)) {
+  }
+#else
+  // prevent unnecessary multiple freeing
+  if ((load_bitmap_word(&ptr_ids->used_ids[w]) & bit) == 0) {
+    return (PROMISE_ID_VALUE){.type = SUCCESS,
+                              .handle_id_result.CODES_RESULT =
+                                  HANDLE_ID_DONE_SUCCESSFULLY};
+  }
+
+  // invalidate all the handles given out for the id (ABA protection)
+  ptr_ids->generations[id] += 1;
+  ptr_ids->used_ids[w] &= ~bit;
+  ptr_ids->full_words[s] &= ~(1ULL << (w % 64));
+
+  if (s < ptr_ids->summary_hint) {
+    ptr_ids->summary_hint = s;
+  }
+#endif
+
+  return (PROMISE_ID_VALUE){.type = SUCCESS,
+                            .handle_id_result.CODES_RESULT =
+                                HANDLE_ID_DONE_SUCCESSFULLY};
+}
+
+/**
+ *  @brief Get the handle of the given @link{id} i.e. the id (low
+ *  @link{TASK_HANDLE_SLOT_BITS} bits) packed with the current generation of
+ *  the id (high bits)
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{ids} of the @link{ptr_scheduler}
+ *
+ *  @param {const Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} id - id (number) in range [0; MAX_TASK_QUANTITY - 1]
+ *
+ *  @return {TASK_HANDLE} - handle of the id
+ *
+ *  @example
+ *    *** Predefined context ***
+ *    id 2 was freed 3 times
+ *    *** Usage ***
+ *    get_id_handle(&default_scheduler, 2) => (3ULL << 32) | 2 i.e. 12884901890
+ *
+ */
+TASK_HANDLE get_id_handle(const Scheduler *ptr_scheduler, TASK_COUNTER id) {
+#if TASK_ID_ALLOCATOR == TASK_ID_ALLOCATOR_ATOMIC_BITMAP
+  unsigned int generation = atomic_load_explicit(
+      &ptr_scheduler->ids.generations[id], memory_order_relaxed);
+#else
+  unsigned int generation = ptr_scheduler->ids.generations[id];
+#endif
+
+  return (TASK_HANDLE)generation << TASK_HANDLE_SLOT_BITS | id;
+}
+
+/**
+ *  @brief Get the id of the given @link{handle}. The handle is valid only if
+ *  the id is in use and the generation of the id wasn't bumped since the
+ *  handle was given out ( @see{free_id} )
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{ids} of the @link{ptr_scheduler}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_HANDLE} handle - handle of the id @see{get_id_handle}
+ *
+ *  @return {PROMISE_ID_VALUE} - structure of complex type
+ *    @see{PROMISE_ID_VALUE} for details
+ *  @throw PROMISE_ID_VALUE.type = ERROR_CODE
+ *    - PROMISE_ID_VALUE.handle_id_result.CODES_RESULT =>
+ *      - HANDLE_ID_UNKNOWN_ID - the id is out of range, free or the handle is
+ *        stale
+ *
+ *  @example
+ *    TASK_HANDLE handle = get_id_handle(ptr_scheduler, 2);
+ *    resolve_id_handle(ptr_scheduler, handle) => SUCCESS, ID_VALUE = 2
+ *    free_id(ptr_scheduler, 2);
+ *    get_id(ptr_scheduler); => 2 again
+ *    resolve_id_handle(ptr_scheduler, handle) => ERROR_CODE,
+ *      HANDLE_ID_UNKNOWN_ID
+ *
+ */
+PROMISE_ID_VALUE resolve_id_handle(Scheduler *ptr_scheduler,
+                                   TASK_HANDLE handle) {
+  ID_STORAGE *ptr_ids = &ptr_scheduler->ids;
+  TASK_HANDLE id = handle & ((1ULL << TASK_HANDLE_SLOT_BITS) - 1);
+
+  if ((id >= MAX_TASK_QUANTITY) ||
+      ((load_bitmap_word(&ptr_ids->used_ids[id / 64]) &
+        (1ULL << (id % 64))) == 0) ||
+      (get_id_handle(ptr_scheduler, (TASK_COUNTER)id) != handle)) {
+    return (PROMISE_ID_VALUE){.type = ERROR_CODE,
+                              .handle_id_result.CODES_RESULT =
+                                  HANDLE_ID_UNKNOWN_ID};
+  }
+
+  return (PROMISE_ID_VALUE){.type = SUCCESS,
+                            .handle_id_result.ID_VALUE = (TASK_COUNTER)id};
+}
+
+#endif
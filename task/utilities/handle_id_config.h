@@ -1,19 +1,22 @@
 #ifndef HANDLE_ID_H
 #define HANDLE_ID_H
 
+#include <stdint.h>
+
 #include "../environment/config.h"
 
 /**
  *  @details
  *  - HANDLE_ID_DONE_SUCCESSFULLY - no errors, done successfully
  *  - HANDLE_ID_NO_FREE_ID - no free id is avaliable
- *  - HANDLE_ID_UNKNOWN_ID - the id is not defined
+ *  - HANDLE_ID_UNKNOWN_ID - the id is not defined (or the handle is stale)
  *
  */
 enum Handle_id_errors_codes {
   HANDLE_ID_DONE_SUCCESSFULLY = 0, /**< no errors, done successfully */
   HANDLE_ID_NO_FREE_ID = 1,        /**< no free id is avaliable */
-  HANDLE_ID_UNKNOWN_ID = 2,        /**< the id is not defined */
+  HANDLE_ID_UNKNOWN_ID = 2, /**< the id is not defined (or the handle is
+                             *   stale) */
 };
 
 /**
@@ -26,7 +29,7 @@ enum Handle_id_errors_codes {
  *
  */
 union Union_id_value {
-  unsigned short ID_VALUE; /**< free ID number */
+  TASK_COUNTER ID_VALUE; /**< free ID number */
   enum Handle_id_errors_codes
       CODES_RESULT; /**< Error codes at the process of id handling */
 };
@@ -37,7 +40,7 @@ union Union_id_value {
  *  function execution.
  *  - type - (SUCCESS | ERROR_CODE)
  *  - handle_id_result - union @link{union Union_id_value}, that is
- *    @type{unsigned short} for ID_VALUE (SUCCESS, everything is OK)
+ *    @type{TASK_COUNTER} for ID_VALUE (SUCCESS, everything is OK)
  *    ( @note CODES_RESULT with HANDLE_ID_DONE_SUCCESSFULLY is only for
  *    SUCCESS for unification with other PROMISE_* like structures)
  *    or
@@ -51,7 +54,7 @@ union Union_id_value {
  *    ID_LIST_ELEM *ptr_head_elem = NULL;
  *    TASK_COUNTER id;
  *    *** Usage ***
- *    PROMISE_ID_VALUE log_id_value = get_id();
+ *    PROMISE_ID_VALUE log_id_value = get_id(&default_scheduler);
  *
  *    switch (log_id_value.type) {
  *    case SUCCESS:
@@ -77,7 +80,7 @@ union Union_id_value {
  *      break;
  *    }
  *
- *    PROMISE_ID_VALUE log_id_value = free_id(TASK_COUNTER id);
+ *    PROMISE_ID_VALUE log_id_value = free_id(&default_scheduler, id);
  *
  *    switch (log_id_value.type) {
  *    case SUCCESS:
@@ -100,11 +103,14 @@ typedef struct s_Handle_id_result {
   union Union_id_value handle_id_result; /**< ID_VALUE | CODES_RESULT */
 } PROMISE_ID_VALUE;
 
+#if TASK_ID_ALLOCATOR == TASK_ID_ALLOCATOR_FREE_LIST
 /**
  *  @details
  *  Structure to implement singly Pointer-Based linked list on array (LIFO).
  *  - TASK_COUNTER id - id value of the current node
  *  - bool is_free - boolean flag to prevent multiple call for freeing id
+ *  - unsigned int generation - counter of the id freeing (the high bits of
+ *    the @type{TASK_HANDLE}), wraps after 2 ** 32 reuses of the id
  *  - struct s_Linked_list_id_item *next - pointer to the next node of the
  *    Linked List
  *
@@ -112,10 +118,72 @@ typedef struct s_Handle_id_result {
 typedef struct s_Linked_list_id_item {
   TASK_COUNTER id; /**< id value of the current node */
   bool is_free;    /**< boolean flag to prevent multiple call for freeing id */
+  unsigned int generation; /**< counter of the id freeing */
   struct s_Linked_list_id_item *next; /**< pointer to the next node */
 } ID_LIST_ELEM;
 
-PROMISE_ID_VALUE get_id(void);
-PROMISE_ID_VALUE free_id(TASK_COUNTER id);
+/**
+ *  @details
+ *  The id storage of the scheduler instance ( @see{Scheduler} )
+ *  - ID_LIST_ELEM id_storage_array - nodes of the ids (the id is the node's
+ *    offset)
+ *  - ID_LIST_ELEM *ptr_free_elem - head of the free ids' list
+ *  - bool is_initialized - the list is linked (zero initialized => linked at
+ *    the first call)
+ *
+ */
+typedef struct s_Id_storage {
+  ID_LIST_ELEM id_storage_array[MAX_TASK_QUANTITY]; /**< nodes of the ids */
+  ID_LIST_ELEM *ptr_free_elem; /**< head of the free ids' list */
+  bool is_initialized;         /**< the list is linked */
+} ID_STORAGE;
+
+#else
+
+#if TASK_ID_ALLOCATOR == TASK_ID_ALLOCATOR_ATOMIC_BITMAP
+typedef _Atomic uint64_t ID_BITMAP_WORD;    /**< the word of the bitmap */
+typedef _Atomic unsigned int ID_GENERATION; /**< the generation of the id */
+typedef _Atomic size_t ID_BITMAP_HINT;      /**< the summary word to start */
+#else
+typedef uint64_t ID_BITMAP_WORD;    /**< the word of the bitmap */
+typedef unsigned int ID_GENERATION; /**< the generation of the id */
+typedef size_t ID_BITMAP_HINT;      /**< the summary word to start */
+#endif
+
+enum Handle_id_bitmap_variables {
+  ID_BITMAP_WORDS = (MAX_TASK_QUANTITY + 63) / 64, /**< the words of the ids */
+  ID_BITMAP_SUMMARY_WORDS =
+      (ID_BITMAP_WORDS + 63) / 64, /**< the words of the summary */
+};
+
+/**
+ *  @details
+ *  The id storage of the scheduler instance ( @see{Scheduler} ): two-level
+ *  (hierarchical) bitmap, zero initialized => all the ids are free, no
+ *  initializing call
+ *  - ID_BITMAP_WORD used_ids - the bit per id (set => the id is in use)
+ *  - ID_BITMAP_WORD full_words - the summary, the bit per word of the
+ *    used_ids (set => all 64 ids of the word are in use)
+ *  - ID_GENERATION generations - counters of the ids' freeing (the high bits
+ *    of the @type{TASK_HANDLE}), wrap after 2 ** 32 reuses of the id
+ *  - ID_BITMAP_HINT summary_hint - the summary word the search of the free id
+ *    starts from (the words before it are full, only a hint for the atomic
+ *    bitmap)
+ *
+ */
+typedef struct s_Id_storage {
+  ID_BITMAP_WORD used_ids[ID_BITMAP_WORDS];           /**< the bit per id */
+  ID_BITMAP_WORD full_words[ID_BITMAP_SUMMARY_WORDS]; /**< the summary */
+  ID_GENERATION generations[MAX_TASK_QUANTITY]; /**< counters of freeing */
+  ID_BITMAP_HINT summary_hint; /**< the summary word to start from */
+} ID_STORAGE;
+
+#endif
+
+PROMISE_ID_VALUE get_id(Scheduler *ptr_scheduler);
+PROMISE_ID_VALUE free_id(Scheduler *ptr_scheduler, TASK_COUNTER id);
+TASK_HANDLE get_id_handle(const Scheduler *ptr_scheduler, TASK_COUNTER id);
+PROMISE_ID_VALUE resolve_id_handle(Scheduler *ptr_scheduler,
+                                   TASK_HANDLE handle);
 
 #endif
@@ -0,0 +1,104 @@
+#include <limits.h>
+
+#include "../environment/config.h"
+#include "../environment/scheduler_config.h"
+#include "./handle_overload_config.h"
+#include "./utils.h"
+
+/**
+ *  @brief Set up the overload policy of the scheduler instance, the counters
+ *  are kept
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{overload} of the @link{ptr_scheduler} (
+ *    @see{OVERLOAD_STATE} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {OVERLOAD_POLICY} policy - @see{OVERLOAD_POLICY}
+ *
+ *  @example
+ *    set_scheduler_overload_policy(
+ *        &default_scheduler,
+ *        (OVERLOAD_POLICY){.full_queue_policy = TASK_FULL_QUEUE_BLOCK,
+ *                          .block_timeout_ms = 50});
+ *
+ */
+void set_scheduler_overload_policy(Scheduler *ptr_scheduler,
+                                   OVERLOAD_POLICY policy) {
+  ptr_scheduler->overload.policy = policy;
+}
+
+/**
+ *  @brief Get the predicted lateness (ns) of the task registered now with
+ *  the @link{deadline_ticks}: the lag of the serving loop (how long the
+ *  earliest deadline is overdue, the backlog in front of the new task is
+ *  served at least that late) minus the time left till the task's deadline
+ *  (0 if the loop catches up before it). The lag falls back to 0 as soon as
+ *  the loop catches up. O(1) ( @see{task_queue_get_next_deadline} )
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on @callback{task_queue_get_next_deadline} (the
+ *    timing wheel gives the start of its' slot, i.e. the lag up to 1 ms more)
+ *
+ *  @param {const Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_TICKS} now_ticks - current monotonic timestamp (ns)
+ *  @param {TASK_TICKS} deadline_ticks - absolute deadline (ns) of the new
+ *    task ( @see{get_task_deadline_ticks} )
+ *
+ *  @return {TASK_TICKS} - the predicted lateness (ns)
+ *
+ *  @example
+ *    *** the earliest deadline is 30 ms overdue ***
+ *    get_predicted_lateness_ticks(&default_scheduler, now_ticks,
+ *                                 now_ticks + 5'000'000) => 25000000
+ *    get_predicted_lateness_ticks(&default_scheduler, now_ticks,
+ *                                 now_ticks + 10'000'000'000) => 0
+ *
+ */
+TASK_TICKS get_predicted_lateness_ticks(const Scheduler *ptr_scheduler,
+                                        TASK_TICKS now_ticks,
+                                        TASK_TICKS deadline_ticks) {
+  TASK_TICKS next_deadline_ticks = task_queue_get_next_deadline(ptr_scheduler);
+  TASK_TICKS lag_ticks =
+      next_deadline_ticks < now_ticks ? now_ticks - next_deadline_ticks : 0;
+  TASK_TICKS left_ticks =
+      deadline_ticks > now_ticks ? deadline_ticks - now_ticks : 0;
+
+  return lag_ticks > left_ticks ? lag_ticks - left_ticks : 0;
+}
+
+/**
+ *  @brief Check the admission control of the scheduler instance (
+ *  @see{OVERLOAD_POLICY} ): the new task is admitted unless its' predicted
+ *  lateness is greater than the max_lateness_ms
+ *
+ *  @note The limit is saturated at LLONG_MAX ns, so the huge max_lateness_ms
+ *  doesn't overflow (i.e. admits everything)
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{overload} of the @link{ptr_scheduler}
+ *  - implicit dependency on @callback{get_predicted_lateness_ticks}
+ *  - implicit dependency on @link{LLONG_MAX} of <limits.h>
+ *
+ *  @param {const Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_TICKS} now_ticks - current monotonic timestamp (ns)
+ *  @param {TASK_TICKS} deadline_ticks - absolute deadline (ns) of the new
+ *    task
+ *
+ *  @return {bool} - true => admitted
+ *
+ */
+bool is_task_admitted(const Scheduler *ptr_scheduler, TASK_TICKS now_ticks,
+                      TASK_TICKS deadline_ticks) {
+  const TASK_DELAY MAX_LATENESS_MS =
+      ptr_scheduler->overload.policy.max_lateness_ms;
+
+  if ((MAX_LATENESS_MS == 0) ||
+      (MAX_LATENESS_MS > (TASK_DELAY)LLONG_MAX / RATIO_NANOSEC_MSEC)) {
+    return true;
+  }
+
+  return get_predicted_lateness_ticks(ptr_scheduler, now_ticks,
+                                      deadline_ticks) <=
+         (TASK_TICKS)MAX_LATENESS_MS * RATIO_NANOSEC_MSEC;
+}
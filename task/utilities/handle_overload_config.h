@@ -0,0 +1,87 @@
+#ifndef HANDLE_OVERLOAD_H
+#define HANDLE_OVERLOAD_H
+
+#include "../environment/config.h"
+
+/**
+ *  @details
+ *  What the registering of the task does with the full queue of the
+ *  scheduler instance ( @see{set_overload_policy_in} )
+ *  - TASK_FULL_QUEUE_REJECT - fail at once with
+ *    REGISTER_TASK_ARRAY_OF_TASKS_FULL (default)
+ *  - TASK_FULL_QUEUE_BLOCK - serve the expired tasks (and sleep till the next
+ *    deadline) in the registering thread till a slot frees or
+ *    block_timeout_ms is over, i.e. the producer is slowed down to the pace
+ *    of the queue (backpressure). The callbacks of the other (expired) tasks
+ *    are called inline by the thread calling register_task. Inside the firing
+ *    task's callback nothing can be served, so it fails at once (as
+ *    TASK_FULL_QUEUE_REJECT). For the instance registered to by its' serving
+ *    thread only: while the other thread waits on the instance (shared via
+ *    the queue mutex, @see{wait_next_deadline_locked_in} ) it fails at once
+ *    too, the producers of the shared instance submit to the ring (
+ *    @see{submit_register_task} ) instead
+ *  - TASK_FULL_QUEUE_EVICT_FURTHEST - remove the task with the latest
+ *    deadline (the notification is called with its' handle) if it is later
+ *    than the new one's, else fail
+ *
+ */
+enum Task_full_queue_policies {
+  TASK_FULL_QUEUE_REJECT = 0,         /**< fail at once (default) */
+  TASK_FULL_QUEUE_BLOCK = 1,          /**< serve / wait till a slot frees */
+  TASK_FULL_QUEUE_EVICT_FURTHEST = 2, /**< remove the latest deadline task */
+};
+
+/**
+ *  @brief Notification about the evicted task ( @see{
+ *  TASK_FULL_QUEUE_EVICT_FURTHEST} ): its' (already stale) handle and the
+ *  argument of its' callback, e.g. to count the shed work or to retry it
+ *  later
+ *
+ */
+typedef void (*task_evicted_callback)(TASK_HANDLE handle, unsigned short arg);
+
+/**
+ *  @details
+ *  The overload policy of the scheduler instance ( @see{Scheduler} ), zeroed
+ *  => reject when full, no admission control
+ *  - full_queue_policy - @see{enum Task_full_queue_policies}
+ *  - block_timeout_ms - max time (ms) to block for TASK_FULL_QUEUE_BLOCK
+ *  - on_evicted - notification for TASK_FULL_QUEUE_EVICT_FURTHEST (NULL =>
+ *    none)
+ *  - max_lateness_ms - admission control: the new tasks are refused
+ *    (REGISTER_TASK_ADMISSION_REJECTED) while their predicted lateness (
+ *    @see{get_predicted_lateness_ticks} ) is greater. 0 => no admission
+ *    control
+ *
+ */
+typedef struct s_Overload_policy {
+  enum Task_full_queue_policies full_queue_policy; /**< the full queue */
+  TASK_DELAY block_timeout_ms;  /**< max time (ms) to block */
+  task_evicted_callback on_evicted; /**< the eviction notification */
+  TASK_DELAY max_lateness_ms;   /**< admission limit (ms), 0 => none */
+} OVERLOAD_POLICY;
+
+/**
+ *  @details
+ *  The overload state of the scheduler instance ( @see{Scheduler} )
+ *  - policy - @see{OVERLOAD_POLICY}
+ *  - rejected_count - quantity of the refused registrations (the full queue,
+ *    the admission control)
+ *  - evicted_count - quantity of the evicted tasks
+ *
+ */
+typedef struct s_Overload_state {
+  OVERLOAD_POLICY policy;       /**< the overload policy */
+  unsigned long long rejected_count; /**< refused registrations */
+  unsigned long long evicted_count;  /**< evicted tasks */
+} OVERLOAD_STATE;
+
+void set_scheduler_overload_policy(Scheduler *ptr_scheduler,
+                                   OVERLOAD_POLICY policy);
+TASK_TICKS get_predicted_lateness_ticks(const Scheduler *ptr_scheduler,
+                                        TASK_TICKS now_ticks,
+                                        TASK_TICKS deadline_ticks);
+bool is_task_admitted(const Scheduler *ptr_scheduler, TASK_TICKS now_ticks,
+                      TASK_TICKS deadline_ticks);
+
+#endif
@@ -0,0 +1,169 @@
+#include "../environment/config.h"
+#include "../environment/scheduler_config.h"
+#include "./handle_periodic_tasks_config.h"
+#include "./utils.h"
+
+/**
+ *  @brief Set up the period (ms) and the catch-up policy of the task
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{periodic} of the @link{ptr_scheduler} (
+ *    @see{PERIODIC_TASKS_STATE} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} id - id of the task in range
+ *    [0; MAX_TASK_QUANTITY - 1]
+ *  @param {TASK_DELAY} period - period (ms) of the task, 0 => one-shot task
+ *  @param {enum Task_catch_up_policies} catch_up_policy - @see{enum
+ *    Task_catch_up_policies}
+ *
+ *  @example
+ *    set_task_period(&default_scheduler, 2, 100, TASK_CATCH_UP_SKIP);
+ *    => the task with id 2 is served every 100 ms
+ *
+ */
+void set_task_period(Scheduler *ptr_scheduler, TASK_COUNTER id,
+                     TASK_DELAY period,
+                     enum Task_catch_up_policies catch_up_policy) {
+  ptr_scheduler->periodic.task_periods[id] = period;
+  ptr_scheduler->periodic.catch_up_policies[id] =
+      (unsigned char)catch_up_policy;
+}
+
+/**
+ *  @brief Reschedule the served (expired) periodic task in place: the same
+ *  slot and id (the handle stays valid), the next deadline is counted from
+ *  the previous one (not from the serving moment), so the lateness of the
+ *  serving doesn't accumulate (no drift)
+ *
+ *  @note Call it instead of free_id + task_queue_pop of the served task.
+ *  Copy the task out before, the queue backend may move it.
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{tasks_array} of the @link{ptr_scheduler}
+ *  - implicit dependency on the @link{periodic} of the @link{ptr_scheduler}
+ *  - implicit dependency on @callback{get_task_deadline_ticks}
+ *  - implicit dependency on @callback{task_queue_reschedule}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {const Task *} ptr_task - the served task
+ *  @param {TASK_TICKS} current_ticks - the serving monotonic timestamp (ns)
+ *
+ *  @return {bool} - true => the task is periodic and rescheduled, false =>
+ *  the task is one-shot (free it)
+ *
+ *  @example
+ *    *** Predefined context ***
+ *    the task with period 100 ms, deadline 1'000'000'000 ns
+ *    *** Usage ***
+ *    reschedule_periodic_task(&default_scheduler, ptr_task, 1'350'000'000)
+ *    => true, the next deadline: 1'400'000'000 (TASK_CATCH_UP_SKIP) or
+ *    1'100'000'000 (TASK_CATCH_UP_BURST)
+ *
+ */
+bool reschedule_periodic_task(Scheduler *ptr_scheduler, const Task *ptr_task,
+                              TASK_TICKS current_ticks) {
+  TASK_DELAY period = ptr_scheduler->periodic.task_periods[ptr_task->id];
+
+  if (period == 0) {
+    return false;
+  }
+
+  // the start of the next period is the previous deadline
+  TASK_TICKS period_started_ticks = ptr_task->deadline_ticks;
+  TASK_TICKS next_deadline_ticks =
+      get_task_deadline_ticks(period_started_ticks, period);
+
+  // skip the missed periods: move to the period of the grid that contains
+  // the serving moment
+  if ((ptr_scheduler->periodic.catch_up_policies[ptr_task->id] ==
+       TASK_CATCH_UP_SKIP) &&
+      (next_deadline_ticks <= current_ticks)) {
+    TASK_TICKS period_ticks = next_deadline_ticks - period_started_ticks;
+
+    period_started_ticks +=
+        (current_ticks - period_started_ticks) / period_ticks * period_ticks;
+  }
+
+  return task_queue_reschedule(ptr_scheduler, ptr_task->id, period,
+                               period_started_ticks) ==
+         TASK_QUEUE_DONE_SUCCESSFULLY;
+}
+
+/**
+ *  @brief Mark the task as the firing one, i.e. its' callback is about to be
+ *  called in the serving thread. The one-shot task is left in its' queue
+ *  slot till @link{end_firing_task}, so the callback may requeue it in place
+ *  ( @see{requeue_current_task_in} )
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{firing} of the @link{ptr_scheduler} (
+ *    @see{FIRING_TASK_STATE} )
+ *  - implicit dependency on @callback{get_id_handle}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} id - id of the task to serve
+ *  @param {bool} is_kept - the task stays in the queue after the callback
+ *    (the periodic one, already rescheduled via
+ *    @link{reschedule_periodic_task})
+ *
+ */
+void begin_firing_task(Scheduler *ptr_scheduler, TASK_COUNTER id,
+                       bool is_kept) {
+  ptr_scheduler->firing =
+      (FIRING_TASK_STATE){.handle = get_id_handle(ptr_scheduler, id),
+                          .is_firing = true,
+                          .is_kept = is_kept};
+}
+
+/**
+ *  @brief Finish the firing task after its' callback returned: the one-shot
+ *  task that wasn't requeued or removed by the callback is removed from the
+ *  queue and its' id is freed
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{firing} of the @link{ptr_scheduler}
+ *  - mutates the outer @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the outer @link{ids} of the @link{ptr_scheduler}
+ *  - implicit dependency on @callback{resolve_id_handle}
+ *  - implicit dependency on @callback{free_id}
+ *  - implicit dependency on @callback{task_queue_peek}
+ *  - implicit dependency on @callback{task_queue_pop}
+ *  - implicit dependency on @callback{task_queue_remove}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {bool} - true => done, false => error at the process of freeing
+ *    the id
+ *
+ */
+bool end_firing_task(Scheduler *ptr_scheduler) {
+  FIRING_TASK_STATE firing = ptr_scheduler->firing;
+  ptr_scheduler->firing = (FIRING_TASK_STATE){};
+
+  if (firing.is_kept) {
+    return true;
+  }
+
+  // the stale handle => the callback removed the task itself
+  PROMISE_ID_VALUE log_id_value =
+      resolve_id_handle(ptr_scheduler, firing.handle);
+
+  if (log_id_value.type == ERROR_CODE) {
+    return true;
+  }
+
+  TASK_COUNTER id = log_id_value.handle_id_result.ID_VALUE;
+
+  // the task is still on top unless the callback registered the one with the
+  // same deadline before it
+  Task *ptr_task = task_queue_peek(ptr_scheduler);
+
+  if ((ptr_task != NULL) && (ptr_task->id == id)) {
+    task_queue_pop(ptr_scheduler);
+  } else {
+    task_queue_remove(ptr_scheduler, id);
+  }
+
+  return free_id(ptr_scheduler, id).type != ERROR_CODE;
+}
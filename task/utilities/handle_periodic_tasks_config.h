@@ -0,0 +1,62 @@
+#ifndef HANDLE_PERIODIC_TASKS_H
+#define HANDLE_PERIODIC_TASKS_H
+
+#include "../environment/config.h"
+
+/**
+ *  @details
+ *  Catch-up policies of the periodic task (what to do with the periods
+ *  missed while the task waited to be served, e.g. the loop was blocked):
+ *  - TASK_CATCH_UP_SKIP - the missed periods are skipped, the next deadline
+ *    is the first one of the period grid after the serving moment
+ *  - TASK_CATCH_UP_BURST - every missed period is served, the next deadline
+ *    is always the previous one + period (the overdue ones are served in a
+ *    row by the same run_ready_tasks / get_ready_tasks call)
+ *
+ */
+enum Task_catch_up_policies {
+  TASK_CATCH_UP_SKIP = 0,  /**< skip the missed periods */
+  TASK_CATCH_UP_BURST = 1, /**< serve every missed period */
+};
+
+/**
+ *  @details
+ *  The periodic tasks' state of the scheduler instance ( @see{Scheduler} ),
+ *  indexed via the task id (both task records, all the queue backends)
+ *  - task_periods - id => period (ms) of the task, 0 => one-shot task
+ *  - catch_up_policies - id => @link{enum Task_catch_up_policies}
+ *
+ */
+typedef struct s_Periodic_tasks_state {
+  TASK_DELAY task_periods[MAX_TASK_QUANTITY]; /**< id => period (ms) */
+  unsigned char catch_up_policies[MAX_TASK_QUANTITY]; /**< id => policy */
+} PERIODIC_TASKS_STATE;
+
+/**
+ *  @details
+ *  The task whose callback is being called by the run_ready_tasks handler of
+ *  the scheduler instance ( @see{begin_firing_task} ). The one-shot task
+ *  stays in its' queue slot till the callback returns, so the callback may
+ *  requeue it in place ( @see{requeue_current_task_in} )
+ *  - handle - handle of the firing task
+ *  - is_firing - the callback of the task is being called
+ *  - is_kept - the task stays in the queue after the callback (periodic or
+ *    requeued), otherwise it is popped and its' id is freed
+ *
+ */
+typedef struct s_Firing_task_state {
+  TASK_HANDLE handle; /**< handle of the firing task */
+  bool is_firing;     /**< the callback is being called */
+  bool is_kept;       /**< the task stays in the queue after the callback */
+} FIRING_TASK_STATE;
+
+void set_task_period(Scheduler *ptr_scheduler, TASK_COUNTER id,
+                     TASK_DELAY period,
+                     enum Task_catch_up_policies catch_up_policy);
+bool reschedule_periodic_task(Scheduler *ptr_scheduler, const Task *ptr_task,
+                              TASK_TICKS current_ticks);
+void begin_firing_task(Scheduler *ptr_scheduler, TASK_COUNTER id,
+                       bool is_kept);
+bool end_firing_task(Scheduler *ptr_scheduler);
+
+#endif
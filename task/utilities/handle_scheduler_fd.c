@@ -0,0 +1,262 @@
+// POSIX declarations (read, close) for the strict -std=c23 builds
+#define _POSIX_C_SOURCE 200809L
+
+#include <limits.h>
+
+#include "../environment/config.h"
+#include "../environment/global_variables.h"
+#include "./handle_scheduler_fd_config.h"
+#include "./task_queue_config.h"
+
+#if defined(__linux__)
+#include <sys/timerfd.h>
+#endif
+
+#if defined(__linux__)
+/**
+ *  @brief Utility function (encapsulated) to arm the @link{scheduler_fd} of
+ *  the timerfd state at the absolute monotonic deadline (or disarm it for
+ *  LLONG_MAX)
+ *
+ *  @note The ticks are read via clock_gettime(CLOCK_MONOTONIC) (
+ *  @see{get_now_ticks} ), so they're passed to the timerfd as is
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{armed_deadline_ticks} of the @link{ptr_fd_state}
+ *
+ *  @param {SCHEDULER_FD_STATE *} ptr_fd_state - the timerfd state of the
+ *    scheduler
+ *  @param {TASK_TICKS} deadline_ticks - monotonic timestamp (ns)
+ *
+ *  @return {enum Handle_scheduler_fd_errors_codes} -
+ *  HANDLE_SCHEDULER_FD_DONE_SUCCESSFULLY
+ *  @throw HANDLE_SCHEDULER_FD_SETTIME_ERROR - timerfd_settime() failed
+ *
+ */
+static enum Handle_scheduler_fd_errors_codes
+arm_scheduler_fd(SCHEDULER_FD_STATE *ptr_fd_state, TASK_TICKS deadline_ticks) {
+  struct itimerspec timer_spec = {};
+
+  // the zero it_value disarms the timer => the past deadlines fire at 1 ns
+  if (deadline_ticks != LLONG_MAX) {
+    TASK_TICKS at_ticks = deadline_ticks > 0 ? deadline_ticks : 1;
+
+    timer_spec.it_value.tv_sec = at_ticks / RATIO_SEC_NANOSEC;
+    timer_spec.it_value.tv_nsec = at_ticks % RATIO_SEC_NANOSEC;
+  }
+
+  if (timerfd_settime(ptr_fd_state->scheduler_fd, TFD_TIMER_ABSTIME,
+                      &timer_spec, NULL) != 0) {
+    // unknown state => any deadline of the next re-arm calls
+    // timerfd_settime() again
+    ptr_fd_state->armed_deadline_ticks = LLONG_MAX;
+
+    return HANDLE_SCHEDULER_FD_SETTIME_ERROR;
+  }
+
+  ptr_fd_state->armed_deadline_ticks = deadline_ticks;
+
+  return HANDLE_SCHEDULER_FD_DONE_SUCCESSFULLY;
+}
+#endif
+
+/**
+ *  @brief Get the file descriptor (timerfd) that becomes readable when the
+ *  earliest deadline of the scheduler's queue is reached, e.g. to plug it into
+ *  the epoll / poll / select event loop. Created once (non-blocking,
+ *  close-on-exec) and armed at the current earliest deadline
+ *
+ *  @note On readiness call @link{scheduler_dispatch_ready_in}: it serves the
+ *  ready tasks, drains the descriptor and re-arms it at the next deadline.
+ *  register_task / change_task_delay re-arm it if the head moves earlier
+ *  ( @see{rearm_scheduler_fd} )
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{fd} of the @link{ptr_scheduler} (
+ *    @see{SCHEDULER_FD_STATE} )
+ *  - implicit dependency on @callback{task_queue_get_next_deadline} (the
+ *    queue backend is set up via @link{TASK_QUEUE_BACKEND})
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {PROMISE_SCHEDULER_FD} - structure of complex type
+ *    @see{PROMISE_SCHEDULER_FD} for details
+ *  @throw PROMISE_SCHEDULER_FD.type = ERROR_CODE
+ *    - PROMISE_SCHEDULER_FD.scheduler_fd_result.CODES_RESULT =>
+ *      - HANDLE_SCHEDULER_FD_NOT_SUPPORTED - no timerfd (Linux only)
+ *      - HANDLE_SCHEDULER_FD_CREATE_ERROR - timerfd_create() failed
+ *      - HANDLE_SCHEDULER_FD_SETTIME_ERROR - timerfd_settime() failed
+ *
+ */
+PROMISE_SCHEDULER_FD get_scheduler_fd_in(Scheduler *ptr_scheduler) {
+#if defined(__linux__)
+  SCHEDULER_FD_STATE *ptr_fd_state = &ptr_scheduler->fd;
+
+  if (ptr_fd_state->scheduler_fd < 0) {
+    ptr_fd_state->scheduler_fd =
+        timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+
+    if (ptr_fd_state->scheduler_fd < 0) {
+      return (PROMISE_SCHEDULER_FD){.type = ERROR_CODE,
+                                    .scheduler_fd_result.CODES_RESULT =
+                                        HANDLE_SCHEDULER_FD_CREATE_ERROR};
+    }
+
+    enum Handle_scheduler_fd_errors_codes code = arm_scheduler_fd(
+        ptr_fd_state, task_queue_get_next_deadline(ptr_scheduler));
+
+    if (code != HANDLE_SCHEDULER_FD_DONE_SUCCESSFULLY) {
+      return (PROMISE_SCHEDULER_FD){.type = ERROR_CODE,
+                                    .scheduler_fd_result.CODES_RESULT = code};
+    }
+  }
+
+  return (PROMISE_SCHEDULER_FD){.type = SUCCESS,
+                                .scheduler_fd_result.FD =
+                                    ptr_fd_state->scheduler_fd};
+#else
+  (void)ptr_scheduler;
+
+  return (PROMISE_SCHEDULER_FD){.type = ERROR_CODE,
+                                .scheduler_fd_result.CODES_RESULT =
+                                    HANDLE_SCHEDULER_FD_NOT_SUPPORTED};
+#endif
+}
+
+/**
+ *  @brief Get the file descriptor (timerfd) of the default scheduler instance
+ *  ( @see{get_scheduler_fd_in} )
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{get_scheduler_fd_in} ones
+ *
+ *  @param {void} - no params expected
+ *
+ *  @return {PROMISE_SCHEDULER_FD} - the same as @link{get_scheduler_fd_in} one
+ *
+ */
+PROMISE_SCHEDULER_FD get_scheduler_fd(void) {
+  return get_scheduler_fd_in(&default_scheduler);
+}
+
+/**
+ *  @brief Close the file descriptor of the @link{get_scheduler_fd_in} (remove
+ *  it from the event loop first). The next @link{get_scheduler_fd_in} call
+ *  creates the new one
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{fd} of the @link{ptr_scheduler} (
+ *    @see{SCHEDULER_FD_STATE} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ */
+void close_scheduler_fd_in(Scheduler *ptr_scheduler) {
+  if (ptr_scheduler->fd.scheduler_fd >= 0) {
+    close(ptr_scheduler->fd.scheduler_fd);
+  }
+
+  ptr_scheduler->fd.scheduler_fd = -1;
+  ptr_scheduler->fd.armed_deadline_ticks = LLONG_MAX;
+}
+
+/**
+ *  @brief Close the file descriptor of the default scheduler instance (
+ *  @see{close_scheduler_fd_in} )
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{close_scheduler_fd_in} ones
+ *
+ *  @param {void} - no params expected
+ *
+ */
+void close_scheduler_fd(void) {
+  close_scheduler_fd_in(&default_scheduler);
+}
+
+/**
+ *  @brief Re-arm the file descriptor of the @link{get_scheduler_fd_in} if the
+ *  given deadline is earlier than the armed one. Costs one comparison if the
+ *  descriptor isn't created (or the deadline is later)
+ *
+ *  @note The later deadlines (e.g. the removed head) are not re-armed: the
+ *  descriptor fires early, @link{scheduler_dispatch_ready_in} serves nothing
+ *  and re-arms it at the actual head
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{fd} of the @link{ptr_scheduler} (
+ *    @see{SCHEDULER_FD_STATE} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_TICKS} deadline_ticks - the registered (or changed) deadline
+ *    (monotonic ns)
+ *
+ *  @return {enum Handle_scheduler_fd_errors_codes} -
+ *  HANDLE_SCHEDULER_FD_DONE_SUCCESSFULLY
+ *  @throw HANDLE_SCHEDULER_FD_SETTIME_ERROR - timerfd_settime() failed
+ *
+ */
+enum Handle_scheduler_fd_errors_codes
+rearm_scheduler_fd(Scheduler *ptr_scheduler, TASK_TICKS deadline_ticks) {
+  SCHEDULER_FD_STATE *ptr_fd_state = &ptr_scheduler->fd;
+
+  if ((ptr_fd_state->scheduler_fd < 0) ||
+      (deadline_ticks >= ptr_fd_state->armed_deadline_ticks)) {
+    return HANDLE_SCHEDULER_FD_DONE_SUCCESSFULLY;
+  }
+
+#if defined(__linux__)
+  return arm_scheduler_fd(ptr_fd_state, deadline_ticks);
+#else
+  return HANDLE_SCHEDULER_FD_NOT_SUPPORTED;
+#endif
+}
+
+/**
+ *  @brief Drain the expirations of the file descriptor of the
+ *  @link{get_scheduler_fd_in} (so it isn't readable anymore) and arm it at
+ *  the current earliest deadline of the scheduler's queue
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{fd} of the @link{ptr_scheduler} (
+ *    @see{SCHEDULER_FD_STATE} )
+ *  - implicit dependency on @callback{task_queue_get_next_deadline} (the
+ *    queue backend is set up via @link{TASK_QUEUE_BACKEND})
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {enum Handle_scheduler_fd_errors_codes} -
+ *  HANDLE_SCHEDULER_FD_DONE_SUCCESSFULLY (nothing to do if the descriptor
+ *  isn't created)
+ *  @throw HANDLE_SCHEDULER_FD_SETTIME_ERROR - timerfd_settime() failed
+ *
+ */
+enum Handle_scheduler_fd_errors_codes
+sync_scheduler_fd(Scheduler *ptr_scheduler) {
+  SCHEDULER_FD_STATE *ptr_fd_state = &ptr_scheduler->fd;
+
+  if (ptr_fd_state->scheduler_fd < 0) {
+    return HANDLE_SCHEDULER_FD_DONE_SUCCESSFULLY;
+  }
+
+#if defined(__linux__)
+  unsigned long long expirations = 0;
+
+  // the one-shot timer has fired => it isn't armed anymore (EAGAIN => still
+  // armed, e.g. the spurious dispatch)
+  if (read(ptr_fd_state->scheduler_fd, &expirations, sizeof(expirations)) ==
+      sizeof(expirations)) {
+    ptr_fd_state->armed_deadline_ticks = LLONG_MAX;
+  }
+
+  TASK_TICKS next_deadline_ticks = task_queue_get_next_deadline(ptr_scheduler);
+
+  if (next_deadline_ticks == ptr_fd_state->armed_deadline_ticks) {
+    return HANDLE_SCHEDULER_FD_DONE_SUCCESSFULLY;
+  }
+
+  return arm_scheduler_fd(ptr_fd_state, next_deadline_ticks);
+#else
+  return HANDLE_SCHEDULER_FD_NOT_SUPPORTED;
+#endif
+}
@@ -0,0 +1,112 @@
+#ifndef HANDLE_SCHEDULER_FD_H
+#define HANDLE_SCHEDULER_FD_H
+
+#include <limits.h>
+
+#include "../environment/config.h"
+
+/**
+ *  @details
+ *  - HANDLE_SCHEDULER_FD_DONE_SUCCESSFULLY - no errors, done successfully
+ *  - HANDLE_SCHEDULER_FD_NOT_SUPPORTED - no timerfd on the platform (Linux
+ *    only)
+ *  - HANDLE_SCHEDULER_FD_CREATE_ERROR - timerfd_create() problems occured
+ *  - HANDLE_SCHEDULER_FD_SETTIME_ERROR - timerfd_settime() problems occured
+ *  - HANDLE_SCHEDULER_FD_TIMESPEC_GET_ERROR - get_now_ticks() monotonic clock
+ *    function problems occured
+ *
+ */
+enum Handle_scheduler_fd_errors_codes {
+  HANDLE_SCHEDULER_FD_DONE_SUCCESSFULLY = 0, /**< no errors */
+  HANDLE_SCHEDULER_FD_NOT_SUPPORTED = 1,     /**< no timerfd (Linux only) */
+  HANDLE_SCHEDULER_FD_CREATE_ERROR = 2,      /**< timerfd_create() failed */
+  HANDLE_SCHEDULER_FD_SETTIME_ERROR = 3,     /**< timerfd_settime() failed */
+  HANDLE_SCHEDULER_FD_TIMESPEC_GET_ERROR =
+      4, /**< get_now_ticks() monotonic clock function problems occured */
+};
+
+/**
+ *  @details
+ *  Union for handling results of @link{get_scheduler_fd} or
+ *  @link{scheduler_dispatch_ready} functions execution. Possible values
+ *  @note only one of is possible!:
+ *  - FD - file descriptor, readable when the tasks are ready
+ *    ( @link{get_scheduler_fd} )
+ *  - DISPATCHED_COUNT - quantity of the served tasks
+ *    ( @link{scheduler_dispatch_ready} )
+ *  - CODES_RESULT - Error codes at the process of the timerfd handling
+ *
+ */
+union Union_scheduler_fd {
+  int FD;                              /**< readable when tasks are ready */
+  unsigned long long DISPATCHED_COUNT; /**< quantity of the served tasks */
+  enum Handle_scheduler_fd_errors_codes
+      CODES_RESULT; /**< Error codes at the process of the timerfd handling */
+};
+
+/**
+ *  @details
+ *  Structure for handling results of @link{get_scheduler_fd} or
+ *  @link{scheduler_dispatch_ready} functions execution.
+ *  - type - (SUCCESS | ERROR_CODE)
+ *  - scheduler_fd_result - union @link{union Union_scheduler_fd}, that is
+ *    FD or DISPATCHED_COUNT (SUCCESS, everything is OK)
+ *    or
+ *    enum @link{enum Handle_scheduler_fd_errors_codes} for ERROR_CODE
+ *
+ *  @example
+ *    PROMISE_SCHEDULER_FD log_fd = get_scheduler_fd();
+ *
+ *    switch (log_fd.type) {
+ *    case SUCCESS:
+ *      epoll_ctl(epoll_fd, EPOLL_CTL_ADD, log_fd.scheduler_fd_result.FD,
+ *        &(struct epoll_event){.events = EPOLLIN});
+ *      break;
+ *    case ERROR_CODE:
+ *      printf("ERROR_CODE: %hd\n", log_fd.scheduler_fd_result.CODES_RESULT);
+ *      OUTPUT: e.g. HANDLE_SCHEDULER_FD_NOT_SUPPORTED
+ *      break;
+ *    default:
+ *      fprintf(stderr, "Error(%s() function at %d): ups... Unknown
+ *        log_fd.type\n", __func__, __LINE__);
+ *      break;
+ *    }
+ *
+ */
+typedef struct s_Handle_scheduler_fd_result {
+  PROMISE_TYPE type; /**< SUCCESS | ERROR_CODE */
+  union Union_scheduler_fd
+      scheduler_fd_result; /**< FD | DISPATCHED_COUNT | CODES_RESULT */
+} PROMISE_SCHEDULER_FD;
+
+/**
+ *  @details
+ *  The timerfd state of the scheduler instance ( @see{Scheduler},
+ *  @see{get_scheduler_fd_in} )
+ *  - int scheduler_fd - timerfd, -1 => not created
+ *  - TASK_TICKS armed_deadline_ticks - the deadline (ns) the
+ *    @link{scheduler_fd} is armed at, LLONG_MAX => disarmed
+ *
+ */
+typedef struct s_Scheduler_fd_state {
+  int scheduler_fd;                /**< timerfd, -1 => not created */
+  TASK_TICKS armed_deadline_ticks; /**< LLONG_MAX => disarmed */
+} SCHEDULER_FD_STATE;
+
+/**
+ *  @brief Static initializer of the @type{SCHEDULER_FD_STATE} (not created)
+ *
+ */
+#define SCHEDULER_FD_STATE_INITIALIZER                                         \
+  {.scheduler_fd = -1, .armed_deadline_ticks = LLONG_MAX}
+
+PROMISE_SCHEDULER_FD get_scheduler_fd_in(Scheduler *ptr_scheduler);
+PROMISE_SCHEDULER_FD get_scheduler_fd(void);
+void close_scheduler_fd_in(Scheduler *ptr_scheduler);
+void close_scheduler_fd(void);
+enum Handle_scheduler_fd_errors_codes
+rearm_scheduler_fd(Scheduler *ptr_scheduler, TASK_TICKS deadline_ticks);
+enum Handle_scheduler_fd_errors_codes
+sync_scheduler_fd(Scheduler *ptr_scheduler);
+
+#endif
@@ -0,0 +1,246 @@
+#include <limits.h>
+#include <stdatomic.h>
+
+#include "../environment/config.h"
+#include "../environment/global_variables.h"
+#include "./handle_shards_config.h"
+#include "./task_queue_config.h"
+
+#if TASK_SHARDED
+/**
+ *  @details
+ *  States of the shard's slot in the global view
+ *  - SHARD_FREE - not claimed by any thread
+ *  - SHARD_CLAIMED - claimed, the head isn't published yet
+ *  - SHARD_ACTIVE - claimed, the head is published
+ *
+ */
+enum Shard_states {
+  SHARD_FREE = 0,    /**< not claimed by any thread */
+  SHARD_CLAIMED = 1, /**< claimed, the head isn't published yet */
+  SHARD_ACTIVE = 2,  /**< claimed, the head is published */
+};
+
+/**
+ *  @details
+ *  The shard's slot in the global view, one cache line per slot (the owner
+ *  threads write their heads without the false sharing)
+ *  - head_ticks - the published earliest pending deadline (ns)
+ *  - state - @see{enum Shard_states}
+ *
+ */
+typedef struct s_Shard_slot {
+  _Alignas(64) _Atomic TASK_TICKS head_ticks; /**< the published head (ns) */
+  _Atomic unsigned char state;                /**< @see{enum Shard_states} */
+} SHARD_SLOT;
+
+// @note the global view: written by the owner threads, read by any thread
+static SHARD_SLOT shard_slots[TASK_SHARDS_MAX];
+/**< 1 + the highest index ever claimed, the views scan [0; high water) */
+static _Atomic int shards_high_water = 0;
+
+static TASK_SHARD_LOCAL int shard_index = -1; /**< -1 => not claimed */
+#endif
+
+/**
+ *  @brief Claim the shard's slot of the calling thread in the global
+ *  "earliest ready" view (once per thread, the next calls return the same
+ *  index). Called implicitly by the first controller call of the thread
+ *  ( @see{publish_shard_head} )
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer (encapsulated in the module) @link{shard_slots}
+ *  - mutates the outer (encapsulated in the module)
+ *    @link{shards_high_water}
+ *  - mutates the outer (encapsulated in the module) @link{shard_index}
+ *
+ *  @note Lock-free: one CAS per probed slot. Without @link{TASK_SHARDED}
+ *  there is the only shard (index 0)
+ *
+ *  @param {void} - no params expected
+ *
+ *  @return {PROMISE_SHARD} - structure of complex type
+ *    @see{PROMISE_SHARD} for details, SHARD_INDEX for SUCCESS
+ *  @throw PROMISE_SHARD.type = ERROR_CODE
+ *    - PROMISE_SHARD.shards_result.CODES_RESULT =>
+ *      - HANDLE_SHARDS_ARE_FULL - all the @link{TASK_SHARDS_MAX} shards are
+ *        claimed by the other threads (the thread's tasks still run, but
+ *        they're not in the global view)
+ *
+ */
+PROMISE_SHARD claim_shard(void) {
+#if TASK_SHARDED
+  for (int i = 0; (shard_index < 0) && (i < TASK_SHARDS_MAX); i += 1) {
+    unsigned char expected_state = SHARD_FREE;
+
+    if (atomic_compare_exchange_strong(&shard_slots[i].state, &expected_state,
+                                       SHARD_CLAIMED)) {
+      shard_index = i;
+    }
+  }
+
+  if (shard_index < 0) {
+    return (PROMISE_SHARD){.type = ERROR_CODE,
+                           .shards_result.CODES_RESULT =
+                               HANDLE_SHARDS_ARE_FULL};
+  }
+
+  if (atomic_load_explicit(&shard_slots[shard_index].state,
+                           memory_order_relaxed) == SHARD_CLAIMED) {
+    atomic_store_explicit(&shard_slots[shard_index].head_ticks,
+                          task_queue_get_next_deadline(&default_scheduler),
+                          memory_order_relaxed);
+    atomic_store_explicit(&shard_slots[shard_index].state, SHARD_ACTIVE,
+                          memory_order_release);
+
+    int high_water = atomic_load(&shards_high_water);
+
+    while ((high_water <= shard_index) &&
+           !atomic_compare_exchange_weak(&shards_high_water, &high_water,
+                                         shard_index + 1)) {
+    }
+  }
+
+  return (PROMISE_SHARD){.type = SUCCESS,
+                         .shards_result.SHARD_INDEX = shard_index};
+#else
+  return (PROMISE_SHARD){.type = SUCCESS, .shards_result.SHARD_INDEX = 0};
+#endif
+}
+
+/**
+ *  @brief Release the shard's slot of the calling thread (call it before the
+ *  thread exits), so the slot is reused by the next thread
+ *
+ *  @note The pending tasks of the shard are dropped with the thread's
+ *  storage, drain them before ( @see{run_ready_tasks} )
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer (encapsulated in the module) @link{shard_slots}
+ *  - mutates the outer (encapsulated in the module) @link{shard_index}
+ *
+ *  @param {void} - no params expected
+ *
+ */
+void release_shard(void) {
+#if TASK_SHARDED
+  if (shard_index < 0) {
+    return;
+  }
+
+  atomic_store_explicit(&shard_slots[shard_index].head_ticks, LLONG_MAX,
+                        memory_order_relaxed);
+  atomic_store_explicit(&shard_slots[shard_index].state, SHARD_FREE,
+                        memory_order_release);
+  shard_index = -1;
+#endif
+}
+
+/**
+ *  @brief Publish the earliest pending deadline of the calling thread's
+ *  shard to the global view (claims the shard at the first call). Called by
+ *  every controller after its' handler function with the scheduler it has
+ *  worked with
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer (encapsulated in the module) @link{shard_slots}
+ *  - implicit dependency on @callback{claim_shard}
+ *  - implicit dependency on @callback{task_queue_get_next_deadline} (the
+ *    queue backend is set up via @link{TASK_QUEUE_BACKEND})
+ *
+ *  @note One relaxed atomic store. No-op without @link{TASK_SHARDED} (the
+ *  global view reads the default queue directly) and for the caller-provided
+ *  scheduler instances (only the thread's default instance is its' shard)
+ *
+ *  @param {const Scheduler *} ptr_scheduler - the scheduler instance the
+ *    controller has worked with
+ *
+ */
+void publish_shard_head(const Scheduler *ptr_scheduler) {
+#if TASK_SHARDED
+  if (ptr_scheduler != &default_scheduler) {
+    return;
+  }
+
+  if ((shard_index < 0) && (claim_shard().type == ERROR_CODE)) {
+    return;
+  }
+
+  atomic_store_explicit(&shard_slots[shard_index].head_ticks,
+                        task_queue_get_next_deadline(ptr_scheduler),
+                        memory_order_relaxed);
+#else
+  (void)ptr_scheduler;
+#endif
+}
+
+/**
+ *  @brief Get the shard with the earliest pending deadline i.e. merge the
+ *  shards' heads (the global "earliest ready" view). Safe to call from any
+ *  thread
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on (encapsulated in the module) @link{shard_slots}
+ *  - implicit dependency on (encapsulated in the module)
+ *    @link{shards_high_water}
+ *  - implicit dependency on @callback{task_queue_get_next_deadline} (without
+ *    @link{TASK_SHARDED} only)
+ *
+ *  @note O(shards) relaxed loads, no locks. The heads are published after
+ *  the controllers' calls, so the view may lag behind the shard being
+ *  changed right now. The timing wheel publishes the slot start (lower
+ *  bound) of the head ( @see{task_queue_get_next_deadline} )
+ *
+ *  @param {void} - no params expected
+ *
+ *  @return {PROMISE_SHARD} - structure of complex type
+ *    @see{PROMISE_SHARD} for details, HEAD for SUCCESS
+ *  @throw PROMISE_SHARD.type = ERROR_CODE
+ *    - PROMISE_SHARD.shards_result.CODES_RESULT =>
+ *      - HANDLE_SHARDS_ARE_EMPTY - no pending tasks at any shard
+ *
+ *  @example
+ *    PROMISE_SHARD log_shard = get_earliest_shard();
+ *    => log_shard.shards_result.HEAD {
+ *      SHARD_INDEX: 3;
+ *      DEADLINE_TICKS: 406291136;
+ *    }
+ *
+ */
+PROMISE_SHARD get_earliest_shard(void) {
+  SHARD_HEAD earliest_head = {.SHARD_INDEX = -1,
+                              .DEADLINE_TICKS = LLONG_MAX};
+
+#if TASK_SHARDED
+  int high_water = atomic_load(&shards_high_water);
+
+  for (int i = 0; i < high_water; i += 1) {
+    if (atomic_load_explicit(&shard_slots[i].state, memory_order_acquire) !=
+        SHARD_ACTIVE) {
+      continue;
+    }
+
+    TASK_TICKS head_ticks =
+        atomic_load_explicit(&shard_slots[i].head_ticks, memory_order_relaxed);
+
+    if (head_ticks < earliest_head.DEADLINE_TICKS) {
+      earliest_head = (SHARD_HEAD){.SHARD_INDEX = i,
+                                   .DEADLINE_TICKS = head_ticks};
+    }
+  }
+#else
+  earliest_head = (SHARD_HEAD){.SHARD_INDEX = 0,
+                               .DEADLINE_TICKS =
+                                   task_queue_get_next_deadline(
+                                       &default_scheduler)};
+#endif
+
+  if (earliest_head.DEADLINE_TICKS == LLONG_MAX) {
+    return (PROMISE_SHARD){.type = ERROR_CODE,
+                           .shards_result.CODES_RESULT =
+                               HANDLE_SHARDS_ARE_EMPTY};
+  }
+
+  return (PROMISE_SHARD){.type = SUCCESS,
+                         .shards_result.HEAD = earliest_head};
+}
@@ -0,0 +1,90 @@
+#ifndef HANDLE_SHARDS_CONFIG_H
+#define HANDLE_SHARDS_CONFIG_H
+
+#include "../environment/config.h"
+
+/**
+ *  @details
+ *  - HANDLE_SHARDS_DONE_SUCCESSFULLY - no errors, done successfully
+ *  - HANDLE_SHARDS_ARE_FULL - all the @link{TASK_SHARDS_MAX} shards are
+ *    claimed by the other threads
+ *  - HANDLE_SHARDS_ARE_EMPTY - no pending tasks at any shard
+ *
+ */
+enum Handle_shards_errors_codes {
+  HANDLE_SHARDS_DONE_SUCCESSFULLY = 0, /**< no errors, done successfully */
+  HANDLE_SHARDS_ARE_FULL = 1,  /**< all TASK_SHARDS_MAX shards are claimed */
+  HANDLE_SHARDS_ARE_EMPTY = 2, /**< no pending tasks at any shard */
+};
+
+/**
+ *  @details
+ *  The head of the shard in the global "earliest ready" view
+ *  - SHARD_INDEX - index of the shard (thread) in the view
+ *  - DEADLINE_TICKS - the earliest pending deadline (monotonic ns) of the
+ *    shard ( @see{task_queue_get_next_deadline} )
+ *
+ */
+typedef struct s_Shard_head {
+  int SHARD_INDEX;           /**< index of the shard (thread) in the view */
+  TASK_TICKS DEADLINE_TICKS; /**< the earliest pending deadline (ns) */
+} SHARD_HEAD;
+
+/**
+ *  @details
+ *  Union for handling results of @link{claim_shard} or
+ *  @link{get_earliest_shard} functions execution. Possible values
+ *  @note only one of is possible!:
+ *  - SHARD_INDEX - index of the calling thread's shard ( @link{claim_shard} )
+ *  - HEAD - @link{SHARD_HEAD} of the earliest shard
+ *    ( @link{get_earliest_shard} )
+ *  - CODES_RESULT - Error codes at the process of the shards handling
+ *
+ */
+union Union_shards {
+  int SHARD_INDEX; /**< index of the calling thread's shard */
+  SHARD_HEAD HEAD; /**< the earliest shard's head */
+  enum Handle_shards_errors_codes
+      CODES_RESULT; /**< Error codes at the process of the shards handling */
+};
+
+/**
+ *  @details
+ *  Structure for handling results of @link{claim_shard} or
+ *  @link{get_earliest_shard} functions execution.
+ *  - type - (SUCCESS | ERROR_CODE)
+ *  - shards_result - union @link{union Union_shards}, that is SHARD_INDEX or
+ *    HEAD (SUCCESS, everything is OK)
+ *    or
+ *    enum @link{enum Handle_shards_errors_codes} for ERROR_CODE
+ *
+ *  @example
+ *    PROMISE_SHARD log_shard = get_earliest_shard();
+ *
+ *    switch (log_shard.type) {
+ *    case SUCCESS:
+ *      printf("%d\n", log_shard.shards_result.HEAD.SHARD_INDEX);
+ *      OUTPUT: e.g. 3 (the thread of the shard 3 has got the earliest task)
+ *      break;
+ *    case ERROR_CODE:
+ *      printf("ERROR_CODE: %hd\n", log_shard.shards_result.CODES_RESULT);
+ *      OUTPUT: e.g. HANDLE_SHARDS_ARE_EMPTY
+ *      break;
+ *    default:
+ *      fprintf(stderr, "Error(%s() function at %d): ups... Unknown
+ *        log_shard.type\n", __func__, __LINE__);
+ *      break;
+ *    }
+ *
+ */
+typedef struct s_Handle_shards_result {
+  PROMISE_TYPE type; /**< SUCCESS | ERROR_CODE */
+  union Union_shards shards_result; /**< SHARD_INDEX | HEAD | CODES_RESULT */
+} PROMISE_SHARD;
+
+PROMISE_SHARD claim_shard(void);
+void release_shard(void);
+void publish_shard_head(const Scheduler *ptr_scheduler);
+PROMISE_SHARD get_earliest_shard(void);
+
+#endif
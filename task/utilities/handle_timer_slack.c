@@ -0,0 +1,71 @@
+#include "../environment/config.h"
+#include "../environment/scheduler_config.h"
+#include "./handle_timer_slack_config.h"
+#include "./utils.h"
+
+/**
+ *  @brief Set up the slack (ms) of the task, i.e. the deadlines of its'
+ *  reschedules ( @see{task_queue_reschedule} ) are coalesced too
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{slacks} of the @link{ptr_scheduler} (
+ *    @see{TASK_SLACKS_STATE} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} id - id of the task in range
+ *    [0; MAX_TASK_QUANTITY - 1]
+ *  @param {TASK_DELAY} slack - slack (ms) of the task, 0 => exact deadline
+ *
+ *  @example
+ *    set_task_slack(&default_scheduler, 2, 10);
+ *    => the task with id 2 is served up to 10 ms after its' deadline
+ *
+ */
+void set_task_slack(Scheduler *ptr_scheduler, TASK_COUNTER id,
+                    TASK_DELAY slack) {
+  ptr_scheduler->slacks.task_slacks[id] = slack;
+}
+
+/**
+ *  @brief Get the moment of the window [@link{deadline_ticks};
+ *  @link{deadline_ticks} + @link{slack}] with the most trailing zero bits,
+ *  i.e. the one shared with the most windows of the nearby deadlines, so
+ *  their tasks are due at the same moment (one wakeup, one batch drain)
+ *
+ *  @note The windows of the same width overlapping at the power of two
+ *  boundary (ns) are moved to it, the lateness is @link{slack} at most.
+ *  Pure function, O(1).
+ *
+ *  @param {TASK_TICKS} deadline_ticks - the exact deadline (ns)
+ *  @param {TASK_DELAY} slack - slack (ms), 0 => the exact deadline
+ *
+ *  @return {TASK_TICKS} - the coalesced deadline (ns) in range
+ *    [@link{deadline_ticks}; @link{deadline_ticks} + @link{slack}]
+ *
+ *  @example
+ *    get_coalesced_deadline_ticks(1'000'000'000, 10)
+ *    => 1'006'632'960 (0x3C000000, the window ends at 0x3C336080)
+ *
+ */
+TASK_TICKS get_coalesced_deadline_ticks(TASK_TICKS deadline_ticks,
+                                        TASK_DELAY slack) {
+  if (slack == 0) {
+    return deadline_ticks;
+  }
+
+  // saturated at LLONG_MAX ( @see{get_task_deadline_ticks} )
+  TASK_TICKS latest_ticks = get_task_deadline_ticks(deadline_ticks, slack);
+  unsigned long long differing_bits =
+      (unsigned long long)(deadline_ticks ^ latest_ticks);
+
+  if (differing_bits == 0) {
+    return deadline_ticks;
+  }
+
+  // the window's ends differ at the highest bit first => the end with the
+  // lower bits cleared is still in the window
+  unsigned long long low_bits_mask =
+      (1ULL << (63 - __builtin_clzll(differing_bits))) - 1;
+
+  return latest_ticks & ~(TASK_TICKS)low_bits_mask;
+}
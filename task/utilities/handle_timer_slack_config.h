@@ -0,0 +1,26 @@
+#ifndef HANDLE_TIMER_SLACK_H
+#define HANDLE_TIMER_SLACK_H
+
+#include "../environment/config.h"
+
+/**
+ *  @details
+ *  The timer slack of the tasks of the scheduler instance ( @see{Scheduler}
+ *  ), indexed via the task id (both task records, all the queue backends).
+ *  The task with the slack may be served at any moment of [deadline;
+ *  deadline + slack], so its' deadline is moved to the "roundest" moment of
+ *  that window ( @see{get_coalesced_deadline_ticks} ) and the nearby tasks
+ *  share one wakeup and one batch drain
+ *  - task_slacks - id => slack (ms) of the task, 0 => exact deadline
+ *
+ */
+typedef struct s_Task_slacks_state {
+  TASK_DELAY task_slacks[MAX_TASK_QUANTITY]; /**< id => slack (ms) */
+} TASK_SLACKS_STATE;
+
+void set_task_slack(Scheduler *ptr_scheduler, TASK_COUNTER id,
+                    TASK_DELAY slack);
+TASK_TICKS get_coalesced_deadline_ticks(TASK_TICKS deadline_ticks,
+                                        TASK_DELAY slack);
+
+#endif
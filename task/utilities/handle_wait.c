@@ -0,0 +1,368 @@
+// POSIX declarations (pthread_condattr_setclock, clock_gettime) for the
+// strict -std=c23 builds
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "../environment/config.h"
+#include "../environment/global_variables.h"
+#include "./handle_clock_config.h"
+#include "./handle_command_ring_config.h"
+#include "./handle_wait_config.h"
+#include "./task_queue_config.h"
+
+#if defined(CLOCK_MONOTONIC)
+#define HANDLE_WAIT_CLOCK_ID CLOCK_MONOTONIC
+#else
+#define HANDLE_WAIT_CLOCK_ID CLOCK_REALTIME
+#endif
+
+/**
+ *  @brief Utility function (encapsulated) to initialize the condition variable
+ *  of the waiter on the monotonic clock (once, under the @link{wait_mutex})
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{wait_cond} and @link{is_cond_initialized} of the
+ *    @link{ptr_waiter}
+ *
+ *  @param {DEADLINE_WAITER *} ptr_waiter - the waiter of the scheduler
+ *
+ */
+static void init_wait_cond(DEADLINE_WAITER *ptr_waiter) {
+  if (ptr_waiter->is_cond_initialized) {
+    return;
+  }
+
+  pthread_condattr_t cond_attr;
+
+  pthread_condattr_init(&cond_attr);
+  pthread_condattr_setclock(&cond_attr, HANDLE_WAIT_CLOCK_ID);
+  pthread_cond_init(&ptr_waiter->wait_cond, &cond_attr);
+  pthread_condattr_destroy(&cond_attr);
+
+  ptr_waiter->is_cond_initialized = true;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to convert the monotonic timestamp
+ *  (ns) to the absolute timeout of the @link{wait_cond} clock
+ *
+ *  @note The clock sources may differ (e.g. QueryPerformanceCounter on
+ *  Windows), so the remaining time is added to the condition's clock
+ *
+ *  @param {TASK_TICKS} until_ticks - monotonic timestamp (ns) to wake up at
+ *  @param {TASK_TICKS} now_ticks - current monotonic timestamp (ns)
+ *
+ *  @return {struct timespec} - absolute timeout
+ *
+ */
+static struct timespec get_wait_timespec(TASK_TICKS until_ticks,
+                                         TASK_TICKS now_ticks) {
+  struct timespec ts = {};
+  clock_gettime(HANDLE_WAIT_CLOCK_ID, &ts);
+
+  TASK_TICKS remaining_ticks = until_ticks - now_ticks;
+
+  ts.tv_sec += remaining_ticks / RATIO_SEC_NANOSEC;
+  ts.tv_nsec += remaining_ticks % RATIO_SEC_NANOSEC;
+
+  if (ts.tv_nsec >= RATIO_SEC_NANOSEC) {
+    ts.tv_sec += 1;
+    ts.tv_nsec -= RATIO_SEC_NANOSEC;
+  }
+
+  return ts;
+}
+
+/**
+ *  @brief Block the calling thread till the earliest deadline of the
+ *  scheduler's queue (no polling), till an earlier deadline is registered by
+ *  the other thread ( @see{notify_new_deadline_in} ) or till
+ *  @link{max_wait_ms} is gone. The queue is read under the caller's
+ *  @link{ptr_queue_mutex}, that is released while the thread sleeps (the same
+ *  as pthread_cond_wait does)
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{wait} of the @link{ptr_scheduler} (
+ *    @see{DEADLINE_WAITER} )
+ *  - mutates the outer @link{ptr_queue_mutex} (unlocked while sleeping)
+ *  - implicit dependency on the @link{clock} of the @link{ptr_scheduler}
+ *  - implicit dependency on @callback{get_now_ticks_in}
+ *  - implicit dependency on @callback{is_task_command_pending}
+ *  - implicit dependency on @callback{task_queue_advance} and
+ *    @callback{task_queue_get_next_deadline} (the queue backend is set up via
+ *    @link{TASK_QUEUE_BACKEND})
+ *
+ *  @note The queue itself is not synchronized: the caller must hold
+ *  @link{ptr_queue_mutex} on the call (it is held again on the return) and the
+ *  other threads must call register_task / change_task_delay under the same
+ *  mutex. NULL => the queue is touched by the calling thread only (the other
+ *  threads submit the commands to the ring, @see{submit_register_task}).
+ *  @note Lock order: @link{ptr_queue_mutex} before the waiter's mutex, so the
+ *  other threads may notify while holding the queue mutex.
+ *  @note In the sharded mode ( @see{TASK_SHARDED} ) the thread waits for the
+ *  deadlines of its' own shard (the other threads register to theirs).
+ *  @note Every scheduler instance has its' own waiter, so one thread may
+ *  serve only one instance at a time via this function.
+ *  @note Inside the opened tick ( @see{begin_clock_tick} ) the cached
+ *  timestamp doesn't move, so the deadline would be waited for forever =>
+ *  the call fails at once.
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {pthread_mutex_t *} ptr_queue_mutex - the mutex guarding the queue
+ *    (locked by the caller) or NULL
+ *  @param {TASK_DELAY} max_wait_ms - max time (ms) to block, e.g.
+ *    @link{HANDLE_WAIT_FOREVER}
+ *
+ *  @return {PROMISE_WAIT} - structure of complex type @see{PROMISE_WAIT}
+ *  @throw PROMISE_WAIT.type = ERROR_CODE
+ *    - PROMISE_WAIT.CODES_RESULT => HANDLE_WAIT_TIMESPEC_GET_ERROR - problems
+ *      occured at @link{get_now_ticks}() function calling
+ *    - PROMISE_WAIT.CODES_RESULT => HANDLE_WAIT_TICK_OPENED - the clock tick
+ *      of the @link{ptr_scheduler} is opened ( @see{end_clock_tick_in} )
+ *
+ *  @example
+ *    pthread_mutex_lock(&queue_mutex);
+ *    while (true) {
+ *      wait_next_deadline_locked_in(&scheduler, &queue_mutex,
+ *                                   HANDLE_WAIT_FOREVER); => wakes up locked
+ *      while ((log_task = get_callback_in(&scheduler)).type == SUCCESS) {...}
+ *    }
+ *
+ */
+PROMISE_WAIT wait_next_deadline_locked_in(Scheduler *ptr_scheduler,
+                                          pthread_mutex_t *ptr_queue_mutex,
+                                          TASK_DELAY max_wait_ms) {
+  DEADLINE_WAITER *ptr_waiter = &ptr_scheduler->wait;
+
+  // the cached timestamp of the opened tick never reaches the deadline
+  if (ptr_scheduler->clock.is_tick_opened) {
+    return (PROMISE_WAIT){.type = ERROR_CODE,
+                          .CODES_RESULT = HANDLE_WAIT_TICK_OPENED};
+  }
+
+  PROMISE_CLOCK_TICKS log_ticks = get_now_ticks_in(ptr_scheduler);
+
+  if (log_ticks.type == ERROR_CODE) {
+    return (PROMISE_WAIT){.type = ERROR_CODE,
+                          .CODES_RESULT = HANDLE_WAIT_TIMESPEC_GET_ERROR};
+  }
+
+  TASK_TICKS now_ticks = log_ticks.handle_clock_result.TICKS;
+
+  // saturate the limit at LLONG_MAX (i.e. "never")
+  TASK_TICKS limit_ticks = LLONG_MAX;
+  if (max_wait_ms <= (TASK_DELAY)(LLONG_MAX - now_ticks) / RATIO_NANOSEC_MSEC) {
+    limit_ticks = now_ticks + (TASK_TICKS)max_wait_ms * RATIO_NANOSEC_MSEC;
+  }
+
+  while (true) {
+    // let the notifiers wake up for any deadline while the queue is read, so
+    // no notification between reading and sleeping is lost
+    pthread_mutex_lock(&ptr_waiter->wait_mutex);
+    init_wait_cond(ptr_waiter);
+    atomic_store(&ptr_waiter->waited_deadline_ticks, LLONG_MAX);
+    unsigned long long started_sequence = ptr_waiter->wake_sequence;
+    pthread_mutex_unlock(&ptr_waiter->wait_mutex);
+
+    // the commands submitted by the other threads are applied first
+    // ( @see{apply_task_commands_in} )
+    if (is_task_command_pending(ptr_scheduler)) {
+      atomic_store(&ptr_waiter->waited_deadline_ticks, LLONG_MIN);
+
+      return (PROMISE_WAIT){.type = SUCCESS,
+                            .CODES_RESULT = HANDLE_WAIT_NOTIFIED};
+    }
+
+    // the timing wheel gives the start of the next occupied slot (a lower
+    // bound of the deadline) => advance it and wait again till the deadline
+    task_queue_advance(ptr_scheduler, now_ticks);
+    TASK_TICKS next_deadline_ticks =
+        task_queue_get_next_deadline(ptr_scheduler);
+
+    if (next_deadline_ticks <= now_ticks) {
+      atomic_store(&ptr_waiter->waited_deadline_ticks, LLONG_MIN);
+
+      return (PROMISE_WAIT){.type = SUCCESS,
+                            .CODES_RESULT = HANDLE_WAIT_DONE_SUCCESSFULLY};
+    }
+
+    if (limit_ticks <= now_ticks) {
+      atomic_store(&ptr_waiter->waited_deadline_ticks, LLONG_MIN);
+
+      return (PROMISE_WAIT){.type = SUCCESS,
+                            .CODES_RESULT = HANDLE_WAIT_TIMEOUT};
+    }
+
+    TASK_TICKS until_ticks =
+        next_deadline_ticks < limit_ticks ? next_deadline_ticks : limit_ticks;
+
+    pthread_mutex_lock(&ptr_waiter->wait_mutex);
+
+    // the waiter's mutex is held => the registrations from now on notify
+    // after the sleep has started
+    if (ptr_queue_mutex != NULL) {
+      pthread_mutex_unlock(ptr_queue_mutex);
+    }
+
+    if (ptr_waiter->wake_sequence == started_sequence) {
+      // from now on only the earlier deadlines wake up
+      atomic_store(&ptr_waiter->waited_deadline_ticks, next_deadline_ticks);
+
+      struct timespec wait_ts = get_wait_timespec(until_ticks, now_ticks);
+
+      while (ptr_waiter->wake_sequence == started_sequence) {
+        if (pthread_cond_timedwait(&ptr_waiter->wait_cond,
+                                   &ptr_waiter->wait_mutex,
+                                   &wait_ts) == ETIMEDOUT) {
+          break;
+        }
+      }
+    }
+
+    bool is_notified = ptr_waiter->wake_sequence != started_sequence;
+    atomic_store(&ptr_waiter->waited_deadline_ticks, LLONG_MIN);
+    pthread_mutex_unlock(&ptr_waiter->wait_mutex);
+
+    if (ptr_queue_mutex != NULL) {
+      pthread_mutex_lock(ptr_queue_mutex);
+    }
+
+    if (is_notified) {
+      return (PROMISE_WAIT){.type = SUCCESS,
+                            .CODES_RESULT = HANDLE_WAIT_NOTIFIED};
+    }
+
+    log_ticks = get_now_ticks_in(ptr_scheduler);
+
+    if (log_ticks.type == ERROR_CODE) {
+      return (PROMISE_WAIT){.type = ERROR_CODE,
+                            .CODES_RESULT = HANDLE_WAIT_TIMESPEC_GET_ERROR};
+    }
+
+    now_ticks = log_ticks.handle_clock_result.TICKS;
+  }
+}
+
+/**
+ *  @brief Block the calling thread till the earliest deadline of the
+ *  scheduler's queue touched by the calling thread only (
+ *  @see{wait_next_deadline_locked_in} with no queue mutex)
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{wait_next_deadline_locked_in} ones
+ *
+ *  @note The other threads may not call register_task / change_task_delay of
+ *  this instance, they submit the commands to the ring (
+ *  @see{submit_register_task} ) or the waiting thread must use
+ *  @link{wait_next_deadline_locked_in}.
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_DELAY} max_wait_ms - max time (ms) to block, e.g.
+ *    @link{HANDLE_WAIT_FOREVER}
+ *
+ *  @return {PROMISE_WAIT} - the same as @link{wait_next_deadline_locked_in}
+ *    one
+ *
+ *  @example
+ *    while (true) {
+ *      wait_next_deadline_in(&scheduler, HANDLE_WAIT_FOREVER); => wakes up
+ *      while ((log_task = get_callback_in(&scheduler)).type == SUCCESS) {...}
+ *    }
+ *
+ */
+PROMISE_WAIT wait_next_deadline_in(Scheduler *ptr_scheduler,
+                                   TASK_DELAY max_wait_ms) {
+  return wait_next_deadline_locked_in(ptr_scheduler, NULL, max_wait_ms);
+}
+
+/**
+ *  @brief Block the calling thread till the earliest deadline of the default
+ *  scheduler instance ( @see{wait_next_deadline_in} )
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{wait_next_deadline_in} ones
+ *
+ *  @param {TASK_DELAY} max_wait_ms - max time (ms) to block, e.g.
+ *    @link{HANDLE_WAIT_FOREVER}
+ *
+ *  @return {PROMISE_WAIT} - the same as @link{wait_next_deadline_in} one
+ *
+ */
+PROMISE_WAIT wait_next_deadline(TASK_DELAY max_wait_ms) {
+  return wait_next_deadline_in(&default_scheduler, max_wait_ms);
+}
+
+/**
+ *  @brief Block the calling thread till the earliest deadline of the default
+ *  scheduler instance, the queue is guarded by the caller's mutex (
+ *  @see{wait_next_deadline_locked_in} )
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{wait_next_deadline_locked_in} ones
+ *
+ *  @param {pthread_mutex_t *} ptr_queue_mutex - the mutex guarding the queue
+ *    (locked by the caller) or NULL
+ *  @param {TASK_DELAY} max_wait_ms - max time (ms) to block, e.g.
+ *    @link{HANDLE_WAIT_FOREVER}
+ *
+ *  @return {PROMISE_WAIT} - the same as @link{wait_next_deadline_locked_in}
+ *    one
+ *
+ */
+PROMISE_WAIT wait_next_deadline_locked(pthread_mutex_t *ptr_queue_mutex,
+                                       TASK_DELAY max_wait_ms) {
+  return wait_next_deadline_locked_in(&default_scheduler, ptr_queue_mutex,
+                                      max_wait_ms);
+}
+
+/**
+ *  @brief Wake up the thread blocked in the @link{wait_next_deadline_in} of
+ *  the scheduler if the given deadline is earlier than the one it sleeps
+ *  till. Costs one atomic load if nobody waits (or the deadline is later)
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer @link{wake_sequence} of the @link{ptr_scheduler}'s
+ *    waiter ( @see{DEADLINE_WAITER} )
+ *  - implicit dependency on the @link{waited_deadline_ticks} of the waiter
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_TICKS} deadline_ticks - the registered (or changed) deadline
+ *    (monotonic ns)
+ *
+ */
+void notify_new_deadline_in(Scheduler *ptr_scheduler,
+                            TASK_TICKS deadline_ticks) {
+  DEADLINE_WAITER *ptr_waiter = &ptr_scheduler->wait;
+
+  if (deadline_ticks >= atomic_load(&ptr_waiter->waited_deadline_ticks)) {
+    return;
+  }
+
+  pthread_mutex_lock(&ptr_waiter->wait_mutex);
+  ptr_waiter->wake_sequence += 1;
+
+  // nobody has waited yet => no condition variable to signal
+  if (ptr_waiter->is_cond_initialized) {
+    pthread_cond_signal(&ptr_waiter->wait_cond);
+  }
+
+  pthread_mutex_unlock(&ptr_waiter->wait_mutex);
+}
+
+/**
+ *  @brief Wake up the waiter of the default scheduler instance (
+ *  @see{notify_new_deadline_in} )
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{notify_new_deadline_in} ones
+ *
+ *  @param {TASK_TICKS} deadline_ticks - the registered (or changed) deadline
+ *    (monotonic ns)
+ *
+ */
+void notify_new_deadline(TASK_TICKS deadline_ticks) {
+  notify_new_deadline_in(&default_scheduler, deadline_ticks);
+}
@@ -0,0 +1,119 @@
+#ifndef HANDLE_WAIT_H
+#define HANDLE_WAIT_H
+
+#include <limits.h>
+#include <pthread.h>
+
+#include "../environment/config.h"
+
+/**
+ *  @brief max_wait_ms value of the @link{wait_next_deadline} to wait with no
+ *  limit (till the earliest deadline or till the notification)
+ *
+ */
+#define HANDLE_WAIT_FOREVER ULLONG_MAX
+
+/**
+ *  @details
+ *  - HANDLE_WAIT_DONE_SUCCESSFULLY - the earliest deadline is reached, the
+ *    tasks are ready to be served
+ *  - HANDLE_WAIT_NOTIFIED - woken up early: an earlier deadline was
+ *    registered (or changed to) by the other thread or the commands are
+ *    submitted to the ring ( @see{submit_register_task} )
+ *  - HANDLE_WAIT_TIMEOUT - max_wait_ms is gone before the earliest deadline
+ *  - HANDLE_WAIT_TIMESPEC_GET_ERROR - get_now_ticks() monotonic clock function
+ *    problems occured
+ *  - HANDLE_WAIT_TICK_OPENED - called inside the opened clock tick (
+ *    @see{begin_clock_tick_in} ), the cached timestamp never reaches the
+ *    deadline
+ *
+ */
+enum Handle_wait_errors_codes {
+  HANDLE_WAIT_DONE_SUCCESSFULLY = 0, /**< the earliest deadline is reached */
+  HANDLE_WAIT_NOTIFIED = 1,          /**< woken up by an earlier deadline */
+  HANDLE_WAIT_TIMEOUT = 2,           /**< max_wait_ms is gone */
+  HANDLE_WAIT_TIMESPEC_GET_ERROR =
+      3, /**< get_now_ticks() monotonic clock function problems occured */
+  HANDLE_WAIT_TICK_OPENED = 4, /**< called inside the opened clock tick */
+};
+
+/**
+ *  @details
+ *  Structure for handling results of @link{wait_next_deadline} function
+ *  execution.
+ *  - type - (SUCCESS | ERROR_CODE)
+ *  - CODES_RESULT - enum @link{enum Handle_wait_errors_codes}, that is
+ *    the wake up reason for SUCCESS (HANDLE_WAIT_DONE_SUCCESSFULLY |
+ *    HANDLE_WAIT_NOTIFIED | HANDLE_WAIT_TIMEOUT)
+ *    or
+ *    HANDLE_WAIT_TIMESPEC_GET_ERROR | HANDLE_WAIT_TICK_OPENED for ERROR_CODE
+ *
+ *  @example
+ *    PROMISE_WAIT log_wait = wait_next_deadline(HANDLE_WAIT_FOREVER);
+ *
+ *    switch (log_wait.type) {
+ *    case SUCCESS:
+ *      serve the ready tasks via get_callback()
+ *      break;
+ *    case ERROR_CODE:
+ *      printf("ERROR_CODE: %hd\n", log_wait.CODES_RESULT);
+ *      OUTPUT: e.g. HANDLE_WAIT_TIMESPEC_GET_ERROR
+ *      break;
+ *    default:
+ *      fprintf(stderr, "Error(%s() function at %d): ups... Unknown
+ *        log_wait.type\n", __func__, __LINE__);
+ *      break;
+ *    }
+ *
+ */
+typedef struct s_Handle_wait_result {
+  PROMISE_TYPE type; /**< SUCCESS | ERROR_CODE */
+  enum Handle_wait_errors_codes
+      CODES_RESULT; /**< HANDLE_WAIT_DONE_SUCCESSFULLY | HANDLE_WAIT_NOTIFIED |
+                       HANDLE_WAIT_TIMEOUT | HANDLE_WAIT_TIMESPEC_GET_ERROR |
+                       HANDLE_WAIT_TICK_OPENED */
+} PROMISE_WAIT;
+
+/**
+ *  @details
+ *  The waiter of the scheduler instance ( @see{Scheduler},
+ *  @see{wait_next_deadline_in} )
+ *  - pthread_mutex_t wait_mutex - guards the @link{wake_sequence}
+ *  - pthread_cond_t wait_cond - the condition variable on the monotonic
+ *    clock (initialized at the first wait)
+ *  - bool is_cond_initialized - the @link{wait_cond} is initialized
+ *  - unsigned long long wake_sequence - bumped per notification
+ *  - _Atomic TASK_TICKS waited_deadline_ticks - the deadline (ns) the waiter
+ *    sleeps till: LLONG_MIN => nobody waits, LLONG_MAX => the waiter is
+ *    reading the queue (any deadline wakes it)
+ *
+ */
+typedef struct s_Deadline_waiter {
+  pthread_mutex_t wait_mutex;            /**< guards the wake_sequence */
+  pthread_cond_t wait_cond;              /**< on the monotonic clock */
+  bool is_cond_initialized;              /**< the wait_cond is initialized */
+  unsigned long long wake_sequence;      /**< bumped per notification */
+  _Atomic TASK_TICKS waited_deadline_ticks; /**< the waited deadline (ns) */
+} DEADLINE_WAITER;
+
+/**
+ *  @brief Static initializer of the @type{DEADLINE_WAITER} (nobody waits)
+ *
+ */
+#define DEADLINE_WAITER_INITIALIZER                                            \
+  {.wait_mutex = PTHREAD_MUTEX_INITIALIZER,                                    \
+   .waited_deadline_ticks = LLONG_MIN}
+
+PROMISE_WAIT wait_next_deadline_locked_in(Scheduler *ptr_scheduler,
+                                          pthread_mutex_t *ptr_queue_mutex,
+                                          TASK_DELAY max_wait_ms);
+PROMISE_WAIT wait_next_deadline_in(Scheduler *ptr_scheduler,
+                                   TASK_DELAY max_wait_ms);
+PROMISE_WAIT wait_next_deadline_locked(pthread_mutex_t *ptr_queue_mutex,
+                                       TASK_DELAY max_wait_ms);
+PROMISE_WAIT wait_next_deadline(TASK_DELAY max_wait_ms);
+void notify_new_deadline_in(Scheduler *ptr_scheduler,
+                            TASK_TICKS deadline_ticks);
+void notify_new_deadline(TASK_TICKS deadline_ticks);
+
+#endif
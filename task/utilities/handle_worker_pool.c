@@ -0,0 +1,553 @@
+// POSIX declarations (pthread) for the strict -std=c23 builds
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "../environment/config.h"
+#include "../environment/global_variables.h"
+#include "./handle_worker_pool_config.h"
+
+enum Handle_worker_pool_variables {
+  WORKER_DEQUE_MASK = TASK_WORKER_DEQUE_CAPACITY - 1, /**< index => slot */
+};
+
+/**
+ *  @details
+ *  Results of the @link{steal_worker_task}
+ *  - WORKER_TASK_STOLEN - the task is taken
+ *  - WORKER_DEQUE_EMPTY - nothing to take
+ *  - WORKER_STEAL_ABORTED - the other worker has taken the same task first
+ *
+ */
+typedef enum {
+  WORKER_TASK_STOLEN = 0,   /**< the task is taken */
+  WORKER_DEQUE_EMPTY = 1,   /**< nothing to take */
+  WORKER_STEAL_ABORTED = 2, /**< lost the race, retry */
+} WORKER_STEAL_RESULT;
+
+/**
+ *  @details
+ *  The slot of the deque: the fields are atomic, so the thief that lost the
+ *  race for the slot being overwritten reads it without the data race (its'
+ *  CAS of the top fails anyway)
+ *
+ */
+typedef struct s_Work_slot {
+  _Atomic(task_callback) callback; /**< callback of the expired task */
+  _Atomic unsigned short func_arg; /**< argument of the @link{callback} */
+} WORK_SLOT;
+
+/**
+ *  @details
+ *  Chase–Lev work-stealing deque (static, bounded). The dispatcher is the
+ *  owner: it pushes to the bottom, the workers steal from the top (the own
+ *  worker of the deque first, the idle ones of the others)
+ *  - top - next index to steal (CAS'ed by the workers)
+ *  - bottom - next index to push (written by the dispatcher only)
+ *  - slots - the ring of the pushed tasks
+ *
+ */
+typedef struct s_Worker_deque {
+  _Alignas(64) _Atomic long long top; /**< next index to steal */
+  _Alignas(64) _Atomic long long bottom; /**< next index to push */
+  WORK_SLOT slots[TASK_WORKER_DEQUE_CAPACITY]; /**< the pushed tasks */
+} WORKER_DEQUE;
+
+static WORKER_DEQUE worker_deques[TASK_WORKERS_MAX];
+static pthread_t worker_threads[TASK_WORKERS_MAX];
+static int worker_numbers[TASK_WORKERS_MAX];
+// @note written by the controlling thread (start / stop), read by the
+// workers and the threads of every instance ( @see{
+// is_worker_pool_attached_in} ) => acquire / release
+static _Atomic int workers_quantity = 0; /**< 0 => the pool isn't started */
+static int next_deque_index = 0; /**< round robin of the dispatcher */
+static atomic_bool is_pool_stopping = false;
+
+// @note the only instance whose @link{run_ready_tasks_in} pushes to the pool
+// (the deques have one owner), NULL => the callbacks are called inline
+static _Atomic(const Scheduler *) attached_scheduler = NULL;
+
+// @note parking of the idle workers (the dispatcher wakes them up only if
+// there are idle ones)
+static _Atomic int idle_workers_count = 0;
+static pthread_mutex_t idle_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t idle_cond = PTHREAD_COND_INITIALIZER;
+static unsigned long long work_sequence = 0; /**< bumped per wake up */
+
+/**
+ *  @brief Utility function (encapsulated) to steal the oldest task of the
+ *  deque (lock-free, any thread)
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer (encapsulated in the module) @link{worker_deques}
+ *
+ *  @param {WORKER_DEQUE *} ptr_deque - the deque to steal from
+ *  @param {task_callback *} ptr_callback - where to copy the callback
+ *  @param {unsigned short *} ptr_func_arg - where to copy its' argument
+ *
+ *  @return {WORKER_STEAL_RESULT} - @see{WORKER_STEAL_RESULT}
+ *
+ */
+static WORKER_STEAL_RESULT steal_worker_task(WORKER_DEQUE *ptr_deque,
+                                             task_callback *ptr_callback,
+                                             unsigned short *ptr_func_arg) {
+  long long top = atomic_load_explicit(&ptr_deque->top, memory_order_acquire);
+  atomic_thread_fence(memory_order_seq_cst);
+  long long bottom =
+      atomic_load_explicit(&ptr_deque->bottom, memory_order_acquire);
+
+  if (top >= bottom) {
+    return WORKER_DEQUE_EMPTY;
+  }
+
+  WORK_SLOT *ptr_slot = &ptr_deque->slots[top & WORKER_DEQUE_MASK];
+  *ptr_callback =
+      atomic_load_explicit(&ptr_slot->callback, memory_order_relaxed);
+  *ptr_func_arg =
+      atomic_load_explicit(&ptr_slot->func_arg, memory_order_relaxed);
+
+  if (!atomic_compare_exchange_strong_explicit(&ptr_deque->top, &top, top + 1,
+                                               memory_order_seq_cst,
+                                               memory_order_relaxed)) {
+    return WORKER_STEAL_ABORTED;
+  }
+
+  return WORKER_TASK_STOLEN;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to take the task for the worker:
+ *  its' own deque first, then the others' ones (stealing)
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on @callback{steal_worker_task}
+ *
+ *  @param {int} worker_number - the worker's index
+ *  @param {task_callback *} ptr_callback - where to copy the callback
+ *  @param {unsigned short *} ptr_func_arg - where to copy its' argument
+ *
+ *  @return {bool} - true => the task is taken
+ *
+ */
+static bool take_worker_task(int worker_number, task_callback *ptr_callback,
+                             unsigned short *ptr_func_arg) {
+  int workers_count =
+      atomic_load_explicit(&workers_quantity, memory_order_acquire);
+
+  for (int shift = 0; shift < workers_count; shift += 1) {
+    WORKER_DEQUE *ptr_deque =
+        &worker_deques[(worker_number + shift) % workers_count];
+    WORKER_STEAL_RESULT result = WORKER_STEAL_ABORTED;
+
+    while (result == WORKER_STEAL_ABORTED) {
+      result = steal_worker_task(ptr_deque, ptr_callback, ptr_func_arg);
+    }
+
+    if (result == WORKER_TASK_STOLEN) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ *  @brief Utility function (encapsulated): the worker's thread. Calls the
+ *  callbacks of the taken tasks, parks when there is nothing to take, exits
+ *  on @link{stop_worker_pool} after the deques are drained
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer (encapsulated in the module)
+ *    @link{idle_workers_count}
+ *  - implicit dependency on @callback{take_worker_task}
+ *  - implicit dependency on (encapsulated in the module)
+ *    @link{work_sequence}
+ *  - implicit dependency on (encapsulated in the module)
+ *    @link{is_pool_stopping}
+ *
+ *  @param {void *} arg - pointer to the worker's index
+ *
+ */
+static void *run_worker(void *arg) {
+  int worker_number = *(int *)arg;
+  task_callback callback = NULL;
+  unsigned short func_arg = 0;
+
+  while (true) {
+    if (take_worker_task(worker_number, &callback, &func_arg)) {
+      callback(func_arg);
+      continue;
+    }
+
+    pthread_mutex_lock(&idle_mutex);
+    unsigned long long started_sequence = work_sequence;
+    pthread_mutex_unlock(&idle_mutex);
+
+    // announce the parking before the last check (pairs with the check of
+    // @link{idle_workers_count} in @link{push_worker_task})
+    atomic_fetch_add(&idle_workers_count, 1);
+
+    if (take_worker_task(worker_number, &callback, &func_arg)) {
+      atomic_fetch_sub(&idle_workers_count, 1);
+      callback(func_arg);
+      continue;
+    }
+
+    if (atomic_load(&is_pool_stopping)) {
+      atomic_fetch_sub(&idle_workers_count, 1);
+      break;
+    }
+
+    pthread_mutex_lock(&idle_mutex);
+    while ((work_sequence == started_sequence) &&
+           !atomic_load(&is_pool_stopping)) {
+      pthread_cond_wait(&idle_cond, &idle_mutex);
+    }
+    pthread_mutex_unlock(&idle_mutex);
+
+    atomic_fetch_sub(&idle_workers_count, 1);
+  }
+
+  return NULL;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to wake up the parked workers
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer (encapsulated in the module) @link{work_sequence}
+ *
+ *  @param {bool} is_all - true => all of them, false => one
+ *
+ */
+static void wake_worker(bool is_all) {
+  pthread_mutex_lock(&idle_mutex);
+  work_sequence += 1;
+
+  if (is_all) {
+    pthread_cond_broadcast(&idle_cond);
+  } else {
+    pthread_cond_signal(&idle_cond);
+  }
+
+  pthread_mutex_unlock(&idle_mutex);
+}
+
+/**
+ *  @brief Start the pool of the worker threads, then @link{run_ready_tasks}
+ *  hands the expired callbacks over to them (no slow callback blocks the
+ *  rest of the expired ones). Everything is in the static memory
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer (encapsulated in the module) @link{workers_quantity}
+ *  - mutates the outer (encapsulated in the module) @link{worker_threads}
+ *  - mutates the outer (encapsulated in the module) @link{worker_numbers}
+ *
+ *  @note The callbacks run on the workers concurrently: they must not call
+ *  the controllers (the queue belongs to the dispatcher), use the command
+ *  ring instead ( @see{submit_register_task} ).
+ *  @note The pool is process-wide (not per shard, @see{TASK_SHARDED} or per
+ *  instance): only one dispatcher thread may push to it, so the callbacks go
+ *  to the workers only from the instance attached via
+ *  @link{attach_worker_pool_in}.
+ *
+ *  @param {int} workers_count - quantity of the workers, [1;
+ *    TASK_WORKERS_MAX]
+ *
+ *  @return {enum Handle_worker_pool_errors_codes} -
+ *  HANDLE_WORKER_POOL_DONE_SUCCESSFULLY
+ *  @throw HANDLE_WORKER_POOL_INVALID_WORKERS_COUNT - out of the range
+ *  @throw HANDLE_WORKER_POOL_IS_STARTED - the pool is started already
+ *  @throw HANDLE_WORKER_POOL_THREAD_CREATE_ERROR - pthread_create() failed
+ *
+ *  @example
+ *    start_worker_pool(4);
+ *    attach_worker_pool();
+ *
+ *    while (true) {
+ *      wait_next_deadline(HANDLE_WAIT_FOREVER);
+ *      run_ready_tasks((RUN_BUDGET){}); => the callbacks run on the workers
+ *    }
+ *
+ */
+enum Handle_worker_pool_errors_codes start_worker_pool(int workers_count) {
+  if ((workers_count < 1) || (workers_count > TASK_WORKERS_MAX)) {
+    return HANDLE_WORKER_POOL_INVALID_WORKERS_COUNT;
+  }
+
+  if (atomic_load_explicit(&workers_quantity, memory_order_acquire) > 0) {
+    return HANDLE_WORKER_POOL_IS_STARTED;
+  }
+
+  // the workers read the quantity since their start
+  atomic_store_explicit(&workers_quantity, workers_count,
+                        memory_order_release);
+  next_deque_index = 0;
+
+  for (int i = 0; i < workers_count; i += 1) {
+    worker_numbers[i] = i;
+
+    if (pthread_create(&worker_threads[i], NULL, run_worker,
+                       &worker_numbers[i]) != 0) {
+      // stop the started ones
+      atomic_store(&is_pool_stopping, true);
+      wake_worker(true);
+
+      for (int j = 0; j < i; j += 1) {
+        pthread_join(worker_threads[j], NULL);
+      }
+
+      atomic_store(&is_pool_stopping, false);
+      atomic_store_explicit(&workers_quantity, 0, memory_order_release);
+
+      return HANDLE_WORKER_POOL_THREAD_CREATE_ERROR;
+    }
+  }
+
+  return HANDLE_WORKER_POOL_DONE_SUCCESSFULLY;
+}
+
+/**
+ *  @brief Stop the pool: the workers call the callbacks left in the deques
+ *  and exit, the function returns when all of them are joined
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer (encapsulated in the module) @link{workers_quantity}
+ *  - mutates the outer (encapsulated in the module) @link{is_pool_stopping}
+ *  - mutates the outer (encapsulated in the module)
+ *    @link{attached_scheduler} (detached)
+ *
+ *  @note Call it from the dispatcher thread (or after it has stopped).
+ *
+ *  @param {void} - no params expected
+ *
+ */
+void stop_worker_pool(void) {
+  atomic_store(&attached_scheduler, NULL);
+
+  int workers_count =
+      atomic_load_explicit(&workers_quantity, memory_order_acquire);
+
+  if (workers_count == 0) {
+    return;
+  }
+
+  atomic_store(&is_pool_stopping, true);
+  wake_worker(true);
+
+  for (int i = 0; i < workers_count; i += 1) {
+    pthread_join(worker_threads[i], NULL);
+  }
+
+  atomic_store(&is_pool_stopping, false);
+  atomic_store_explicit(&workers_quantity, 0, memory_order_release);
+}
+
+/**
+ *  @brief Check if the pool is started ( @see{start_worker_pool} )
+ *
+ *  @param {void} - no params expected
+ *
+ *  @return {bool} - true => the pool is started
+ *
+ */
+bool is_worker_pool_started(void) {
+  return atomic_load_explicit(&workers_quantity, memory_order_acquire) > 0;
+}
+
+/**
+ *  @brief Make the instance the dispatcher of the pool: its'
+ *  @link{run_ready_tasks_in} pushes the expired callbacks to the workers, the
+ *  rest instances (the other shards, @see{TASK_SHARDED}) keep calling them
+ *  inline
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer (encapsulated in the module)
+ *    @link{attached_scheduler}
+ *
+ *  @note The deques have one owner: one instance at a time, served by one
+ *  thread. Attaching the attached instance again is a no-op.
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {enum Handle_worker_pool_errors_codes} -
+ *  HANDLE_WORKER_POOL_DONE_SUCCESSFULLY
+ *  @throw HANDLE_WORKER_POOL_IS_ATTACHED - the other instance is attached
+ *    already ( @see{detach_worker_pool_in} )
+ *
+ *  @example
+ *    start_worker_pool(4);
+ *    attach_worker_pool_in(&io_scheduler); => DONE_SUCCESSFULLY
+ *    attach_worker_pool_in(&db_scheduler); => HANDLE_WORKER_POOL_IS_ATTACHED
+ *
+ */
+enum Handle_worker_pool_errors_codes
+attach_worker_pool_in(Scheduler *ptr_scheduler) {
+  const Scheduler *ptr_expected = NULL;
+
+  if (!atomic_compare_exchange_strong(&attached_scheduler, &ptr_expected,
+                                      ptr_scheduler) &&
+      (ptr_expected != ptr_scheduler)) {
+    return HANDLE_WORKER_POOL_IS_ATTACHED;
+  }
+
+  return HANDLE_WORKER_POOL_DONE_SUCCESSFULLY;
+}
+
+/**
+ *  @brief Make the default scheduler instance the dispatcher of the pool (
+ *  @see{attach_worker_pool_in} )
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{attach_worker_pool_in} ones
+ *
+ *  @param {void} - no params expected
+ *
+ *  @return {enum Handle_worker_pool_errors_codes} - the same as
+ *  @link{attach_worker_pool_in} one
+ *
+ */
+enum Handle_worker_pool_errors_codes attach_worker_pool(void) {
+  return attach_worker_pool_in(&default_scheduler);
+}
+
+/**
+ *  @brief Detach the instance from the pool (its' callbacks are called inline
+ *  again), the other instance may be attached then. No-op for the instance
+ *  that isn't attached
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer (encapsulated in the module)
+ *    @link{attached_scheduler}
+ *
+ *  @note The pushed callbacks are still called by the workers.
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ */
+void detach_worker_pool_in(Scheduler *ptr_scheduler) {
+  const Scheduler *ptr_expected = ptr_scheduler;
+
+  atomic_compare_exchange_strong(&attached_scheduler, &ptr_expected, NULL);
+}
+
+/**
+ *  @brief Detach the default scheduler instance from the pool (
+ *  @see{detach_worker_pool_in} )
+ *
+ *  @note ! Impure function !
+ *  - the same as @link{detach_worker_pool_in} ones
+ *
+ *  @param {void} - no params expected
+ *
+ */
+void detach_worker_pool(void) {
+  detach_worker_pool_in(&default_scheduler);
+}
+
+/**
+ *  @brief Check if the pool is started and the instance is its' dispatcher (
+ *  @see{attach_worker_pool_in} ), i.e. @link{run_ready_tasks_in} pushes the
+ *  callbacks of the instance to the workers
+ *
+ *  @param {const Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {bool} - true => the callbacks go to the workers
+ *
+ */
+bool is_worker_pool_attached_in(const Scheduler *ptr_scheduler) {
+  return (atomic_load_explicit(&workers_quantity, memory_order_acquire) > 0) &&
+         (atomic_load(&attached_scheduler) == ptr_scheduler);
+}
+
+/**
+ *  @brief Check (the dispatcher only) if all the workers' deques are full,
+ *  i.e. the next @link{push_worker_task} fails
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on (encapsulated in the module)
+ *    @link{worker_deques}
+ *
+ *  @param {void} - no params expected
+ *
+ *  @return {bool} - true => all the deques are full
+ *
+ */
+bool is_worker_pool_full(void) {
+  int workers_count =
+      atomic_load_explicit(&workers_quantity, memory_order_acquire);
+
+  for (int i = 0; i < workers_count; i += 1) {
+    long long top =
+        atomic_load_explicit(&worker_deques[i].top, memory_order_acquire);
+    long long bottom =
+        atomic_load_explicit(&worker_deques[i].bottom, memory_order_relaxed);
+
+    if (bottom - top < TASK_WORKER_DEQUE_CAPACITY) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/**
+ *  @brief Push the expired task's callback to the workers' deque (the
+ *  dispatcher i.e. the thread serving the attached instance only, round
+ *  robin over the non-full deques) and wake up the parked worker if any
+ *
+ *  @note ! Impure function !
+ *  - mutates the outer (encapsulated in the module) @link{worker_deques}
+ *  - mutates the outer (encapsulated in the module) @link{next_deque_index}
+ *  - implicit dependency on @callback{wake_worker}
+ *
+ *  @note No locks: relaxed stores of the slot and the bottom, the wake up
+ *  (mutex) only if some worker is parked.
+ *
+ *  @param {task_callback} callback - callback to call on the worker
+ *  @param {unsigned short} func_arg - argument of the @link{callback}
+ *
+ *  @return {enum Handle_worker_pool_errors_codes} -
+ *  HANDLE_WORKER_POOL_DONE_SUCCESSFULLY
+ *  @throw HANDLE_WORKER_POOL_IS_FULL - all the deques are full (or the pool
+ *    isn't started)
+ *
+ */
+enum Handle_worker_pool_errors_codes
+push_worker_task(task_callback callback, unsigned short func_arg) {
+  int workers_count =
+      atomic_load_explicit(&workers_quantity, memory_order_acquire);
+
+  for (int shift = 0; shift < workers_count; shift += 1) {
+    WORKER_DEQUE *ptr_deque = &worker_deques[next_deque_index];
+    next_deque_index = (next_deque_index + 1) % workers_count;
+
+    long long bottom =
+        atomic_load_explicit(&ptr_deque->bottom, memory_order_relaxed);
+    long long top = atomic_load_explicit(&ptr_deque->top, memory_order_acquire);
+
+    if (bottom - top >= TASK_WORKER_DEQUE_CAPACITY) {
+      continue;
+    }
+
+    WORK_SLOT *ptr_slot = &ptr_deque->slots[bottom & WORKER_DEQUE_MASK];
+    atomic_store_explicit(&ptr_slot->callback, callback, memory_order_relaxed);
+    atomic_store_explicit(&ptr_slot->func_arg, func_arg, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&ptr_deque->bottom, bottom + 1,
+                          memory_order_relaxed);
+
+    // publish before checking the parked workers (pairs with the announce in
+    // @link{run_worker})
+    atomic_thread_fence(memory_order_seq_cst);
+
+    if (atomic_load_explicit(&idle_workers_count, memory_order_relaxed) > 0) {
+      wake_worker(false);
+    }
+
+    return HANDLE_WORKER_POOL_DONE_SUCCESSFULLY;
+  }
+
+  return HANDLE_WORKER_POOL_IS_FULL;
+}
@@ -0,0 +1,44 @@
+#ifndef HANDLE_WORKER_POOL_CONFIG_H
+#define HANDLE_WORKER_POOL_CONFIG_H
+
+#include "../environment/config.h"
+
+/**
+ *  @details
+ *  - HANDLE_WORKER_POOL_DONE_SUCCESSFULLY - no errors, done successfully
+ *  - HANDLE_WORKER_POOL_INVALID_WORKERS_COUNT - the workers' quantity is out
+ *    of the range [1; TASK_WORKERS_MAX]
+ *  - HANDLE_WORKER_POOL_IS_STARTED - the pool is started already
+ *  - HANDLE_WORKER_POOL_THREAD_CREATE_ERROR - pthread_create() problems
+ *    occured (the started workers are stopped)
+ *  - HANDLE_WORKER_POOL_IS_FULL - all the workers' deques are full
+ *  - HANDLE_WORKER_POOL_IS_ATTACHED - the other scheduler instance is
+ *    attached to the pool already (one dispatcher only)
+ *
+ */
+enum Handle_worker_pool_errors_codes {
+  HANDLE_WORKER_POOL_DONE_SUCCESSFULLY = 0, /**< no errors */
+  HANDLE_WORKER_POOL_INVALID_WORKERS_COUNT =
+      1, /**< out of the range [1; TASK_WORKERS_MAX] */
+  HANDLE_WORKER_POOL_IS_STARTED = 2, /**< the pool is started already */
+  HANDLE_WORKER_POOL_THREAD_CREATE_ERROR =
+      3,                          /**< pthread_create() failed */
+  HANDLE_WORKER_POOL_IS_FULL = 4, /**< all the workers' deques are full */
+  HANDLE_WORKER_POOL_IS_ATTACHED =
+      5, /**< the other instance is attached already */
+};
+
+enum Handle_worker_pool_errors_codes start_worker_pool(int workers_count);
+void stop_worker_pool(void);
+bool is_worker_pool_started(void);
+enum Handle_worker_pool_errors_codes
+attach_worker_pool_in(Scheduler *ptr_scheduler);
+enum Handle_worker_pool_errors_codes attach_worker_pool(void);
+void detach_worker_pool_in(Scheduler *ptr_scheduler);
+void detach_worker_pool(void);
+bool is_worker_pool_attached_in(const Scheduler *ptr_scheduler);
+bool is_worker_pool_full(void);
+enum Handle_worker_pool_errors_codes
+push_worker_task(task_callback callback, unsigned short func_arg);
+
+#endif
@@ -0,0 +1,109 @@
+#include <limits.h>
+
+#if defined(__AVX2__) || defined(__SSE4_2__)
+#include <immintrin.h>
+#endif
+
+#include "./utils.h"
+
+/**
+ *  @brief Get the bitmap of the expired deadlines of the packed (contiguous)
+ *  deadlines' block, i.e. the bit i is set <=> deadlines[i] <= current_ticks
+ *
+ *  @note The comparison is vectorised: AVX2 (4 deadlines per instruction) or
+ *  SSE4.2 (2 deadlines) if the build targets them (e.g. -mavx2 or
+ *  -march=native), otherwise the scalar loop (auto-vectorised by the compiler
+ *  at -O3).
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on @type{TASK_TICKS}
+ *
+ *  @param {const TASK_TICKS []} deadlines - the block of the deadlines (ns)
+ *  @param {size_t} quantity - quantity of the deadlines, range [0:64]
+ *  @param {TASK_TICKS} current_ticks - current monotonic timestamp (ns)
+ *
+ *  @return {uint64_t} - the bitmap of the expired deadlines
+ *
+ *  @example
+ *    TASK_TICKS deadlines[4] = {300, 100, 400, 200};
+ *    get_expired_deadlines_mask(deadlines, 4, 250) => 0b1010
+ *
+ */
+uint64_t get_expired_deadlines_mask(const TASK_TICKS deadlines[],
+                                    size_t quantity,
+                                    TASK_TICKS current_ticks) {
+  uint64_t expired_mask = 0;
+  size_t i = 0;
+
+#if defined(__AVX2__)
+  const __m256i CURRENT = _mm256_set1_epi64x(current_ticks);
+
+  for (; i + 4 <= quantity; i += 4) {
+    __m256i packed =
+        _mm256_loadu_si256((const __m256i *)(const void *)&deadlines[i]);
+    // deadline > current <=> not expired
+    unsigned int pending_bits = (unsigned int)_mm256_movemask_pd(
+        _mm256_castsi256_pd(_mm256_cmpgt_epi64(packed, CURRENT)));
+
+    expired_mask |= (uint64_t)(~pending_bits & 0xFU) << i;
+  }
+#elif defined(__SSE4_2__)
+  const __m128i CURRENT = _mm_set1_epi64x(current_ticks);
+
+  for (; i + 2 <= quantity; i += 2) {
+    __m128i packed =
+        _mm_loadu_si128((const __m128i *)(const void *)&deadlines[i]);
+    // deadline > current <=> not expired
+    unsigned int pending_bits = (unsigned int)_mm_movemask_pd(
+        _mm_castsi128_pd(_mm_cmpgt_epi64(packed, CURRENT)));
+
+    expired_mask |= (uint64_t)(~pending_bits & 0x3U) << i;
+  }
+#endif
+
+  for (; i < quantity; i += 1) {
+    expired_mask |= (uint64_t)(deadlines[i] <= current_ticks) << i;
+  }
+
+  return expired_mask;
+}
+
+/**
+ *  @brief Get the index of the least deadline of the packed (contiguous)
+ *  deadlines (the first one of the equal ones)
+ *
+ *  @note Two passes: the minimum (branchless, auto-vectorised by the
+ *  compiler) and the search of its' index (stops at the first match).
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on @type{TASK_TICKS}
+ *  - implicit dependency on @link{LLONG_MAX} of <limits.h>
+ *
+ *  @param {const TASK_TICKS []} deadlines - the deadlines (ns)
+ *  @param {size_t} quantity - quantity of the deadlines
+ *
+ *  @return {size_t} - index of the least deadline or @link{quantity} if
+ *  there are no deadlines
+ *
+ *  @example
+ *    TASK_TICKS deadlines[4] = {300, 100, 400, 100};
+ *    get_earliest_deadline_index(deadlines, 4) => 1
+ *
+ */
+size_t get_earliest_deadline_index(const TASK_TICKS deadlines[],
+                                   size_t quantity) {
+  TASK_TICKS earliest_ticks = LLONG_MAX;
+
+  for (size_t i = 0; i < quantity; i += 1) {
+    earliest_ticks =
+        deadlines[i] < earliest_ticks ? deadlines[i] : earliest_ticks;
+  }
+
+  for (size_t i = 0; i < quantity; i += 1) {
+    if (deadlines[i] == earliest_ticks) {
+      return i;
+    }
+  }
+
+  return quantity;
+}
@@ -3,7 +3,7 @@
 /**
  *  @brief Callback for @link{qsort} function of <stdlib.h>
  *
- *  Sort descending Tasks via @link{Task.delay}(ms)
+ *  Sort descending Tasks via @link{Task.deadline_ticks}(ns)
  *
  *  @note ! Impure function !
  *  - implicit dependency on @type{Task}
@@ -11,11 +11,11 @@
  *  @param {const void *} task_a - pointer to the task
  *  @param {const void *} task_b - pointer to the task
  *
- *  @return {-1} - stands for => task_a.delay < task_b.delay
+ *  @return {1} - stands for => task_a.deadline_ticks < task_b.deadline_ticks
  *  so in descending order will be {task_b, task_a}
- *  @return {0} - stands for => task_a.delay == task_b.delay
+ *  @return {0} - stands for => task_a.deadline_ticks == task_b.deadline_ticks
  *  so in descending order will be {task_a, task_b}
- *  @return {1} - stands for => task_a.delay > task_b.delay
+ *  @return {-1} - stands for => task_a.deadline_ticks > task_b.deadline_ticks
  *  so in descending order will be {task_a, task_b}
  *
  */
@@ -24,17 +24,16 @@ static int qsort_compare_func(const void *task_a, const void *task_b) {
   const Task *ptr_a = (const Task *)task_a;
   const Task *ptr_b = (const Task *)task_b;
 
-  // dereferencing values
-  Task a = *ptr_a;
-  Task b = *ptr_b;
-
   // sort descending
-  return b.delay - a.delay;
+  // @note (no subtraction to prevent overflow of the int result)
+  return (ptr_a->deadline_ticks < ptr_b->deadline_ticks) -
+         (ptr_a->deadline_ticks > ptr_b->deadline_ticks);
 }
 
 /**
- *  @brief Sort array of tasks ( of @type{Task} ) descending by delay(ms) (
- *  @link{Task.delay} )
+ *  @brief Sort array of tasks ( of @type{Task} ) descending by absolute
+ *  deadline(ns) ( @link{Task.deadline_ticks} ) i.e. the task to be served first
+ *  has the greatest index
  *
  *  @note ! Impure function !
  *  - mutates the outer @link{arr[]}
@@ -47,7 +46,7 @@ static int qsort_compare_func(const void *task_a, const void *task_b) {
  *  @link{arr} sorts and resources usage.
  *
  *  @param {Task []} arr - array of @type{Task} 's to sort
- *  @param {unsigned short} elems_quantity_to_sort - quantity of elems to sort
+ *  @param {TASK_COUNTER} elems_quantity_to_sort - quantity of elems to sort
  *  @note Possible value must be not greater than @link{arr} size! But can be
  *  less, so only *the given quantity of elems* will be sorted
  *
@@ -57,47 +56,53 @@ static int qsort_compare_func(const void *task_a, const void *task_b) {
  *        func_arg = 400
  *        delay = 400
  *        id = 0
- *        created_timespec{...}
+ *        created_ticks = ...
+ *        deadline_ticks = ...
  *      },
  *      (Task){
  *        func_arg = 960
  *        delay = 960
  *        id = 2
- *        created_timespec{...}
+ *        created_ticks = ...
+ *        deadline_ticks = ...
  *      },
  *      (Task){
  *        func_arg = 1400
  *        delay = 1400
  *        id = 1
- *        created_timespec{...}
+ *        created_ticks = ...
+ *        deadline_ticks = ...
  *      }
  *    }
  *
- *    sort_tasks_descending_by_delay(arr, 3) => void
+ *    sort_tasks_descending_by_deadline(arr, 3) => void
  *    arr{
  *      (Task){
  *        func_arg = 1400
  *        delay = 1400
  *        id = 1
- *        created_timespec{...}
+ *        created_ticks = ...
+ *        deadline_ticks = ...
  *      },
  *      (Task){
  *        func_arg = 960
  *        delay = 960
  *        id = 2
- *        created_timespec{...}
+ *        created_ticks = ...
+ *        deadline_ticks = ...
  *      },
  *      (Task){
  *        func_arg = 400
  *        delay = 400
  *        id = 0
- *        created_timespec{...}
+ *        created_ticks = ...
+ *        deadline_ticks = ...
  *      },
  *    }
  *
  */
-void sort_tasks_descending_by_delay(Task arr[], const size_t ARR_SIZE,
-                                    unsigned short elems_quantity_to_sort) {
+void sort_tasks_descending_by_deadline(Task arr[], const size_t ARR_SIZE,
+                                       TASK_COUNTER elems_quantity_to_sort) {
   // check that @link{elems_quantity_to_sort} is not greater than given arr size
   if (elems_quantity_to_sort > ARR_SIZE) {
     elems_quantity_to_sort = ARR_SIZE;
@@ -0,0 +1,428 @@
+#include "../environment/config.h"
+
+#if TASK_QUEUE_BACKEND == TASK_QUEUE_BACKEND_BINARY_HEAP
+
+#include <limits.h>
+
+#include "../environment/scheduler_config.h"
+#include "./utils.h"
+
+/**
+ *  @brief Utility function (encapsulated) to swap two tasks of the
+ *  @link{tasks_array} via their indexes
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the @link{task_positions} of the @link{ptr_scheduler}'s queue
+ *    state ( @see{TASK_QUEUE_STATE} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} index_a - index of the task in the @link{tasks_array}
+ *  @param {TASK_COUNTER} index_b - index of the task in the @link{tasks_array}
+ *
+ */
+static void swap_tasks(Scheduler *ptr_scheduler, TASK_COUNTER index_a,
+                       TASK_COUNTER index_b) {
+  Task *tasks_array = ptr_scheduler->tasks_array;
+  TASK_COUNTER *task_positions = ptr_scheduler->queue.task_positions;
+
+  Task temp = tasks_array[index_a];
+  tasks_array[index_a] = tasks_array[index_b];
+  tasks_array[index_b] = temp;
+
+  task_positions[tasks_array[index_a].id] = index_a;
+  task_positions[tasks_array[index_b].id] = index_b;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to move the task up to the root of
+ *  the heap while its' deadline is less than parent's one
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} index - index of the task in the @link{tasks_array}
+ *
+ *  @return {TASK_COUNTER} - final index of the task
+ *
+ */
+static TASK_COUNTER sift_up(Scheduler *ptr_scheduler, TASK_COUNTER index) {
+  const Task *tasks_array = ptr_scheduler->tasks_array;
+
+  while (index > 0) {
+    TASK_COUNTER parent = (index - 1) / 2;
+
+    if (tasks_array[parent].deadline_ticks <=
+        tasks_array[index].deadline_ticks) {
+      break;
+    }
+
+    swap_tasks(ptr_scheduler, parent, index);
+    index = parent;
+  }
+
+  return index;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to move the task down to the leaves
+ *  of the heap while its' deadline is greater than the least child's one
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - implicit dependency on the @link{task_count} of the @link{ptr_scheduler}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} index - index of the task in the @link{tasks_array}
+ *
+ */
+static void sift_down(Scheduler *ptr_scheduler, TASK_COUNTER index) {
+  const Task *tasks_array = ptr_scheduler->tasks_array;
+  const TASK_COUNTER TASK_COUNT = ptr_scheduler->task_count;
+
+  while (true) {
+    size_t left = 2 * (size_t)index + 1;
+    size_t right = left + 1;
+    TASK_COUNTER least = index;
+
+    if (left < TASK_COUNT &&
+        tasks_array[left].deadline_ticks < tasks_array[least].deadline_ticks) {
+      least = left;
+    }
+
+    if (right < TASK_COUNT &&
+        tasks_array[right].deadline_ticks < tasks_array[least].deadline_ticks) {
+      least = right;
+    }
+
+    if (least == index) {
+      return;
+    }
+
+    swap_tasks(ptr_scheduler, index, least);
+    index = least;
+  }
+}
+
+/**
+ *  @brief Utility function (encapsulated) to restore the heap order after the
+ *  task at the given index has changed its' deadline
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} index - index of the task in the @link{tasks_array}
+ *
+ */
+static void sift(Scheduler *ptr_scheduler, TASK_COUNTER index) {
+  if (sift_up(ptr_scheduler, index) == index) {
+    sift_down(ptr_scheduler, index);
+  }
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get the index of the task via its'
+ *  id. O(1) lookup via @link{task_positions} (validated against the task's id,
+ *  so the stale entries of the removed tasks are never trusted)
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{tasks_array} and @link{task_count} of
+ *    the @link{ptr_scheduler}
+ *  - implicit dependency on the @link{task_positions} of the
+ *    @link{ptr_scheduler}'s queue state
+ *
+ *  @param {const Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} id - id of the task
+ *
+ *  @return {TASK_COUNTER} - index of the task in the @link{tasks_array} or
+ *  @link{task_count} if there's no task with such id
+ *
+ */
+static TASK_COUNTER find_task_index(const Scheduler *ptr_scheduler,
+                                    TASK_COUNTER id) {
+  if (id >= MAX_TASK_QUANTITY) {
+    return ptr_scheduler->task_count;
+  }
+
+  TASK_COUNTER index = ptr_scheduler->queue.task_positions[id];
+
+  if ((index < ptr_scheduler->task_count) &&
+      (ptr_scheduler->tasks_array[index].id == id)) {
+    return index;
+  }
+
+  return ptr_scheduler->task_count;
+}
+
+/**
+ *  @brief Nest the task to the binary min-heap @link{tasks_array} (keyed by
+ *  the absolute deadline). O(log n)
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{task_count} and @link{tasks_array} of the
+ *    @link{ptr_scheduler}
+ *  - mutates the @link{task_positions} of the @link{ptr_scheduler}'s queue
+ *    state ( @see{TASK_QUEUE_STATE} )
+ *  - implicit dependency on global variable @link{MAX_TASK_QUANTITY}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {Task} task - the task to nest
+ *
+ *  @return {enum Task_queue_errors_codes} - TASK_QUEUE_DONE_SUCCESSFULLY
+ *  @throw TASK_QUEUE_FULL - no free space in the @link{tasks_array}
+ *  @throw TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED - the task's id is out of range
+ *  or the task with such id is queued already
+ *
+ *  @example
+ *    task_queue_push(&scheduler, task) => TASK_QUEUE_DONE_SUCCESSFULLY
+ *    scheduler.tasks_array[0] => the task with the least deadline
+ *
+ */
+enum Task_queue_errors_codes task_queue_push(Scheduler *ptr_scheduler,
+                                             Task task) {
+  if (ptr_scheduler->task_count >= MAX_TASK_QUANTITY) {
+    return TASK_QUEUE_FULL;
+  }
+
+  // the id is the key of the @link{task_positions} => it must be in range and
+  // must not be queued already
+  if ((task.id >= MAX_TASK_QUANTITY) ||
+      (find_task_index(ptr_scheduler, task.id) != ptr_scheduler->task_count)) {
+    return TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED;
+  }
+
+  ptr_scheduler->tasks_array[ptr_scheduler->task_count] = task;
+  ptr_scheduler->queue.task_positions[task.id] = ptr_scheduler->task_count;
+  ptr_scheduler->task_count += 1;
+  sift_up(ptr_scheduler, ptr_scheduler->task_count - 1);
+
+  return TASK_QUEUE_DONE_SUCCESSFULLY;
+}
+
+/**
+ *  @brief Nothing to advance: the root of the heap is always the task with the
+ *  least deadline
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_TICKS} current_ticks - current monotonic timestamp (ns)
+ *
+ */
+void task_queue_advance(Scheduler *ptr_scheduler, TASK_TICKS current_ticks) {
+  (void)ptr_scheduler;
+  (void)current_ticks;
+}
+
+/**
+ *  @brief Get the task with the least absolute deadline (the root of the
+ *  heap). O(1)
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{tasks_array} and @link{task_count} of
+ *    the @link{ptr_scheduler}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {Task *} - pointer to the task or NULL if @link{tasks_array} is
+ *  empty
+ *
+ */
+Task *task_queue_peek(Scheduler *ptr_scheduler) {
+  if (ptr_scheduler->task_count == 0) {
+    return NULL;
+  }
+
+  return &ptr_scheduler->tasks_array[0];
+}
+
+/**
+ *  @brief Remove the task with the least absolute deadline (the root of the
+ *  heap). O(log n)
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{task_count} and @link{tasks_array} of the
+ *    @link{ptr_scheduler}
+ *  - mutates the @link{task_positions} of the @link{ptr_scheduler}'s queue
+ *    state ( @see{TASK_QUEUE_STATE} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {enum Task_queue_errors_codes} - TASK_QUEUE_DONE_SUCCESSFULLY
+ *  @throw TASK_QUEUE_EMPTY - current task counter value is 0
+ *
+ */
+enum Task_queue_errors_codes task_queue_pop(Scheduler *ptr_scheduler) {
+  if (ptr_scheduler->task_count == 0) {
+    return TASK_QUEUE_EMPTY;
+  }
+
+  Task *tasks_array = ptr_scheduler->tasks_array;
+
+  ptr_scheduler->task_count -= 1;
+  tasks_array[0] = tasks_array[ptr_scheduler->task_count];
+  ptr_scheduler->queue.task_positions[tasks_array[0].id] = 0;
+  tasks_array[ptr_scheduler->task_count] = (Task){0};
+
+  if (ptr_scheduler->task_count > 1) {
+    sift_down(ptr_scheduler, 0);
+  }
+
+  return TASK_QUEUE_DONE_SUCCESSFULLY;
+}
+
+/**
+ *  @brief Remove the task via its' id from the heap. The last leaf takes the
+ *  freed place and is sifted to the proper position. O(log n)
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{task_count} and @link{tasks_array} of the
+ *    @link{ptr_scheduler}
+ *  - mutates the @link{task_positions} of the @link{ptr_scheduler}'s queue
+ *    state ( @see{TASK_QUEUE_STATE} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} id - id of the task to remove
+ *
+ *  @return {enum Task_queue_errors_codes} - TASK_QUEUE_DONE_SUCCESSFULLY
+ *  @throw TASK_QUEUE_EMPTY - current task counter value is 0
+ *  @throw TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED - no such task with given ID
+ *
+ */
+enum Task_queue_errors_codes task_queue_remove(Scheduler *ptr_scheduler,
+                                               TASK_COUNTER id) {
+  if (ptr_scheduler->task_count == 0) {
+    return TASK_QUEUE_EMPTY;
+  }
+
+  TASK_COUNTER index = find_task_index(ptr_scheduler, id);
+
+  if (index == ptr_scheduler->task_count) {
+    return TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED;
+  }
+
+  Task *tasks_array = ptr_scheduler->tasks_array;
+
+  ptr_scheduler->task_count -= 1;
+  tasks_array[index] = tasks_array[ptr_scheduler->task_count];
+  ptr_scheduler->queue.task_positions[tasks_array[index].id] = index;
+  tasks_array[ptr_scheduler->task_count] = (Task){0};
+
+  if (index < ptr_scheduler->task_count) {
+    sift(ptr_scheduler, index);
+  }
+
+  return TASK_QUEUE_DONE_SUCCESSFULLY;
+}
+
+/**
+ *  @brief Set up new delay (ms) and creation timestamp of the task via its' id
+ *  and restore the heap order. O(log n)
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the @link{task_positions} of the @link{ptr_scheduler}'s queue
+ *    state ( @see{TASK_QUEUE_STATE} )
+ *  - implicit dependency on @callback{set_task_delay}
+ *  - implicit dependency on the @link{slacks} of the @link{ptr_scheduler}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} id - id of the task to reschedule
+ *  @param {TASK_DELAY} new_delay - new delay value (ms!)
+ *  @param {TASK_TICKS} created_ticks - new creation monotonic timestamp (ns)
+ *
+ *  @return {enum Task_queue_errors_codes} - TASK_QUEUE_DONE_SUCCESSFULLY
+ *  @throw TASK_QUEUE_EMPTY - current task counter value is 0
+ *  @throw TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED - no such task with given ID
+ *
+ */
+enum Task_queue_errors_codes
+task_queue_reschedule(Scheduler *ptr_scheduler, TASK_COUNTER id,
+                      TASK_DELAY new_delay, TASK_TICKS created_ticks) {
+  if (ptr_scheduler->task_count == 0) {
+    return TASK_QUEUE_EMPTY;
+  }
+
+  TASK_COUNTER index = find_task_index(ptr_scheduler, id);
+
+  if (index == ptr_scheduler->task_count) {
+    return TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED;
+  }
+
+  Task *ptr_task = &ptr_scheduler->tasks_array[index];
+
+  set_task_delay(ptr_task, new_delay, ptr_scheduler->slacks.task_slacks[id],
+                 created_ticks);
+  sift(ptr_scheduler, index);
+
+  return TASK_QUEUE_DONE_SUCCESSFULLY;
+}
+
+/**
+ *  @brief Get the task with the latest deadline (the eviction candidate,
+ *  @see{handle_full_queue}): one of the leaves of the heap. O(n / 2)
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{tasks_array} and @link{task_count} of
+ *    the @link{ptr_scheduler}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {Task *} - pointer to the task or NULL if @link{tasks_array} is
+ *  empty
+ *
+ */
+Task *task_queue_peek_furthest(Scheduler *ptr_scheduler) {
+  const TASK_COUNTER TASK_COUNT = ptr_scheduler->task_count;
+
+  if (TASK_COUNT == 0) {
+    return NULL;
+  }
+
+  Task *ptr_furthest = &ptr_scheduler->tasks_array[TASK_COUNT / 2];
+
+  for (TASK_COUNTER i = TASK_COUNT / 2 + 1; i < TASK_COUNT; i += 1) {
+    if (ptr_scheduler->tasks_array[i].deadline_ticks >
+        ptr_furthest->deadline_ticks) {
+      ptr_furthest = &ptr_scheduler->tasks_array[i];
+    }
+  }
+
+  return ptr_furthest;
+}
+
+/**
+ *  @brief Get the earliest deadline of the queue (the root of the heap). O(1)
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{tasks_array} and @link{task_count} of
+ *    the @link{ptr_scheduler}
+ *
+ *  @param {const Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {TASK_TICKS} - monotonic timestamp (ns) or LLONG_MAX if the
+ *  @link{tasks_array} is empty
+ *
+ */
+TASK_TICKS task_queue_get_next_deadline(const Scheduler *ptr_scheduler) {
+  if (ptr_scheduler->task_count == 0) {
+    return LLONG_MAX;
+  }
+
+  return ptr_scheduler->tasks_array[0].deadline_ticks;
+}
+
+/**
+ *  @brief Get the size (bytes) of the backend's own static arenas: the
+ *  @link{task_positions} index of the queue state (per scheduler instance)
+ *
+ *  @param {void} - no params expected
+ *
+ *  @return {size_t} - size of the arenas (bytes)
+ *
+ */
+size_t task_queue_get_arena_size(void) {
+  return sizeof(TASK_QUEUE_STATE);
+}
+
+#endif
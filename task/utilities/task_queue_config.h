@@ -0,0 +1,155 @@
+#ifndef TASK_QUEUE_CONFIG_H
+#define TASK_QUEUE_CONFIG_H
+
+#include <stdint.h>
+
+#include "../environment/config.h"
+
+/**
+ *  @details
+ *  - TASK_QUEUE_DONE_SUCCESSFULLY - no errors, done successfully
+ *  - TASK_QUEUE_FULL - no free space in the @link{tasks_array}
+ *  - TASK_QUEUE_EMPTY - current task counter value is 0
+ *  - TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED - no such task with given ID
+ *
+ */
+enum Task_queue_errors_codes {
+  TASK_QUEUE_DONE_SUCCESSFULLY = 0, /**< no errors, done successfully */
+  TASK_QUEUE_FULL = 1,  /**< no free space in the @link{tasks_array} */
+  TASK_QUEUE_EMPTY = 2, /**< current task counter value is 0 */
+  TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED = 3, /**< no such task with given ID */
+};
+
+#if TASK_QUEUE_BACKEND == TASK_QUEUE_BACKEND_TIMING_WHEEL
+/**
+ *  @details
+ *  Hierarchical (cascading) timing wheel with 1 ms resolution.
+ *  - TIMING_WHEEL_SLOT_BITS - 2 ** 6 = 64 slots per level, so the occupancy of
+ *    the level fits one 64-bit word
+ *  - TIMING_WHEEL_SLOTS - quantity of slots per level
+ *  - TIMING_WHEEL_SLOT_MASK - mask to get the slot index of the level
+ *  - TIMING_WHEEL_LEVELS - quantity of levels i.e. 64 ** 8 ms ~ 8900 years
+ *    range, so any 64-bit deadline (ns) is placed to a level directly and
+ *    costs one cascading per level at most (the overflow bucket is a guard)
+ *  - TIMING_WHEEL_READY_BUCKET - bucket of the expired (drained) tasks
+ *  - TIMING_WHEEL_OVERFLOW_BUCKET - bucket of the tasks beyond the last level
+ *  - TIMING_WHEEL_BUCKETS - quantity of the buckets (slots of all levels,
+ *    ready and overflow ones)
+ *  - TIMING_WHEEL_NO_BUCKET - the task is not in the wheel
+ *  - TIMING_WHEEL_NO_TASK - "null" link of the buckets' lists
+ *
+ */
+enum Timing_wheel_variables {
+  TIMING_WHEEL_SLOT_BITS = 6, /**< 2 ** 6 = 64 slots per level */
+  TIMING_WHEEL_SLOTS = 1 << TIMING_WHEEL_SLOT_BITS, /**< slots per level */
+  TIMING_WHEEL_SLOT_MASK = TIMING_WHEEL_SLOTS - 1,  /**< slot index mask */
+  TIMING_WHEEL_LEVELS = 8, /**< 64 ** 8 ms ~ 8900 years range */
+  TIMING_WHEEL_READY_BUCKET =
+      TIMING_WHEEL_LEVELS * TIMING_WHEEL_SLOTS, /**< expired tasks */
+  TIMING_WHEEL_OVERFLOW_BUCKET =
+      TIMING_WHEEL_READY_BUCKET + 1, /**< tasks beyond the last level */
+  TIMING_WHEEL_BUCKETS = TIMING_WHEEL_OVERFLOW_BUCKET + 1, /**< all buckets */
+  TIMING_WHEEL_NO_BUCKET = TIMING_WHEEL_BUCKETS, /**< task is not linked */
+  TIMING_WHEEL_NO_TASK = MAX_TASK_QUANTITY,      /**< "null" link */
+};
+
+/**
+ *  @details
+ *  The queue backend's state of the scheduler instance ( @see{Scheduler} ):
+ *  the buckets are doubly linked lists over the indexes of the
+ *  @link{tasks_array} (the tasks are nested via their id, i.e.
+ *  Task.id == index)
+ *  - bucket_heads, bucket_tails - the buckets' lists
+ *  - next_links, prev_links - the links of the tasks
+ *  - task_buckets - task id => its' bucket
+ *  - slots_bitmaps - occupancy of the slots per level
+ *  - wheel_timestamp_ms - next tick (ms) to process
+ *  - is_initialized - the buckets' lists are initialized (zero initialized
+ *    state => not yet)
+ *
+ */
+typedef struct s_Task_queue_state {
+  TASK_COUNTER bucket_heads[TIMING_WHEEL_BUCKETS]; /**< the lists' heads */
+  TASK_COUNTER bucket_tails[TIMING_WHEEL_BUCKETS]; /**< the lists' tails */
+  TASK_COUNTER next_links[MAX_TASK_QUANTITY];      /**< next task */
+  TASK_COUNTER prev_links[MAX_TASK_QUANTITY];      /**< previous task */
+  unsigned short task_buckets[MAX_TASK_QUANTITY];  /**< id => bucket */
+  uint64_t slots_bitmaps[TIMING_WHEEL_LEVELS];     /**< occupied slots */
+  long long wheel_timestamp_ms; /**< next tick (ms) to process */
+  bool is_initialized;          /**< the lists are initialized */
+} TASK_QUEUE_STATE;
+#elif TASK_QUEUE_BACKEND == TASK_QUEUE_BACKEND_PACKED_DEADLINES
+/**
+ *  @details
+ *  The queue backend's state of the scheduler instance ( @see{Scheduler} ):
+ *  the deadlines of the @link{tasks_array} packed to the contiguous array
+ *  (index => deadline), so the expiry scan touches 8 bytes per task instead
+ *  of the whole @type{Task}
+ *  - packed_deadlines - index of the task => its' Task.deadline_ticks
+ *  - task_positions - task id => index of the task in the @link{tasks_array}
+ *  - ready_count - the expired tasks (drained via @link{task_queue_advance})
+ *    are the first ones of the @link{tasks_array}, sorted descending by the
+ *    deadline, the rest ones are unordered
+ *
+ */
+typedef struct s_Task_queue_state {
+  _Alignas(64) TASK_TICKS packed_deadlines[MAX_TASK_QUANTITY]; /**< deadlines */
+  TASK_COUNTER task_positions[MAX_TASK_QUANTITY]; /**< id => index */
+  TASK_COUNTER ready_count; /**< the expired tasks at the front */
+} TASK_QUEUE_STATE;
+#else
+/**
+ *  @details
+ *  The queue backend's state of the scheduler instance ( @see{Scheduler} )
+ *  - task_positions - task id => index of the task in the @link{tasks_array}
+ *
+ */
+typedef struct s_Task_queue_state {
+  TASK_COUNTER task_positions[MAX_TASK_QUANTITY]; /**< id => index */
+} TASK_QUEUE_STATE;
+#endif
+
+/**
+ *  @details
+ *  Storage engine (backend) interface for the @link{tasks_array}. The model
+ *  layer handlers use only these functions, so the backend is replaceable at
+ *  build time via @link{TASK_QUEUE_BACKEND} (@see{config.h}).
+ *  - task_queue_push - nest the task to the queue
+ *  - task_queue_advance - let the queue know the current monotonic timestamp
+ *    (ns), so the tasks expired till that moment are ready to be peeked
+ *  - task_queue_peek - get the next task to serve (or NULL), i.e. the task
+ *    with the earliest deadline, or for the timing wheel backend the first
+ *    one of the drained (expired) slots, for the packed deadlines backend
+ *    the earliest one of the drained tasks (if any)
+ *  - task_queue_pop - remove the task with the earliest deadline (the peeked
+ *    one)
+ *  - task_queue_remove - remove the task via its' id
+ *  - task_queue_reschedule - set up new delay (ms) and creation timestamp of
+ *    the task via its' id
+ *  - task_queue_peek_furthest - get the task with the latest deadline (or
+ *    NULL), the eviction candidate of the full queue
+ *  - task_queue_get_next_deadline - the monotonic timestamp (ns) the queue
+ *    has to be advanced at next, i.e. the earliest deadline (for the timing
+ *    wheel backend the start of the next occupied slot, a lower bound of it)
+ *  - task_queue_get_arena_size - size (bytes) of the backend's own static
+ *    arenas per scheduler instance (i.e. besides the @link{tasks_array})
+ *
+ *  @note Every function works with the given scheduler instance (its'
+ *  @link{tasks_array}, @link{task_count} and @type{TASK_QUEUE_STATE})
+ *
+ */
+enum Task_queue_errors_codes task_queue_push(Scheduler *ptr_scheduler,
+                                             Task task);
+void task_queue_advance(Scheduler *ptr_scheduler, TASK_TICKS current_ticks);
+Task *task_queue_peek(Scheduler *ptr_scheduler);
+enum Task_queue_errors_codes task_queue_pop(Scheduler *ptr_scheduler);
+enum Task_queue_errors_codes task_queue_remove(Scheduler *ptr_scheduler,
+                                               TASK_COUNTER id);
+enum Task_queue_errors_codes
+task_queue_reschedule(Scheduler *ptr_scheduler, TASK_COUNTER id,
+                      TASK_DELAY new_delay, TASK_TICKS created_ticks);
+Task *task_queue_peek_furthest(Scheduler *ptr_scheduler);
+TASK_TICKS task_queue_get_next_deadline(const Scheduler *ptr_scheduler);
+size_t task_queue_get_arena_size(void);
+
+#endif
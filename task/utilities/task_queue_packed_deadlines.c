@@ -0,0 +1,477 @@
+#include "../environment/config.h"
+
+#if TASK_QUEUE_BACKEND == TASK_QUEUE_BACKEND_PACKED_DEADLINES
+
+#include <limits.h>
+
+#include "../environment/scheduler_config.h"
+#include "./utils.h"
+
+enum Packed_deadlines_variables {
+  PACKED_DEADLINES_BLOCK = 64, /**< deadlines per expiry bitmap */
+};
+
+/**
+ *  @brief Utility function (encapsulated) to get the index of the task via its'
+ *  id. O(1) lookup via @link{task_positions} (validated against the task's id,
+ *  so the stale entries of the removed tasks are never trusted)
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{tasks_array} and @link{task_count} of
+ *    the @link{ptr_scheduler}
+ *  - implicit dependency on the @link{task_positions} of the
+ *    @link{ptr_scheduler}'s queue state
+ *
+ *  @param {const Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} id - id of the task
+ *
+ *  @return {TASK_COUNTER} - index of the task in the @link{tasks_array} or
+ *  @link{task_count} if there's no task with such id
+ *
+ */
+static TASK_COUNTER find_task_index(const Scheduler *ptr_scheduler,
+                                    TASK_COUNTER id) {
+  if (id >= MAX_TASK_QUANTITY) {
+    return ptr_scheduler->task_count;
+  }
+
+  TASK_COUNTER index = ptr_scheduler->queue.task_positions[id];
+
+  if ((index < ptr_scheduler->task_count) &&
+      (ptr_scheduler->tasks_array[index].id == id)) {
+    return index;
+  }
+
+  return ptr_scheduler->task_count;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to move the task (and its' packed
+ *  deadline) to the other index of the @link{tasks_array}
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the @link{packed_deadlines} and @link{task_positions} of the
+ *    @link{ptr_scheduler}'s queue state ( @see{TASK_QUEUE_STATE} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} from_index - current index of the task
+ *  @param {TASK_COUNTER} to_index - new index of the task
+ *
+ */
+static void move_task(Scheduler *ptr_scheduler, TASK_COUNTER from_index,
+                      TASK_COUNTER to_index) {
+  TASK_QUEUE_STATE *ptr_queue = &ptr_scheduler->queue;
+
+  ptr_scheduler->tasks_array[to_index] = ptr_scheduler->tasks_array[from_index];
+  ptr_queue->packed_deadlines[to_index] =
+      ptr_queue->packed_deadlines[from_index];
+  ptr_queue->task_positions[ptr_scheduler->tasks_array[to_index].id] = to_index;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to swap two tasks (and their packed
+ *  deadlines) of the @link{tasks_array} via their indexes
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the @link{packed_deadlines} and @link{task_positions} of the
+ *    @link{ptr_scheduler}'s queue state ( @see{TASK_QUEUE_STATE} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} index_a - index of the task in the @link{tasks_array}
+ *  @param {TASK_COUNTER} index_b - index of the task in the @link{tasks_array}
+ *
+ */
+static void swap_tasks(Scheduler *ptr_scheduler, TASK_COUNTER index_a,
+                       TASK_COUNTER index_b) {
+  Task *tasks_array = ptr_scheduler->tasks_array;
+  TASK_QUEUE_STATE *ptr_queue = &ptr_scheduler->queue;
+
+  Task temp = tasks_array[index_a];
+  tasks_array[index_a] = tasks_array[index_b];
+  tasks_array[index_b] = temp;
+
+  TASK_TICKS temp_ticks = ptr_queue->packed_deadlines[index_a];
+  ptr_queue->packed_deadlines[index_a] = ptr_queue->packed_deadlines[index_b];
+  ptr_queue->packed_deadlines[index_b] = temp_ticks;
+
+  ptr_queue->task_positions[tasks_array[index_a].id] = index_a;
+  ptr_queue->task_positions[tasks_array[index_b].id] = index_b;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to remove the task via its' index.
+ *  The drained tasks keep their order (the later ones are shifted), the hole
+ *  of the unordered rest is filled with the last task
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{task_count} and @link{tasks_array} of the
+ *    @link{ptr_scheduler}
+ *  - mutates the @link{packed_deadlines}, @link{task_positions} and
+ *    @link{ready_count} of the @link{ptr_scheduler}'s queue state (
+ *    @see{TASK_QUEUE_STATE} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} index - index of the task in the @link{tasks_array}
+ *
+ */
+static void remove_task_at(Scheduler *ptr_scheduler, TASK_COUNTER index) {
+  TASK_QUEUE_STATE *ptr_queue = &ptr_scheduler->queue;
+  TASK_COUNTER hole_index = index;
+
+  if (index < ptr_queue->ready_count) {
+    for (TASK_COUNTER i = index; i + 1 < ptr_queue->ready_count; i += 1) {
+      move_task(ptr_scheduler, i + 1, i);
+    }
+
+    ptr_queue->ready_count -= 1;
+    hole_index = ptr_queue->ready_count;
+  }
+
+  const TASK_COUNTER LAST_INDEX = ptr_scheduler->task_count - 1;
+
+  if (hole_index != LAST_INDEX) {
+    move_task(ptr_scheduler, LAST_INDEX, hole_index);
+  }
+
+  ptr_scheduler->tasks_array[LAST_INDEX] = (Task){0};
+  ptr_queue->packed_deadlines[LAST_INDEX] = 0;
+  ptr_scheduler->task_count -= 1;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get the index of the task to
+ *  serve next: the earliest drained one or (if none) the one with the least
+ *  packed deadline
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{task_count} of the @link{ptr_scheduler}
+ *  - implicit dependency on the @link{packed_deadlines} and
+ *    @link{ready_count} of the @link{ptr_scheduler}'s queue state
+ *  - implicit dependency on @callback{get_earliest_deadline_index}
+ *
+ *  @param {const Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {TASK_COUNTER} - index of the task in the @link{tasks_array} (the
+ *  queue must not be empty)
+ *
+ */
+static TASK_COUNTER get_head_index(const Scheduler *ptr_scheduler) {
+  if (ptr_scheduler->queue.ready_count > 0) {
+    return ptr_scheduler->queue.ready_count - 1;
+  }
+
+  return (TASK_COUNTER)get_earliest_deadline_index(
+      ptr_scheduler->queue.packed_deadlines, ptr_scheduler->task_count);
+}
+
+/**
+ *  @brief Nest the task to the end of the @link{tasks_array} and its'
+ *  deadline to the end of the @link{packed_deadlines}. O(1)
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{task_count} and @link{tasks_array} of the
+ *    @link{ptr_scheduler}
+ *  - mutates the @link{packed_deadlines} and @link{task_positions} of the
+ *    @link{ptr_scheduler}'s queue state ( @see{TASK_QUEUE_STATE} )
+ *  - implicit dependency on global variable @link{MAX_TASK_QUANTITY}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {Task} task - the task to nest
+ *
+ *  @return {enum Task_queue_errors_codes} - TASK_QUEUE_DONE_SUCCESSFULLY
+ *  @throw TASK_QUEUE_FULL - no free space in the @link{tasks_array}
+ *  @throw TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED - the task's id is out of range
+ *  or the task with such id is queued already
+ *
+ */
+enum Task_queue_errors_codes task_queue_push(Scheduler *ptr_scheduler,
+                                             Task task) {
+  if (ptr_scheduler->task_count >= MAX_TASK_QUANTITY) {
+    return TASK_QUEUE_FULL;
+  }
+
+  // the id is the key of the @link{task_positions} => it must be in range and
+  // must not be queued already
+  if ((task.id >= MAX_TASK_QUANTITY) ||
+      (find_task_index(ptr_scheduler, task.id) != ptr_scheduler->task_count)) {
+    return TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED;
+  }
+
+  const TASK_COUNTER INDEX = ptr_scheduler->task_count;
+
+  ptr_scheduler->tasks_array[INDEX] = task;
+  ptr_scheduler->queue.packed_deadlines[INDEX] = task.deadline_ticks;
+  ptr_scheduler->queue.task_positions[task.id] = INDEX;
+  ptr_scheduler->task_count += 1;
+
+  return TASK_QUEUE_DONE_SUCCESSFULLY;
+}
+
+/**
+ *  @brief Drain the tasks expired till @link{current_ticks} to the front of
+ *  the @link{tasks_array} (sorted descending by the deadline, so the earliest
+ *  one is served first). The expired ones are found via the bitmaps of the
+ *  vectorised scan of the @link{packed_deadlines} (64 deadlines per bitmap)
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the @link{packed_deadlines}, @link{task_positions} and
+ *    @link{ready_count} of the @link{ptr_scheduler}'s queue state (
+ *    @see{TASK_QUEUE_STATE} )
+ *  - implicit dependency on @callback{get_expired_deadlines_mask}
+ *  - implicit dependency on @callback{sort_tasks_descending_by_deadline_func}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_TICKS} current_ticks - current monotonic timestamp (ns)
+ *
+ */
+void task_queue_advance(Scheduler *ptr_scheduler, TASK_TICKS current_ticks) {
+  TASK_QUEUE_STATE *ptr_queue = &ptr_scheduler->queue;
+  const TASK_COUNTER TASK_COUNT = ptr_scheduler->task_count;
+  const TASK_COUNTER DRAINED_COUNT = ptr_queue->ready_count;
+
+  // the indexes between @link{ready_count} and the scanned one are never
+  // expired, so the swap moves the not expired task behind the scan
+  for (size_t block = DRAINED_COUNT; block < TASK_COUNT;
+       block += PACKED_DEADLINES_BLOCK) {
+    const size_t QUANTITY = TASK_COUNT - block < PACKED_DEADLINES_BLOCK
+                                ? TASK_COUNT - block
+                                : PACKED_DEADLINES_BLOCK;
+    uint64_t expired_mask = get_expired_deadlines_mask(
+        &ptr_queue->packed_deadlines[block], QUANTITY, current_ticks);
+
+    while (expired_mask != 0) {
+      swap_tasks(ptr_scheduler, ptr_queue->ready_count,
+                 (TASK_COUNTER)(block + __builtin_ctzll(expired_mask)));
+      ptr_queue->ready_count += 1;
+      expired_mask &= expired_mask - 1;
+    }
+  }
+
+  if (ptr_queue->ready_count == DRAINED_COUNT) {
+    return;
+  }
+
+  sort_tasks_descending_by_deadline(ptr_scheduler->tasks_array,
+                                    MAX_TASK_QUANTITY, ptr_queue->ready_count);
+
+  for (TASK_COUNTER i = 0; i < ptr_queue->ready_count; i += 1) {
+    const Task *ptr_task = &ptr_scheduler->tasks_array[i];
+
+    ptr_queue->packed_deadlines[i] = ptr_task->deadline_ticks;
+    ptr_queue->task_positions[ptr_task->id] = i;
+  }
+}
+
+/**
+ *  @brief Get the earliest drained task or (if none) the task with the least
+ *  deadline (the vectorised scan of the @link{packed_deadlines})
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{tasks_array} and @link{task_count} of
+ *    the @link{ptr_scheduler}
+ *  - implicit dependency on @callback{get_head_index}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {Task *} - pointer to the task or NULL if @link{tasks_array} is
+ *  empty
+ *
+ */
+Task *task_queue_peek(Scheduler *ptr_scheduler) {
+  if (ptr_scheduler->task_count == 0) {
+    return NULL;
+  }
+
+  return &ptr_scheduler->tasks_array[get_head_index(ptr_scheduler)];
+}
+
+/**
+ *  @brief Remove the peeked task ( @see{task_queue_peek} ). O(1) for the
+ *  drained one
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{task_count} and @link{tasks_array} of the
+ *    @link{ptr_scheduler}
+ *  - mutates the @link{packed_deadlines}, @link{task_positions} and
+ *    @link{ready_count} of the @link{ptr_scheduler}'s queue state (
+ *    @see{TASK_QUEUE_STATE} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {enum Task_queue_errors_codes} - TASK_QUEUE_DONE_SUCCESSFULLY
+ *  @throw TASK_QUEUE_EMPTY - current task counter value is 0
+ *
+ */
+enum Task_queue_errors_codes task_queue_pop(Scheduler *ptr_scheduler) {
+  if (ptr_scheduler->task_count == 0) {
+    return TASK_QUEUE_EMPTY;
+  }
+
+  remove_task_at(ptr_scheduler, get_head_index(ptr_scheduler));
+
+  return TASK_QUEUE_DONE_SUCCESSFULLY;
+}
+
+/**
+ *  @brief Remove the task via its' id from the @link{tasks_array}. O(1) for
+ *  the not drained one
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{task_count} and @link{tasks_array} of the
+ *    @link{ptr_scheduler}
+ *  - mutates the @link{packed_deadlines}, @link{task_positions} and
+ *    @link{ready_count} of the @link{ptr_scheduler}'s queue state (
+ *    @see{TASK_QUEUE_STATE} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} id - id of the task to remove
+ *
+ *  @return {enum Task_queue_errors_codes} - TASK_QUEUE_DONE_SUCCESSFULLY
+ *  @throw TASK_QUEUE_EMPTY - current task counter value is 0
+ *  @throw TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED - no such task with given ID
+ *
+ */
+enum Task_queue_errors_codes task_queue_remove(Scheduler *ptr_scheduler,
+                                               TASK_COUNTER id) {
+  if (ptr_scheduler->task_count == 0) {
+    return TASK_QUEUE_EMPTY;
+  }
+
+  TASK_COUNTER index = find_task_index(ptr_scheduler, id);
+
+  if (index == ptr_scheduler->task_count) {
+    return TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED;
+  }
+
+  remove_task_at(ptr_scheduler, index);
+
+  return TASK_QUEUE_DONE_SUCCESSFULLY;
+}
+
+/**
+ *  @brief Set up new delay (ms) and creation timestamp of the task via its' id
+ *  (the drained task is moved back to the not drained ones)
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the @link{packed_deadlines}, @link{task_positions} and
+ *    @link{ready_count} of the @link{ptr_scheduler}'s queue state (
+ *    @see{TASK_QUEUE_STATE} )
+ *  - implicit dependency on @callback{set_task_delay}
+ *  - implicit dependency on the @link{slacks} of the @link{ptr_scheduler}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} id - id of the task to reschedule
+ *  @param {TASK_DELAY} new_delay - new delay value (ms!)
+ *  @param {TASK_TICKS} created_ticks - new creation monotonic timestamp (ns)
+ *
+ *  @return {enum Task_queue_errors_codes} - TASK_QUEUE_DONE_SUCCESSFULLY
+ *  @throw TASK_QUEUE_EMPTY - current task counter value is 0
+ *  @throw TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED - no such task with given ID
+ *
+ */
+enum Task_queue_errors_codes
+task_queue_reschedule(Scheduler *ptr_scheduler, TASK_COUNTER id,
+                      TASK_DELAY new_delay, TASK_TICKS created_ticks) {
+  if (ptr_scheduler->task_count == 0) {
+    return TASK_QUEUE_EMPTY;
+  }
+
+  TASK_COUNTER index = find_task_index(ptr_scheduler, id);
+
+  if (index == ptr_scheduler->task_count) {
+    return TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED;
+  }
+
+  Task task = ptr_scheduler->tasks_array[index];
+
+  set_task_delay(&task, new_delay, ptr_scheduler->slacks.task_slacks[id],
+                 created_ticks);
+
+  // the drained tasks are ordered => take the task out and nest it again
+  if (index < ptr_scheduler->queue.ready_count) {
+    remove_task_at(ptr_scheduler, index);
+
+    return task_queue_push(ptr_scheduler, task);
+  }
+
+  ptr_scheduler->tasks_array[index] = task;
+  ptr_scheduler->queue.packed_deadlines[index] = task.deadline_ticks;
+
+  return TASK_QUEUE_DONE_SUCCESSFULLY;
+}
+
+/**
+ *  @brief Get the task with the latest deadline (the eviction candidate,
+ *  @see{handle_full_queue}). O(n)
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{tasks_array} and @link{task_count} of
+ *    the @link{ptr_scheduler}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {Task *} - pointer to the task or NULL if @link{tasks_array} is
+ *  empty
+ *
+ */
+Task *task_queue_peek_furthest(Scheduler *ptr_scheduler) {
+  if (ptr_scheduler->task_count == 0) {
+    return NULL;
+  }
+
+  Task *ptr_furthest = &ptr_scheduler->tasks_array[0];
+
+  for (TASK_COUNTER i = 1; i < ptr_scheduler->task_count; i += 1) {
+    if (ptr_scheduler->tasks_array[i].deadline_ticks >
+        ptr_furthest->deadline_ticks) {
+      ptr_furthest = &ptr_scheduler->tasks_array[i];
+    }
+  }
+
+  return ptr_furthest;
+}
+
+/**
+ *  @brief Get the earliest deadline of the queue (the vectorised scan of the
+ *  @link{packed_deadlines}). O(n)
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{task_count} of the @link{ptr_scheduler}
+ *  - implicit dependency on the @link{packed_deadlines} of the
+ *    @link{ptr_scheduler}'s queue state
+ *  - implicit dependency on @callback{get_earliest_deadline_index}
+ *
+ *  @param {const Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {TASK_TICKS} - monotonic timestamp (ns) or LLONG_MAX if the
+ *  @link{tasks_array} is empty
+ *
+ */
+TASK_TICKS task_queue_get_next_deadline(const Scheduler *ptr_scheduler) {
+  if (ptr_scheduler->task_count == 0) {
+    return LLONG_MAX;
+  }
+
+  return ptr_scheduler->queue.packed_deadlines[get_earliest_deadline_index(
+      ptr_scheduler->queue.packed_deadlines, ptr_scheduler->task_count)];
+}
+
+/**
+ *  @brief Get the size (bytes) of the backend's own static arenas: the
+ *  @link{packed_deadlines} and @link{task_positions} of the queue state (per
+ *  scheduler instance)
+ *
+ *  @param {void} - no params expected
+ *
+ *  @return {size_t} - size of the arenas (bytes)
+ *
+ */
+size_t task_queue_get_arena_size(void) {
+  return sizeof(TASK_QUEUE_STATE);
+}
+
+#endif
@@ -0,0 +1,338 @@
+#include "../environment/config.h"
+
+#if TASK_QUEUE_BACKEND == TASK_QUEUE_BACKEND_SORTED_ARRAY
+
+#include <limits.h>
+
+#include "../environment/scheduler_config.h"
+#include "./utils.h"
+
+/**
+ *  @brief Utility function (encapsulated) to get the index of the task via its'
+ *  id. O(1) lookup via @link{task_positions} (validated against the task's id,
+ *  so the stale entries of the removed tasks are never trusted)
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{tasks_array} and @link{task_count} of
+ *    the @link{ptr_scheduler}
+ *  - implicit dependency on the @link{task_positions} of the
+ *    @link{ptr_scheduler}'s queue state
+ *
+ *  @param {const Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} id - id of the task
+ *
+ *  @return {TASK_COUNTER} - index of the task in the @link{tasks_array} or
+ *  @link{task_count} if there's no task with such id
+ *
+ */
+static TASK_COUNTER find_task_index(const Scheduler *ptr_scheduler,
+                                    TASK_COUNTER id) {
+  if (id >= MAX_TASK_QUANTITY) {
+    return ptr_scheduler->task_count;
+  }
+
+  TASK_COUNTER index = ptr_scheduler->queue.task_positions[id];
+
+  if ((index < ptr_scheduler->task_count) &&
+      (ptr_scheduler->tasks_array[index].id == id)) {
+    return index;
+  }
+
+  return ptr_scheduler->task_count;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to rebuild the
+ *  @link{task_positions} after the sort of the @link{tasks_array}
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{task_positions} of the @link{ptr_scheduler}'s queue
+ *    state ( @see{TASK_QUEUE_STATE} )
+ *  - implicit dependency on the @link{tasks_array} and @link{task_count} of
+ *    the @link{ptr_scheduler}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ */
+static void reindex_tasks(Scheduler *ptr_scheduler) {
+  for (TASK_COUNTER i = 0; i < ptr_scheduler->task_count; i += 1) {
+    ptr_scheduler->queue.task_positions[ptr_scheduler->tasks_array[i].id] = i;
+  }
+}
+
+/**
+ *  @brief Nest the task to the @link{tasks_array} sorted descending via
+ *  Task.deadline_ticks (ns) i.e. the least deadline has greater index
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{task_count} and @link{tasks_array} of the
+ *    @link{ptr_scheduler}
+ *  - mutates the @link{task_positions} of the @link{ptr_scheduler}'s queue
+ *    state ( @see{TASK_QUEUE_STATE} )
+ *  - implicit dependency on global variable @link{MAX_TASK_QUANTITY}
+ *  - implicit dependency on @callback{sort_tasks_descending_by_deadline_func}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {Task} task - the task to nest
+ *
+ *  @return {enum Task_queue_errors_codes} - TASK_QUEUE_DONE_SUCCESSFULLY
+ *  @throw TASK_QUEUE_FULL - no free space in the @link{tasks_array}
+ *  @throw TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED - the task's id is out of range
+ *  or the task with such id is queued already
+ *
+ */
+enum Task_queue_errors_codes task_queue_push(Scheduler *ptr_scheduler,
+                                             Task task) {
+  if (ptr_scheduler->task_count >= MAX_TASK_QUANTITY) {
+    return TASK_QUEUE_FULL;
+  }
+
+  // the id is the key of the @link{task_positions} => it must be in range and
+  // must not be queued already
+  if ((task.id >= MAX_TASK_QUANTITY) ||
+      (find_task_index(ptr_scheduler, task.id) != ptr_scheduler->task_count)) {
+    return TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED;
+  }
+
+  Task *tasks_array = ptr_scheduler->tasks_array;
+
+  tasks_array[ptr_scheduler->task_count] = task;
+  ptr_scheduler->task_count += 1;
+
+  const TASK_COUNTER TASK_COUNT = ptr_scheduler->task_count;
+
+  // sort only if @link{tasks_array} contains at least two tasks and the added
+  // task's deadline is greater than previous @link{tasks_array} 's task
+  // deadline (otherwise the added task is the least one and it's on top)
+  if ((TASK_COUNT > 1) && (tasks_array[TASK_COUNT - 1].deadline_ticks >
+                           tasks_array[TASK_COUNT - 2].deadline_ticks)) {
+    sort_tasks_descending_by_deadline(tasks_array, MAX_TASK_QUANTITY,
+                                      TASK_COUNT);
+    reindex_tasks(ptr_scheduler);
+  } else {
+    ptr_scheduler->queue.task_positions[task.id] = TASK_COUNT - 1;
+  }
+
+  return TASK_QUEUE_DONE_SUCCESSFULLY;
+}
+
+/**
+ *  @brief Nothing to advance: the last task of the @link{tasks_array} is
+ *  always the task with the least deadline
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_TICKS} current_ticks - current monotonic timestamp (ns)
+ *
+ */
+void task_queue_advance(Scheduler *ptr_scheduler, TASK_TICKS current_ticks) {
+  (void)ptr_scheduler;
+  (void)current_ticks;
+}
+
+/**
+ *  @brief Get the task with the least deadline (the last one of the
+ *  @link{tasks_array})
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{tasks_array} and @link{task_count} of
+ *    the @link{ptr_scheduler}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {Task *} - pointer to the task or NULL if @link{tasks_array} is
+ *  empty
+ *
+ */
+Task *task_queue_peek(Scheduler *ptr_scheduler) {
+  if (ptr_scheduler->task_count == 0) {
+    return NULL;
+  }
+
+  return &ptr_scheduler->tasks_array[ptr_scheduler->task_count - 1];
+}
+
+/**
+ *  @brief Remove the task with the least deadline (the last one of the
+ *  @link{tasks_array})
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{task_count} and @link{tasks_array} of the
+ *    @link{ptr_scheduler}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {enum Task_queue_errors_codes} - TASK_QUEUE_DONE_SUCCESSFULLY
+ *  @throw TASK_QUEUE_EMPTY - current task counter value is 0
+ *
+ */
+enum Task_queue_errors_codes task_queue_pop(Scheduler *ptr_scheduler) {
+  if (ptr_scheduler->task_count == 0) {
+    return TASK_QUEUE_EMPTY;
+  }
+
+  ptr_scheduler->tasks_array[ptr_scheduler->task_count - 1] = (Task){0};
+  ptr_scheduler->task_count -= 1;
+
+  return TASK_QUEUE_DONE_SUCCESSFULLY;
+}
+
+/**
+ *  @brief Remove the task via its' id from the @link{tasks_array} (make it
+ *  zero struct i.e. (Task){0} and resort the array)
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{task_count} and @link{tasks_array} of the
+ *    @link{ptr_scheduler}
+ *  - mutates the @link{task_positions} of the @link{ptr_scheduler}'s queue
+ *    state ( @see{TASK_QUEUE_STATE} )
+ *  - implicit dependency on @callback{sort_tasks_descending_by_deadline_func}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} id - id of the task to remove
+ *
+ *  @return {enum Task_queue_errors_codes} - TASK_QUEUE_DONE_SUCCESSFULLY
+ *  @throw TASK_QUEUE_EMPTY - current task counter value is 0
+ *  @throw TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED - no such task with given ID
+ *
+ */
+enum Task_queue_errors_codes task_queue_remove(Scheduler *ptr_scheduler,
+                                               TASK_COUNTER id) {
+  if (ptr_scheduler->task_count == 0) {
+    return TASK_QUEUE_EMPTY;
+  }
+
+  TASK_COUNTER index = find_task_index(ptr_scheduler, id);
+
+  if (index == ptr_scheduler->task_count) {
+    return TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED;
+  }
+
+  // remove the Task => swap Task to (Task){0} (i.e. zero deadline, so it goes
+  // to the end of the @link{tasks_array} after the sort)
+  ptr_scheduler->tasks_array[index] = (Task){0};
+
+  if (ptr_scheduler->task_count > 1) {
+    sort_tasks_descending_by_deadline(ptr_scheduler->tasks_array,
+                                      MAX_TASK_QUANTITY,
+                                      ptr_scheduler->task_count);
+  }
+
+  ptr_scheduler->task_count -= 1;
+  reindex_tasks(ptr_scheduler);
+
+  return TASK_QUEUE_DONE_SUCCESSFULLY;
+}
+
+/**
+ *  @brief Set up new delay (ms) and creation timestamp of the task via its' id
+ *  and resort the @link{tasks_array} if needed
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the @link{task_positions} of the @link{ptr_scheduler}'s queue
+ *    state ( @see{TASK_QUEUE_STATE} )
+ *  - implicit dependency on @callback{set_task_delay}
+ *  - implicit dependency on the @link{slacks} of the @link{ptr_scheduler}
+ *  - implicit dependency on @callback{sort_tasks_descending_by_deadline_func}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} id - id of the task to reschedule
+ *  @param {TASK_DELAY} new_delay - new delay value (ms!)
+ *  @param {TASK_TICKS} created_ticks - new creation monotonic timestamp (ns)
+ *
+ *  @return {enum Task_queue_errors_codes} - TASK_QUEUE_DONE_SUCCESSFULLY
+ *  @throw TASK_QUEUE_EMPTY - current task counter value is 0
+ *  @throw TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED - no such task with given ID
+ *
+ */
+enum Task_queue_errors_codes
+task_queue_reschedule(Scheduler *ptr_scheduler, TASK_COUNTER id,
+                      TASK_DELAY new_delay, TASK_TICKS created_ticks) {
+  if (ptr_scheduler->task_count == 0) {
+    return TASK_QUEUE_EMPTY;
+  }
+
+  TASK_COUNTER index = find_task_index(ptr_scheduler, id);
+
+  if (index == ptr_scheduler->task_count) {
+    return TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED;
+  }
+
+  Task *tasks_array = ptr_scheduler->tasks_array;
+  const TASK_COUNTER TASK_COUNT = ptr_scheduler->task_count;
+
+  set_task_delay(&tasks_array[index], new_delay,
+                 ptr_scheduler->slacks.task_slacks[id], created_ticks);
+
+  // sort only if the descending order is broken at the neighbours
+  if (((index > 0) && (tasks_array[index].deadline_ticks >
+                       tasks_array[index - 1].deadline_ticks)) ||
+      ((index + 1 < TASK_COUNT) && (tasks_array[index].deadline_ticks <
+                                    tasks_array[index + 1].deadline_ticks))) {
+    sort_tasks_descending_by_deadline(tasks_array, MAX_TASK_QUANTITY,
+                                      TASK_COUNT);
+    reindex_tasks(ptr_scheduler);
+  }
+
+  return TASK_QUEUE_DONE_SUCCESSFULLY;
+}
+
+/**
+ *  @brief Get the task with the latest deadline (the eviction candidate,
+ *  @see{handle_full_queue}): the first one of the @link{tasks_array}. O(1)
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{tasks_array} and @link{task_count} of
+ *    the @link{ptr_scheduler}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {Task *} - pointer to the task or NULL if @link{tasks_array} is
+ *  empty
+ *
+ */
+Task *task_queue_peek_furthest(Scheduler *ptr_scheduler) {
+  if (ptr_scheduler->task_count == 0) {
+    return NULL;
+  }
+
+  return &ptr_scheduler->tasks_array[0];
+}
+
+/**
+ *  @brief Get the earliest deadline of the queue (the last task of
+ *  the @link{tasks_array}). O(1)
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{tasks_array} and @link{task_count} of
+ *    the @link{ptr_scheduler}
+ *
+ *  @param {const Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {TASK_TICKS} - monotonic timestamp (ns) or LLONG_MAX if the
+ *  @link{tasks_array} is empty
+ *
+ */
+TASK_TICKS task_queue_get_next_deadline(const Scheduler *ptr_scheduler) {
+  if (ptr_scheduler->task_count == 0) {
+    return LLONG_MAX;
+  }
+
+  return ptr_scheduler->tasks_array[ptr_scheduler->task_count - 1]
+      .deadline_ticks;
+}
+
+/**
+ *  @brief Get the size (bytes) of the backend's own static arenas: the
+ *  @link{task_positions} index of the queue state (per scheduler instance)
+ *
+ *  @param {void} - no params expected
+ *
+ *  @return {size_t} - size of the arenas (bytes)
+ *
+ */
+size_t task_queue_get_arena_size(void) {
+  return sizeof(TASK_QUEUE_STATE);
+}
+
+#endif
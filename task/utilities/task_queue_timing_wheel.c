@@ -0,0 +1,636 @@
+#include "../environment/config.h"
+
+#if TASK_QUEUE_BACKEND == TASK_QUEUE_BACKEND_TIMING_WHEEL
+
+#include <limits.h>
+#include <stdint.h>
+
+#include "../environment/scheduler_config.h"
+#include "./utils.h"
+
+/**
+ *  @brief Utility function (encapsulated) to initialize the buckets' lists of
+ *  the wheel ( @see{TASK_QUEUE_STATE} )
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{bucket_heads}, @link{bucket_tails},
+ *    @link{task_buckets} and @link{is_initialized} of the @link{ptr_wheel}
+ *
+ *  @param {TASK_QUEUE_STATE *} ptr_wheel - the wheel of the scheduler
+ *
+ */
+static void init_timing_wheel(TASK_QUEUE_STATE *ptr_wheel) {
+  // prevent multiple initializing
+  if (ptr_wheel->is_initialized) {
+    return;
+  }
+
+  for (int i = 0; i < TIMING_WHEEL_BUCKETS; i += 1) {
+    ptr_wheel->bucket_heads[i] = TIMING_WHEEL_NO_TASK;
+    ptr_wheel->bucket_tails[i] = TIMING_WHEEL_NO_TASK;
+  }
+
+  for (int i = 0; i < MAX_TASK_QUANTITY; i += 1) {
+    ptr_wheel->task_buckets[i] = TIMING_WHEEL_NO_BUCKET;
+  }
+
+  ptr_wheel->is_initialized = true;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to append the task to the tail of
+ *  the bucket's list. O(1)
+ *
+ *  @note ! Impure function !
+ *  - mutates the buckets' lists and @link{slots_bitmaps} of the
+ *    @link{ptr_wheel}
+ *
+ *  @param {TASK_QUEUE_STATE *} ptr_wheel - the wheel of the scheduler
+ *  @param {TASK_COUNTER} index - index of the task in the @link{tasks_array}
+ *  @param {unsigned short} bucket - index of the bucket
+ *
+ */
+static void link_task(TASK_QUEUE_STATE *ptr_wheel, TASK_COUNTER index,
+                      unsigned short bucket) {
+  TASK_COUNTER tail = ptr_wheel->bucket_tails[bucket];
+
+  ptr_wheel->prev_links[index] = tail;
+  ptr_wheel->next_links[index] = TIMING_WHEEL_NO_TASK;
+  ptr_wheel->task_buckets[index] = bucket;
+
+  if (tail == TIMING_WHEEL_NO_TASK) {
+    ptr_wheel->bucket_heads[bucket] = index;
+  } else {
+    ptr_wheel->next_links[tail] = index;
+  }
+  ptr_wheel->bucket_tails[bucket] = index;
+
+  if (bucket < TIMING_WHEEL_READY_BUCKET) {
+    ptr_wheel->slots_bitmaps[bucket / TIMING_WHEEL_SLOTS] |=
+        (uint64_t)1 << (bucket % TIMING_WHEEL_SLOTS);
+  }
+}
+
+/**
+ *  @brief Utility function (encapsulated) to remove the task from the bucket's
+ *  list. O(1)
+ *
+ *  @note ! Impure function !
+ *  - mutates the buckets' lists and @link{slots_bitmaps} of the
+ *    @link{ptr_wheel}
+ *
+ *  @param {TASK_QUEUE_STATE *} ptr_wheel - the wheel of the scheduler
+ *  @param {TASK_COUNTER} index - index of the task in the @link{tasks_array}
+ *
+ */
+static void unlink_task(TASK_QUEUE_STATE *ptr_wheel, TASK_COUNTER index) {
+  unsigned short bucket = ptr_wheel->task_buckets[index];
+  TASK_COUNTER prev = ptr_wheel->prev_links[index];
+  TASK_COUNTER next = ptr_wheel->next_links[index];
+
+  if (prev == TIMING_WHEEL_NO_TASK) {
+    ptr_wheel->bucket_heads[bucket] = next;
+  } else {
+    ptr_wheel->next_links[prev] = next;
+  }
+
+  if (next == TIMING_WHEEL_NO_TASK) {
+    ptr_wheel->bucket_tails[bucket] = prev;
+  } else {
+    ptr_wheel->prev_links[next] = prev;
+  }
+
+  ptr_wheel->task_buckets[index] = TIMING_WHEEL_NO_BUCKET;
+
+  if (bucket < TIMING_WHEEL_READY_BUCKET &&
+      ptr_wheel->bucket_heads[bucket] == TIMING_WHEEL_NO_TASK) {
+    ptr_wheel->slots_bitmaps[bucket / TIMING_WHEEL_SLOTS] &=
+        ~((uint64_t)1 << (bucket % TIMING_WHEEL_SLOTS));
+  }
+}
+
+/**
+ *  @brief Utility function (encapsulated) to nest the task to the proper
+ *  bucket via its' deadline. The level is the highest group of 6 bits the
+ *  deadline differs from @link{wheel_timestamp_ms} in. O(1)
+ *
+ *  @note ! Impure function !
+ *  - mutates the buckets' lists of the @link{ptr_scheduler}'s wheel
+ *  - implicit dependency on the @link{wheel_timestamp_ms} of the wheel
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} index - index of the task in the @link{tasks_array}
+ *
+ *  @example
+ *    wheel_timestamp_ms = 1000
+ *    deadline = 1000 + 10 => level 0, slot (1010 & 63)
+ *    deadline = 1000 + 400 => level 1, slot ((1400 >> 6) & 63)
+ *    deadline = 990 => ready bucket (already expired)
+ *
+ */
+static void place_task(Scheduler *ptr_scheduler, TASK_COUNTER index) {
+  TASK_QUEUE_STATE *ptr_wheel = &ptr_scheduler->queue;
+  const TASK_TICKS DEADLINE_TICKS =
+      ptr_scheduler->tasks_array[index].deadline_ticks;
+
+  // round the deadline (ns) up to the wheel's resolution (ms), so the task is
+  // never drained before its' deadline (no overflow for the saturated one)
+  long long deadline_ms = DEADLINE_TICKS / RATIO_NANOSEC_MSEC +
+                          (DEADLINE_TICKS % RATIO_NANOSEC_MSEC != 0);
+
+  if (deadline_ms < ptr_wheel->wheel_timestamp_ms) {
+    link_task(ptr_wheel, index, TIMING_WHEEL_READY_BUCKET);
+    return;
+  }
+
+  unsigned long long differ_bits =
+      (unsigned long long)(deadline_ms ^ ptr_wheel->wheel_timestamp_ms);
+  int level = 0;
+
+  while (level < TIMING_WHEEL_LEVELS &&
+         (differ_bits >> (TIMING_WHEEL_SLOT_BITS * (level + 1))) != 0) {
+    level += 1;
+  }
+
+  if (level == TIMING_WHEEL_LEVELS) {
+    link_task(ptr_wheel, index, TIMING_WHEEL_OVERFLOW_BUCKET);
+    return;
+  }
+
+  int slot = (int)((deadline_ms >> (TIMING_WHEEL_SLOT_BITS * level)) &
+                   TIMING_WHEEL_SLOT_MASK);
+  link_task(ptr_wheel, index, level * TIMING_WHEEL_SLOTS + slot);
+}
+
+/**
+ *  @brief Utility function (encapsulated) to move all the tasks of the bucket
+ *  to the lower levels (or to the ready bucket) relative to the current
+ *  @link{wheel_timestamp_ms}
+ *
+ *  @note ! Impure function !
+ *  - mutates the buckets' lists of the @link{ptr_scheduler}'s wheel
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {unsigned short} bucket - index of the bucket
+ *
+ */
+static void cascade_bucket(Scheduler *ptr_scheduler, unsigned short bucket) {
+  TASK_QUEUE_STATE *ptr_wheel = &ptr_scheduler->queue;
+
+  while (ptr_wheel->bucket_heads[bucket] != TIMING_WHEEL_NO_TASK) {
+    TASK_COUNTER index = ptr_wheel->bucket_heads[bucket];
+    unlink_task(ptr_wheel, index);
+    place_task(ptr_scheduler, index);
+  }
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get the next timestamp (ms) the
+ *  wheel has something to do at: the next occupied slot of any level or the
+ *  last level rotation (for the overflow bucket). O(levels)
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{wheel_timestamp_ms} and
+ *    @link{slots_bitmaps} of the @link{ptr_wheel}
+ *
+ *  @param {const TASK_QUEUE_STATE *} ptr_wheel - the wheel of the scheduler
+ *
+ *  @return {long long} - timestamp (ms) or LLONG_MAX if the wheel is empty
+ *
+ */
+static long long
+get_next_event_timestamp_ms(const TASK_QUEUE_STATE *ptr_wheel) {
+  long long result = LLONG_MAX;
+  const int WHEEL_BITS = TIMING_WHEEL_SLOT_BITS * TIMING_WHEEL_LEVELS;
+  const long long WHEEL_TIMESTAMP_MS = ptr_wheel->wheel_timestamp_ms;
+
+  if (ptr_wheel->bucket_heads[TIMING_WHEEL_OVERFLOW_BUCKET] !=
+      TIMING_WHEEL_NO_TASK) {
+    long long rotation_start = (WHEEL_TIMESTAMP_MS >> WHEEL_BITS) << WHEEL_BITS;
+    result = rotation_start == WHEEL_TIMESTAMP_MS
+                 ? rotation_start
+                 : rotation_start + (1LL << WHEEL_BITS);
+  }
+
+  for (int level = 0; level < TIMING_WHEEL_LEVELS; level += 1) {
+    int shift = TIMING_WHEEL_SLOT_BITS * level;
+    int current_slot = (int)((WHEEL_TIMESTAMP_MS >> shift) &
+                             TIMING_WHEEL_SLOT_MASK);
+    // occupied slots from the current one till the end of the rotation
+    uint64_t ahead_slots =
+        (ptr_wheel->slots_bitmaps[level] >> current_slot) << current_slot;
+
+    if (ahead_slots == 0) {
+      continue;
+    }
+
+    long long slot_start =
+        ((WHEEL_TIMESTAMP_MS >> (shift + TIMING_WHEEL_SLOT_BITS))
+         << (shift + TIMING_WHEEL_SLOT_BITS)) +
+        ((long long)__builtin_ctzll(ahead_slots) << shift);
+
+    if (slot_start < WHEEL_TIMESTAMP_MS) {
+      slot_start = WHEEL_TIMESTAMP_MS;
+    }
+
+    if (slot_start < result) {
+      result = slot_start;
+    }
+  }
+
+  return result;
+}
+
+/**
+ *  @brief Nest the task to the timing wheel. O(1)
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{task_count} and @link{tasks_array} of the
+ *    @link{ptr_scheduler}
+ *  - mutates the buckets' lists of the @link{ptr_scheduler}'s wheel (
+ *    @see{TASK_QUEUE_STATE} )
+ *  - implicit dependency on global variable @link{MAX_TASK_QUANTITY}
+ *
+ *  @note The task is nested to the @link{tasks_array} at Task.id index.
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {Task} task - the task to nest
+ *
+ *  @return {enum Task_queue_errors_codes} - TASK_QUEUE_DONE_SUCCESSFULLY
+ *  @throw TASK_QUEUE_FULL - no free space in the @link{tasks_array}
+ *  @throw TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED - Task.id is out of range
+ *
+ */
+enum Task_queue_errors_codes task_queue_push(Scheduler *ptr_scheduler,
+                                             Task task) {
+  TASK_QUEUE_STATE *ptr_wheel = &ptr_scheduler->queue;
+
+  init_timing_wheel(ptr_wheel);
+
+  if (ptr_scheduler->task_count >= MAX_TASK_QUANTITY) {
+    return TASK_QUEUE_FULL;
+  }
+
+  if (task.id >= MAX_TASK_QUANTITY ||
+      ptr_wheel->task_buckets[task.id] != TIMING_WHEEL_NO_BUCKET) {
+    return TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED;
+  }
+
+  // the empty wheel may be moved forward freely => keep it close to the
+  // current moment to use the lower levels
+  long long created_timestamp_ms = task.created_ticks / RATIO_NANOSEC_MSEC;
+  if (ptr_scheduler->task_count == 0 &&
+      ptr_wheel->wheel_timestamp_ms < created_timestamp_ms) {
+    ptr_wheel->wheel_timestamp_ms = created_timestamp_ms;
+  }
+
+  ptr_scheduler->tasks_array[task.id] = task;
+  place_task(ptr_scheduler, task.id);
+  ptr_scheduler->task_count += 1;
+
+  return TASK_QUEUE_DONE_SUCCESSFULLY;
+}
+
+/**
+ *  @brief Turn the wheel up to the @link{current_ticks}: cascade the
+ *  higher levels' slots and drain the expired slots of the lowest level to the
+ *  ready bucket. Empty slots are skipped via @link{slots_bitmaps}
+ *
+ *  @note ! Impure function !
+ *  - mutates the buckets' lists and @link{wheel_timestamp_ms} of the
+ *    @link{ptr_scheduler}'s wheel ( @see{TASK_QUEUE_STATE} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_TICKS} current_ticks - current monotonic timestamp (ns)
+ *
+ */
+void task_queue_advance(Scheduler *ptr_scheduler, TASK_TICKS current_ticks) {
+  TASK_QUEUE_STATE *ptr_wheel = &ptr_scheduler->queue;
+
+  init_timing_wheel(ptr_wheel);
+
+  // the wheel's resolution is 1 ms
+  const long long current_timestamp_ms = current_ticks / RATIO_NANOSEC_MSEC;
+
+  const int WHEEL_BITS = TIMING_WHEEL_SLOT_BITS * TIMING_WHEEL_LEVELS;
+
+  while (ptr_wheel->wheel_timestamp_ms <= current_timestamp_ms) {
+    long long event_timestamp_ms = get_next_event_timestamp_ms(ptr_wheel);
+
+    if (event_timestamp_ms > current_timestamp_ms) {
+      ptr_wheel->wheel_timestamp_ms = current_timestamp_ms + 1;
+      return;
+    }
+
+    ptr_wheel->wheel_timestamp_ms = event_timestamp_ms;
+
+    // cascade the higher levels' slots starting at this moment
+    for (int level = 1; level < TIMING_WHEEL_LEVELS; level += 1) {
+      int shift = TIMING_WHEEL_SLOT_BITS * level;
+
+      if ((event_timestamp_ms & ((1LL << shift) - 1)) != 0) {
+        break;
+      }
+
+      cascade_bucket(ptr_scheduler,
+                     level * TIMING_WHEEL_SLOTS +
+                         ((event_timestamp_ms >> shift) &
+                          TIMING_WHEEL_SLOT_MASK));
+    }
+
+    if ((event_timestamp_ms & ((1LL << WHEEL_BITS) - 1)) == 0) {
+      cascade_bucket(ptr_scheduler, TIMING_WHEEL_OVERFLOW_BUCKET);
+    }
+
+    // drain the current slot of the lowest level
+    unsigned short bucket = event_timestamp_ms & TIMING_WHEEL_SLOT_MASK;
+    while (ptr_wheel->bucket_heads[bucket] != TIMING_WHEEL_NO_TASK) {
+      TASK_COUNTER index = ptr_wheel->bucket_heads[bucket];
+      unlink_task(ptr_wheel, index);
+      link_task(ptr_wheel, index, TIMING_WHEEL_READY_BUCKET);
+    }
+
+    ptr_wheel->wheel_timestamp_ms += 1;
+  }
+}
+
+/**
+ *  @brief Get the first task of the drained (expired) slots. O(1)
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{tasks_array} of the
+ *    @link{ptr_scheduler}
+ *  - implicit dependency on the ready bucket of the wheel
+ *
+ *  @note Call @link{task_queue_advance} before to drain the expired slots.
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {Task *} - pointer to the task or NULL if no task is expired yet
+ *
+ */
+Task *task_queue_peek(Scheduler *ptr_scheduler) {
+  TASK_QUEUE_STATE *ptr_wheel = &ptr_scheduler->queue;
+
+  init_timing_wheel(ptr_wheel);
+
+  TASK_COUNTER index = ptr_wheel->bucket_heads[TIMING_WHEEL_READY_BUCKET];
+
+  if (index == TIMING_WHEEL_NO_TASK) {
+    return NULL;
+  }
+
+  return &ptr_scheduler->tasks_array[index];
+}
+
+/**
+ *  @brief Remove the first task of the drained (expired) slots. O(1)
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{task_count} and @link{tasks_array} of the
+ *    @link{ptr_scheduler}
+ *  - mutates the buckets' lists of the @link{ptr_scheduler}'s wheel (
+ *    @see{TASK_QUEUE_STATE} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {enum Task_queue_errors_codes} - TASK_QUEUE_DONE_SUCCESSFULLY
+ *  @throw TASK_QUEUE_EMPTY - no expired task
+ *
+ */
+enum Task_queue_errors_codes task_queue_pop(Scheduler *ptr_scheduler) {
+  TASK_QUEUE_STATE *ptr_wheel = &ptr_scheduler->queue;
+
+  init_timing_wheel(ptr_wheel);
+
+  TASK_COUNTER index = ptr_wheel->bucket_heads[TIMING_WHEEL_READY_BUCKET];
+
+  if (index == TIMING_WHEEL_NO_TASK) {
+    return TASK_QUEUE_EMPTY;
+  }
+
+  unlink_task(ptr_wheel, index);
+  ptr_scheduler->tasks_array[index] = (Task){0};
+  ptr_scheduler->task_count -= 1;
+
+  return TASK_QUEUE_DONE_SUCCESSFULLY;
+}
+
+/**
+ *  @brief Remove the task via its' id from the timing wheel. O(1)
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{task_count} and @link{tasks_array} of the
+ *    @link{ptr_scheduler}
+ *  - mutates the buckets' lists of the @link{ptr_scheduler}'s wheel (
+ *    @see{TASK_QUEUE_STATE} )
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} id - id of the task to remove
+ *
+ *  @return {enum Task_queue_errors_codes} - TASK_QUEUE_DONE_SUCCESSFULLY
+ *  @throw TASK_QUEUE_EMPTY - current task counter value is 0
+ *  @throw TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED - no such task with given ID
+ *
+ */
+enum Task_queue_errors_codes task_queue_remove(Scheduler *ptr_scheduler,
+                                               TASK_COUNTER id) {
+  TASK_QUEUE_STATE *ptr_wheel = &ptr_scheduler->queue;
+
+  init_timing_wheel(ptr_wheel);
+
+  if (ptr_scheduler->task_count == 0) {
+    return TASK_QUEUE_EMPTY;
+  }
+
+  if (id >= MAX_TASK_QUANTITY ||
+      ptr_wheel->task_buckets[id] == TIMING_WHEEL_NO_BUCKET) {
+    return TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED;
+  }
+
+  unlink_task(ptr_wheel, id);
+  ptr_scheduler->tasks_array[id] = (Task){0};
+  ptr_scheduler->task_count -= 1;
+
+  return TASK_QUEUE_DONE_SUCCESSFULLY;
+}
+
+/**
+ *  @brief Set up new delay (ms) and creation timestamp of the task via its' id
+ *  and move it to the proper bucket. O(1)
+ *
+ *  @note ! Impure function !
+ *  - mutates the @link{tasks_array} of the @link{ptr_scheduler}
+ *  - mutates the buckets' lists of the @link{ptr_scheduler}'s wheel (
+ *    @see{TASK_QUEUE_STATE} )
+ *  - implicit dependency on @callback{set_task_delay}
+ *  - implicit dependency on the @link{slacks} of the @link{ptr_scheduler}
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *  @param {TASK_COUNTER} id - id of the task to reschedule
+ *  @param {TASK_DELAY} new_delay - new delay value (ms!)
+ *  @param {TASK_TICKS} created_ticks - new creation monotonic timestamp (ns)
+ *
+ *  @return {enum Task_queue_errors_codes} - TASK_QUEUE_DONE_SUCCESSFULLY
+ *  @throw TASK_QUEUE_EMPTY - current task counter value is 0
+ *  @throw TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED - no such task with given ID
+ *
+ */
+enum Task_queue_errors_codes
+task_queue_reschedule(Scheduler *ptr_scheduler, TASK_COUNTER id,
+                      TASK_DELAY new_delay, TASK_TICKS created_ticks) {
+  TASK_QUEUE_STATE *ptr_wheel = &ptr_scheduler->queue;
+
+  init_timing_wheel(ptr_wheel);
+
+  if (ptr_scheduler->task_count == 0) {
+    return TASK_QUEUE_EMPTY;
+  }
+
+  if (id >= MAX_TASK_QUANTITY ||
+      ptr_wheel->task_buckets[id] == TIMING_WHEEL_NO_BUCKET) {
+    return TASK_QUEUE_TASK_ID_IS_NOT_DETERMINED;
+  }
+
+  Task *ptr_task = &ptr_scheduler->tasks_array[id];
+
+  unlink_task(ptr_wheel, id);
+  set_task_delay(ptr_task, new_delay, ptr_scheduler->slacks.task_slacks[id],
+                 created_ticks);
+  place_task(ptr_scheduler, id);
+
+  return TASK_QUEUE_DONE_SUCCESSFULLY;
+}
+
+/**
+ *  @brief Utility function (encapsulated) to get the bucket of the latest
+ *  deadlines: the overflow bucket, otherwise the last occupied slot of the
+ *  highest occupied level, otherwise the ready bucket. O(levels)
+ *
+ *  @note The occupied slots of the level are never behind the current one
+ *  (the passed ones are cascaded or drained), so the slots of the higher
+ *  level are later than all the lower levels' ones and the last occupied
+ *  slot of the level is the latest one.
+ *
+ *  @param {const TASK_QUEUE_STATE *} ptr_wheel - the wheel of the scheduler
+ *
+ *  @return {unsigned short} - index of the bucket
+ *
+ */
+static unsigned short get_furthest_bucket(const TASK_QUEUE_STATE *ptr_wheel) {
+  if (ptr_wheel->bucket_heads[TIMING_WHEEL_OVERFLOW_BUCKET] !=
+      TIMING_WHEEL_NO_TASK) {
+    return TIMING_WHEEL_OVERFLOW_BUCKET;
+  }
+
+  for (int level = TIMING_WHEEL_LEVELS - 1; level >= 0; level -= 1) {
+    if (ptr_wheel->slots_bitmaps[level] != 0) {
+      return level * TIMING_WHEEL_SLOTS + TIMING_WHEEL_SLOT_MASK -
+             __builtin_clzll(ptr_wheel->slots_bitmaps[level]);
+    }
+  }
+
+  return TIMING_WHEEL_READY_BUCKET;
+}
+
+/**
+ *  @brief Get the task with the latest deadline (the eviction candidate,
+ *  @see{handle_full_queue}): the scan of the furthest occupied bucket only.
+ *  O(levels + tasks of the bucket)
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{tasks_array} and @link{task_count} of
+ *    the @link{ptr_scheduler}
+ *  - implicit dependency on the buckets' lists and @link{slots_bitmaps} of
+ *    the @link{ptr_scheduler}'s wheel ( @see{TASK_QUEUE_STATE} )
+ *  - implicit dependency on @callback{get_furthest_bucket}
+ *
+ *  @note The slot of the level L spans 64 ** L ms, so the scanned bucket
+ *  holds the tasks of one such span (or the whole overflow / ready bucket).
+ *
+ *  @param {Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {Task *} - pointer to the task or NULL if @link{tasks_array} is
+ *  empty
+ *
+ */
+Task *task_queue_peek_furthest(Scheduler *ptr_scheduler) {
+  if (ptr_scheduler->task_count == 0) {
+    return NULL;
+  }
+
+  const TASK_QUEUE_STATE *ptr_wheel = &ptr_scheduler->queue;
+  Task *ptr_furthest = NULL;
+
+  for (TASK_COUNTER index =
+           ptr_wheel->bucket_heads[get_furthest_bucket(ptr_wheel)];
+       index != TIMING_WHEEL_NO_TASK; index = ptr_wheel->next_links[index]) {
+    if ((ptr_furthest == NULL) ||
+        (ptr_scheduler->tasks_array[index].deadline_ticks >
+         ptr_furthest->deadline_ticks)) {
+      ptr_furthest = &ptr_scheduler->tasks_array[index];
+    }
+  }
+
+  return ptr_furthest;
+}
+
+/**
+ *  @brief Get the monotonic timestamp (ns) the wheel has to be advanced at
+ *  next: the deadline of the drained (expired) task if any, otherwise the
+ *  start of the next occupied slot. O(levels)
+ *
+ *  @note For the higher levels' slots it's a lower bound of the earliest
+ *  deadline: advancing at that moment cascades the slot, the next call gives
+ *  the closer timestamp.
+ *
+ *  @note ! Impure function !
+ *  - implicit dependency on the @link{tasks_array} of the
+ *    @link{ptr_scheduler}
+ *  - implicit dependency on the buckets' lists and @link{wheel_timestamp_ms}
+ *    of the @link{ptr_scheduler}'s wheel
+ *
+ *  @param {const Scheduler *} ptr_scheduler - the scheduler instance
+ *
+ *  @return {TASK_TICKS} - monotonic timestamp (ns) or LLONG_MAX if the wheel
+ *  is empty
+ *
+ */
+TASK_TICKS task_queue_get_next_deadline(const Scheduler *ptr_scheduler) {
+  const TASK_QUEUE_STATE *ptr_wheel = &ptr_scheduler->queue;
+
+  // not initialized yet => nothing is nested
+  if (!ptr_wheel->is_initialized) {
+    return LLONG_MAX;
+  }
+
+  TASK_COUNTER index = ptr_wheel->bucket_heads[TIMING_WHEEL_READY_BUCKET];
+
+  if (index != TIMING_WHEEL_NO_TASK) {
+    return ptr_scheduler->tasks_array[index].deadline_ticks;
+  }
+
+  long long event_timestamp_ms = get_next_event_timestamp_ms(ptr_wheel);
+
+  // no overflow for the saturated deadlines
+  if (event_timestamp_ms > LLONG_MAX / RATIO_NANOSEC_MSEC) {
+    return LLONG_MAX;
+  }
+
+  return event_timestamp_ms * RATIO_NANOSEC_MSEC;
+}
+
+/**
+ *  @brief Get the size (bytes) of the backend's own static arenas per
+ *  scheduler instance (the buckets' lists, links and bitmaps)
+ *
+ *  @param {void} - no params expected
+ *
+ *  @return {size_t} - size (bytes)
+ *
+ */
+size_t task_queue_get_arena_size(void) {
+  return sizeof(TASK_QUEUE_STATE);
+}
+
+#endif
@@ -1,10 +1,32 @@
 #ifndef UTILS_H
 #define UTILS_H
 
+#include <stdint.h>
+
 #include "../environment/config.h"
+#include "./handle_callback_registry_config.h"
+#include "./handle_clock_config.h"
+#include "./handle_command_ring_config.h"
 #include "./handle_id_config.h"
+#include "./handle_overload_config.h"
+#include "./handle_periodic_tasks_config.h"
+#include "./handle_scheduler_fd_config.h"
+#include "./handle_shards_config.h"
+#include "./handle_timer_slack_config.h"
+#include "./handle_wait_config.h"
+#include "./handle_worker_pool_config.h"
+#include "./task_queue_config.h"
 
-void sort_tasks_descending_by_delay(Task arr[], size_t arr_size,
-                                    unsigned short elems_quantity_to_sort);
+void sort_tasks_descending_by_deadline(Task arr[], size_t arr_size,
+                                       TASK_COUNTER elems_quantity_to_sort);
+TASK_TICKS get_task_deadline_ticks(TASK_TICKS created_ticks,
+                                   TASK_DELAY delay);
+void set_task_delay(Task *ptr_task, TASK_DELAY delay, TASK_DELAY slack,
+                    TASK_TICKS created_ticks);
+uint64_t get_expired_deadlines_mask(const TASK_TICKS deadlines[],
+                                    size_t quantity,
+                                    TASK_TICKS current_ticks);
+size_t get_earliest_deadline_index(const TASK_TICKS deadlines[],
+                                   size_t quantity);
 
 #endif